@@ -61,6 +61,22 @@ void bench_fill_constructor(benchmark::State& state) {
     }
 }
 
+template<ELib l>
+void bench_erase_if(benchmark::State& state) {
+    for(auto&& _ : state) {
+        state.PauseTiming();
+        std::conditional_t<l == ELib::xme, xme::Array<int64_t>, std::vector<int64_t>> arr;
+        for(int64_t i = 0; i < state.range(0); ++i)
+            arr.push_back(i);
+        state.ResumeTiming();
+        if constexpr(l == ELib::xme)
+            arr.erase_if([](int64_t value) { return value % 3 == 0; });
+        else
+            std::erase_if(arr, [](int64_t value) { return value % 3 == 0; });
+        benchmark::DoNotOptimize(arr.data());
+    }
+}
+
 BENCHMARK(bench_push_xme<int64_t>);
 BENCHMARK(bench_push_std<int64_t>);
 BENCHMARK(bench_push_xme<T>);
@@ -76,4 +92,7 @@ BENCHMARK(bench_fill_constructor<int64_t, ELib::xme>);
 BENCHMARK(bench_fill_constructor<int64_t, ELib::std>);
 BENCHMARK(bench_fill_constructor<T, ELib::xme>);
 BENCHMARK(bench_fill_constructor<T, ELib::std>);
+
+BENCHMARK(bench_erase_if<ELib::xme>)->Range(1 << 8, 1 << 16);
+BENCHMARK(bench_erase_if<ELib::std>)->Range(1 << 8, 1 << 16);
 BENCHMARK_MAIN();
@@ -0,0 +1,34 @@
+#include <xme/container/array.hpp>
+#include <xme/container/concurrent_array.hpp>
+#include <benchmark/benchmark.h>
+#include <cstdint>
+#include <mutex>
+
+struct LockedArray {
+    void push_back(std::int64_t value) {
+        std::lock_guard lock{mutex};
+        array.push_back(value);
+    }
+
+    std::mutex mutex;
+    xme::Array<std::int64_t> array;
+};
+
+template<typename Container>
+void bench_append(benchmark::State& state) {
+    static Container* container = nullptr;
+    if(state.thread_index() == 0)
+        container = new Container;
+
+    std::int64_t value = 0;
+    for(auto&& _ : state)
+        container->push_back(value++);
+    state.SetItemsProcessed(state.iterations());
+
+    if(state.thread_index() == 0)
+        delete container;
+}
+
+BENCHMARK(bench_append<xme::ConcurrentArray<std::int64_t>>)->ThreadRange(1, 32)->UseRealTime();
+BENCHMARK(bench_append<LockedArray>)->ThreadRange(1, 32)->UseRealTime();
+BENCHMARK_MAIN();
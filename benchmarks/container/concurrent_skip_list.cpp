@@ -0,0 +1,65 @@
+#include <xme/container/concurrent_skip_list.hpp>
+#include <benchmark/benchmark.h>
+#include <cstdint>
+#include <map>
+#include <mutex>
+#include <random>
+#include <shared_mutex>
+
+struct LockedMap {
+    bool insert(std::int64_t key, std::int64_t value) {
+        std::unique_lock lock{mutex};
+        return map.emplace(key, value).second;
+    }
+
+    bool erase(std::int64_t key) {
+        std::unique_lock lock{mutex};
+        return map.erase(key) == 1;
+    }
+
+    bool contains(std::int64_t key) const {
+        std::shared_lock lock{mutex};
+        return map.contains(key);
+    }
+
+    mutable std::shared_mutex mutex;
+    std::map<std::int64_t, std::int64_t> map;
+};
+
+constexpr std::int64_t key_range = 1 << 16;
+
+//! Every operation picks a random key, state.range(0) percent of them are writes,
+//! split evenly between inserts and erases.
+template<typename Map>
+void bench_mixed(benchmark::State& state) {
+    static Map* map = nullptr;
+    if(state.thread_index() == 0) {
+        map = new Map;
+        for(std::int64_t key = 0; key < key_range; key += 2)
+            map->insert(key, key);
+    }
+
+    const auto writes = std::uint64_t(state.range(0));
+    std::mt19937_64 rng(state.thread_index() + 1);
+    for(auto&& _ : state) {
+        const std::uint64_t random = rng();
+        const auto key             = std::int64_t(random % key_range);
+        const std::uint64_t kind   = (random >> 32) % 100;
+        if(kind < writes / 2)
+            benchmark::DoNotOptimize(map->insert(key, key));
+        else if(kind < writes)
+            benchmark::DoNotOptimize(map->erase(key));
+        else
+            benchmark::DoNotOptimize(map->contains(key));
+    }
+    state.SetItemsProcessed(state.iterations());
+
+    if(state.thread_index() == 0)
+        delete map;
+}
+
+using skip_list_t = xme::ConcurrentSkipListMap<std::int64_t, std::int64_t>;
+
+BENCHMARK(bench_mixed<skip_list_t>)->Arg(10)->Arg(50)->ThreadRange(1, 32)->UseRealTime();
+BENCHMARK(bench_mixed<LockedMap>)->Arg(10)->Arg(50)->ThreadRange(1, 32)->UseRealTime();
+BENCHMARK_MAIN();
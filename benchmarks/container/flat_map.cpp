@@ -0,0 +1,77 @@
+#include <xme/container/flat_map.hpp>
+#include <benchmark/benchmark.h>
+#include <map>
+#include <cstdint>
+#include <random>
+#include <vector>
+
+enum class ELib {
+    xme,
+    std,
+};
+
+template<ELib l>
+using map_t = std::conditional_t<l == ELib::xme, xme::FlatMap<std::int64_t, std::int64_t>,
+                                 std::map<std::int64_t, std::int64_t>>;
+
+auto random_items(std::size_t n, std::uint32_t seed)
+  -> std::vector<xme::Pair<std::int64_t, std::int64_t>> {
+    std::mt19937_64 rng(seed);
+    std::vector<xme::Pair<std::int64_t, std::int64_t>> items(n);
+    for(auto& item : items)
+        item.first = item.second = static_cast<std::int64_t>(rng());
+    return items;
+}
+
+template<ELib l>
+void bench_insert_range(benchmark::State& state) {
+    const auto items = random_items(state.range(0), 1);
+    for(auto&& _ : state) {
+        map_t<l> map;
+        if constexpr(l == ELib::xme)
+            map.insert_range(items);
+        else
+            for(auto& [key, value] : items)
+                map.emplace(key, value);
+        benchmark::DoNotOptimize(map);
+    }
+    state.SetItemsProcessed(state.iterations() * items.size());
+}
+
+template<ELib l>
+void bench_lookup(benchmark::State& state) {
+    const auto items = random_items(state.range(0), 1);
+    map_t<l> map;
+    for(auto& [key, value] : items)
+        map.try_emplace(key, value);
+    for(auto&& _ : state) {
+        for(auto& item : items)
+            benchmark::DoNotOptimize(map.find(item.first));
+    }
+    state.SetItemsProcessed(state.iterations() * items.size());
+}
+
+template<ELib l>
+void bench_iterate(benchmark::State& state) {
+    const auto items = random_items(state.range(0), 1);
+    map_t<l> map;
+    for(auto& [key, value] : items)
+        map.try_emplace(key, value);
+    for(auto&& _ : state) {
+        std::int64_t sum = 0;
+        for(auto&& [key, value] : map)
+            sum += value;
+        benchmark::DoNotOptimize(sum);
+    }
+    state.SetItemsProcessed(state.iterations() * items.size());
+}
+
+BENCHMARK(bench_insert_range<ELib::xme>)->Range(1 << 8, 1 << 18);
+BENCHMARK(bench_insert_range<ELib::std>)->Range(1 << 8, 1 << 18);
+
+BENCHMARK(bench_lookup<ELib::xme>)->Range(1 << 8, 1 << 18);
+BENCHMARK(bench_lookup<ELib::std>)->Range(1 << 8, 1 << 18);
+
+BENCHMARK(bench_iterate<ELib::xme>)->Range(1 << 8, 1 << 18);
+BENCHMARK(bench_iterate<ELib::std>)->Range(1 << 8, 1 << 18);
+BENCHMARK_MAIN();
@@ -0,0 +1,91 @@
+#include <xme/container/hash_map.hpp>
+#include <benchmark/benchmark.h>
+#include <unordered_map>
+#include <cstdint>
+#include <random>
+#include <vector>
+
+enum class ELib {
+    xme,
+    std,
+};
+
+template<ELib l>
+using map_t = std::conditional_t<l == ELib::xme, xme::HashMap<std::int64_t, std::int64_t>,
+                                 std::unordered_map<std::int64_t, std::int64_t>>;
+
+auto random_keys(std::size_t n, std::uint32_t seed) -> std::vector<std::int64_t> {
+    std::mt19937_64 rng(seed);
+    std::vector<std::int64_t> keys(n);
+    for(auto& key : keys)
+        key = static_cast<std::int64_t>(rng());
+    return keys;
+}
+
+template<ELib l>
+void bench_insert(benchmark::State& state) {
+    const auto keys = random_keys(state.range(0), 1);
+    for(auto&& _ : state) {
+        map_t<l> map;
+        for(auto key : keys)
+            map.insert({key, key});
+        benchmark::DoNotOptimize(map);
+    }
+    state.SetItemsProcessed(state.iterations() * keys.size());
+}
+
+template<ELib l>
+void bench_lookup_hit(benchmark::State& state) {
+    const auto keys = random_keys(state.range(0), 1);
+    map_t<l> map;
+    for(auto key : keys)
+        map.insert({key, key});
+    for(auto&& _ : state) {
+        for(auto key : keys)
+            benchmark::DoNotOptimize(map.find(key));
+    }
+    state.SetItemsProcessed(state.iterations() * keys.size());
+}
+
+template<ELib l>
+void bench_lookup_miss(benchmark::State& state) {
+    const auto keys    = random_keys(state.range(0), 1);
+    const auto missing = random_keys(state.range(0), 2);
+    map_t<l> map;
+    for(auto key : keys)
+        map.insert({key, key});
+    for(auto&& _ : state) {
+        for(auto key : missing)
+            benchmark::DoNotOptimize(map.find(key));
+    }
+    state.SetItemsProcessed(state.iterations() * missing.size());
+}
+
+template<ELib l>
+void bench_erase(benchmark::State& state) {
+    const auto keys = random_keys(state.range(0), 1);
+    for(auto&& _ : state) {
+        state.PauseTiming();
+        map_t<l> map;
+        for(auto key : keys)
+            map.insert({key, key});
+        state.ResumeTiming();
+        for(auto key : keys)
+            map.erase(key);
+        benchmark::DoNotOptimize(map);
+    }
+    state.SetItemsProcessed(state.iterations() * keys.size());
+}
+
+BENCHMARK(bench_insert<ELib::xme>)->Range(1 << 8, 1 << 18);
+BENCHMARK(bench_insert<ELib::std>)->Range(1 << 8, 1 << 18);
+
+BENCHMARK(bench_lookup_hit<ELib::xme>)->Range(1 << 8, 1 << 18);
+BENCHMARK(bench_lookup_hit<ELib::std>)->Range(1 << 8, 1 << 18);
+
+BENCHMARK(bench_lookup_miss<ELib::xme>)->Range(1 << 8, 1 << 18);
+BENCHMARK(bench_lookup_miss<ELib::std>)->Range(1 << 8, 1 << 18);
+
+BENCHMARK(bench_erase<ELib::xme>)->Range(1 << 8, 1 << 18);
+BENCHMARK(bench_erase<ELib::std>)->Range(1 << 8, 1 << 18);
+BENCHMARK_MAIN();
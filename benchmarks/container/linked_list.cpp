@@ -0,0 +1,121 @@
+#include <xme/container/linked_list.hpp>
+#include <xme/core/memory/pool_allocator.hpp>
+#include <benchmark/benchmark.h>
+#include <algorithm>
+#include <cstdint>
+#include <numeric>
+#include <random>
+#include <vector>
+
+template<typename Alloc>
+void bench_range_construct(benchmark::State& state) {
+    std::vector<std::int64_t> values(state.range(0));
+    std::iota(values.begin(), values.end(), 0);
+    for(auto&& _ : state) {
+        xme::LinkedList<std::int64_t, Alloc> list(values);
+        benchmark::DoNotOptimize(list.begin());
+    }
+    state.SetItemsProcessed(state.iterations() * values.size());
+}
+
+template<typename Alloc>
+void bench_traverse(benchmark::State& state) {
+    std::vector<std::int64_t> values(state.range(0));
+    std::iota(values.begin(), values.end(), 0);
+    xme::LinkedList<std::int64_t, Alloc> list(values);
+    for(auto&& _ : state) {
+        std::int64_t sum = 0;
+        for(std::int64_t value : list)
+            sum += value;
+        benchmark::DoNotOptimize(sum);
+    }
+    state.SetItemsProcessed(state.iterations() * values.size());
+}
+
+template<typename Alloc>
+void bench_sort(benchmark::State& state) {
+    std::vector<std::int64_t> values(state.range(0));
+    std::mt19937_64 rng(1);
+    for(std::int64_t& value : values)
+        value = static_cast<std::int64_t>(rng());
+    for(auto&& _ : state) {
+        state.PauseTiming();
+        xme::LinkedList<std::int64_t, Alloc> list(values);
+        state.ResumeTiming();
+        list.sort();
+        benchmark::DoNotOptimize(list.begin());
+    }
+    state.SetItemsProcessed(state.iterations() * values.size());
+}
+
+//! A list whose order is unrelated to the order its nodes were allocated in.
+void fill_shuffled(xme::LinkedList<std::int64_t>& list, std::int64_t n) {
+    std::vector<std::int64_t> values(n);
+    std::iota(values.begin(), values.end(), 0);
+    std::ranges::shuffle(values, std::mt19937_64(1));
+    list.assign(values);
+    list.sort();
+}
+
+void bench_shuffled_traverse(benchmark::State& state) {
+    xme::LinkedList<std::int64_t> list;
+    fill_shuffled(list, state.range(0));
+    for(auto&& _ : state) {
+        std::int64_t sum = 0;
+        for(std::int64_t value : list)
+            sum += value;
+        benchmark::DoNotOptimize(sum);
+    }
+    state.SetItemsProcessed(state.iterations() * state.range(0));
+}
+
+void bench_shuffled_for_each_prefetch(benchmark::State& state) {
+    xme::LinkedList<std::int64_t> list;
+    fill_shuffled(list, state.range(0));
+    for(auto&& _ : state) {
+        std::int64_t sum = 0;
+        list.for_each_prefetch([&sum](std::int64_t value) { sum += value; });
+        benchmark::DoNotOptimize(sum);
+    }
+    state.SetItemsProcessed(state.iterations() * state.range(0));
+}
+
+void bench_compacted_traverse(benchmark::State& state) {
+    xme::LinkedList<std::int64_t> list;
+    fill_shuffled(list, state.range(0));
+    list.compact();
+    for(auto&& _ : state) {
+        std::int64_t sum = 0;
+        for(std::int64_t value : list)
+            sum += value;
+        benchmark::DoNotOptimize(sum);
+    }
+    state.SetItemsProcessed(state.iterations() * state.range(0));
+}
+
+void bench_compact(benchmark::State& state) {
+    for(auto&& _ : state) {
+        state.PauseTiming();
+        xme::LinkedList<std::int64_t> list;
+        fill_shuffled(list, state.range(0));
+        state.ResumeTiming();
+        list.compact();
+        benchmark::DoNotOptimize(list.begin());
+    }
+    state.SetItemsProcessed(state.iterations() * state.range(0));
+}
+
+BENCHMARK(bench_range_construct<std::allocator<std::int64_t>>)->Range(1 << 8, 1 << 18);
+BENCHMARK(bench_range_construct<xme::PoolAllocator<std::int64_t>>)->Range(1 << 8, 1 << 18);
+
+BENCHMARK(bench_traverse<std::allocator<std::int64_t>>)->Range(1 << 8, 1 << 18);
+BENCHMARK(bench_traverse<xme::PoolAllocator<std::int64_t>>)->Range(1 << 8, 1 << 18);
+
+BENCHMARK(bench_sort<std::allocator<std::int64_t>>)->Range(1 << 8, 1 << 18);
+BENCHMARK(bench_sort<xme::PoolAllocator<std::int64_t>>)->Range(1 << 8, 1 << 18);
+
+BENCHMARK(bench_shuffled_traverse)->Range(1 << 8, 1 << 18);
+BENCHMARK(bench_shuffled_for_each_prefetch)->Range(1 << 8, 1 << 18);
+BENCHMARK(bench_compacted_traverse)->Range(1 << 8, 1 << 18);
+BENCHMARK(bench_compact)->Range(1 << 8, 1 << 18);
+BENCHMARK_MAIN();
@@ -0,0 +1,70 @@
+#include <xme/container/lru_cache.hpp>
+#include <benchmark/benchmark.h>
+#include <cstdint>
+#include <list>
+#include <random>
+#include <unordered_map>
+#include <vector>
+
+//! The usual std::list + std::unordered_map implementation, as a baseline.
+class StdLRUCache {
+public:
+    explicit StdLRUCache(std::size_t capacity) : m_capacity(capacity) {}
+
+    auto get(std::int64_t key) -> std::int64_t* {
+        auto found = m_index.find(key);
+        if(found == m_index.end())
+            return nullptr;
+        m_list.splice(m_list.begin(), m_list, found->second);
+        return &found->second->second;
+    }
+
+    auto put(std::int64_t key, std::int64_t value) -> std::int64_t* {
+        auto found = m_index.find(key);
+        if(found != m_index.end()) {
+            found->second->second = value;
+            m_list.splice(m_list.begin(), m_list, found->second);
+            return &found->second->second;
+        }
+        if(m_list.size() == m_capacity) {
+            m_index.erase(m_list.back().first);
+            m_list.pop_back();
+        }
+        m_list.emplace_front(key, value);
+        m_index.emplace(key, m_list.begin());
+        return &m_list.front().second;
+    }
+
+private:
+    using list_type = std::list<std::pair<std::int64_t, std::int64_t>>;
+
+    list_type m_list;
+    std::unordered_map<std::int64_t, list_type::iterator> m_index;
+    std::size_t m_capacity;
+};
+
+//! Reads keys drawn from twice the capacity, and puts the missing ones.
+template<typename Cache>
+void bench_get_or_put(benchmark::State& state) {
+    const auto capacity = static_cast<std::size_t>(state.range(0));
+    std::mt19937_64 rng{42};
+    std::uniform_int_distribution<std::int64_t> dist(0, 2 * state.range(0));
+    std::vector<std::int64_t> keys(1 << 16);
+    for(auto& key : keys)
+        key = dist(rng);
+
+    Cache cache(capacity);
+    for(auto&& _ : state) {
+        for(std::int64_t key : keys) {
+            std::int64_t* value = cache.get(key);
+            if(value == nullptr)
+                value = cache.put(key, key);
+            benchmark::DoNotOptimize(value);
+        }
+    }
+    state.SetItemsProcessed(state.iterations() * keys.size());
+}
+
+BENCHMARK(bench_get_or_put<xme::LRUCache<std::int64_t, std::int64_t>>)->Range(1 << 8, 1 << 18);
+BENCHMARK(bench_get_or_put<StdLRUCache>)->Range(1 << 8, 1 << 18);
+BENCHMARK_MAIN();
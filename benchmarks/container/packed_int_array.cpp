@@ -0,0 +1,62 @@
+#include <xme/container/packed_int_array.hpp>
+#include <benchmark/benchmark.h>
+#include <cstdint>
+#include <numeric>
+#include <random>
+#include <vector>
+
+constexpr unsigned width = 11;
+
+auto make_column(std::int64_t size) -> std::vector<std::uint32_t> {
+    std::mt19937 rng(1);
+    std::vector<std::uint32_t> column(size);
+    for(std::uint32_t& value : column)
+        value = rng() & ((1u << width) - 1);
+    return column;
+}
+
+//! Sums a column through a buffer of unpacked values, as a scan would.
+void bench_packed_scan(benchmark::State& state) {
+    const std::vector<std::uint32_t> column = make_column(state.range(0));
+    xme::PackedIntArray<> packed(width);
+    for(std::uint32_t value : column)
+        packed.push_back(value);
+    std::uint32_t buffer[256];
+    for(auto&& _ : state) {
+        std::uint64_t sum = 0;
+        for(std::size_t i = 0; i < packed.size(); i += 256) {
+            const std::size_t n = std::min<std::size_t>(256, packed.size() - i);
+            packed.unpack(i, xme::ArrayView<std::uint32_t>(buffer, n));
+            sum = std::accumulate(buffer, buffer + n, sum);
+        }
+        benchmark::DoNotOptimize(sum);
+    }
+    state.SetItemsProcessed(state.iterations() * column.size());
+}
+
+void bench_packed_get(benchmark::State& state) {
+    const std::vector<std::uint32_t> column = make_column(state.range(0));
+    xme::PackedIntArray<> packed(width);
+    for(std::uint32_t value : column)
+        packed.push_back(value);
+    for(auto&& _ : state) {
+        std::uint64_t sum = 0;
+        for(std::size_t i = 0; i < packed.size(); ++i)
+            sum += packed[i];
+        benchmark::DoNotOptimize(sum);
+    }
+    state.SetItemsProcessed(state.iterations() * column.size());
+}
+
+void bench_std_vector_scan(benchmark::State& state) {
+    const std::vector<std::uint32_t> column = make_column(state.range(0));
+    for(auto&& _ : state)
+        benchmark::DoNotOptimize(std::accumulate(column.begin(), column.end(), std::uint64_t(0)));
+    state.SetItemsProcessed(state.iterations() * column.size());
+}
+
+BENCHMARK(bench_packed_scan)->Range(1 << 8, 1 << 22);
+BENCHMARK(bench_packed_get)->Range(1 << 8, 1 << 22);
+BENCHMARK(bench_std_vector_scan)->Range(1 << 8, 1 << 22);
+
+BENCHMARK_MAIN();
@@ -0,0 +1,60 @@
+#include <xme/container/array.hpp>
+#include <xme/container/linked_list.hpp>
+#include <xme/container/unrolled_list.hpp>
+#include <benchmark/benchmark.h>
+#include <cstdint>
+#include <numeric>
+#include <vector>
+
+template<typename List>
+void bench_traverse(benchmark::State& state) {
+    std::vector<std::int64_t> values(state.range(0));
+    std::iota(values.begin(), values.end(), 0);
+    List list(values);
+    for(auto&& _ : state) {
+        std::int64_t sum = 0;
+        for(std::int64_t value : list)
+            sum += value;
+        benchmark::DoNotOptimize(sum);
+    }
+    state.SetItemsProcessed(state.iterations() * values.size());
+}
+
+template<typename List>
+void bench_for_each(benchmark::State& state) {
+    std::vector<std::int64_t> values(state.range(0));
+    std::iota(values.begin(), values.end(), 0);
+    List list(values);
+    for(auto&& _ : state) {
+        std::int64_t sum = 0;
+        list.for_each([&sum](std::int64_t value) { sum += value; });
+        benchmark::DoNotOptimize(sum);
+    }
+    state.SetItemsProcessed(state.iterations() * values.size());
+}
+
+template<typename List>
+void bench_push_front(benchmark::State& state) {
+    for(auto&& _ : state) {
+        List list;
+        for(std::int64_t i = 0; i < state.range(0); ++i)
+            list.push_front(i);
+        benchmark::DoNotOptimize(list.begin());
+    }
+    state.SetItemsProcessed(state.iterations() * state.range(0));
+}
+
+using array_t         = xme::Array<std::int64_t>;
+using linked_list_t   = xme::LinkedList<std::int64_t>;
+using unrolled_list_t = xme::UnrolledList<std::int64_t>;
+
+BENCHMARK(bench_traverse<array_t>)->Range(1 << 8, 1 << 18);
+BENCHMARK(bench_traverse<linked_list_t>)->Range(1 << 8, 1 << 18);
+BENCHMARK(bench_traverse<unrolled_list_t>)->Range(1 << 8, 1 << 18);
+BENCHMARK(bench_traverse<xme::UnrolledList<std::int64_t, 32>>)->Range(1 << 8, 1 << 18);
+BENCHMARK(bench_for_each<unrolled_list_t>)->Range(1 << 8, 1 << 18);
+BENCHMARK(bench_for_each<xme::UnrolledList<std::int64_t, 32>>)->Range(1 << 8, 1 << 18);
+
+BENCHMARK(bench_push_front<linked_list_t>)->Range(1 << 8, 1 << 18);
+BENCHMARK(bench_push_front<unrolled_list_t>)->Range(1 << 8, 1 << 18);
+BENCHMARK_MAIN();
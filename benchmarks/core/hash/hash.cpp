@@ -0,0 +1,50 @@
+#include <xme/core/hash/crc32c.hpp>
+#include <xme/core/hash/hash.hpp>
+#include <benchmark/benchmark.h>
+#include <cstdint>
+#include <functional>
+#include <string>
+#include <string_view>
+
+auto make_record(std::int64_t size) -> std::string {
+    std::string record(size, '\0');
+    for(std::size_t i = 0; i < record.size(); ++i)
+        record[i] = static_cast<char>(i * 131);
+    return record;
+}
+
+void bench_crc32c(benchmark::State& state) {
+    const std::string record = make_record(state.range(0));
+    const auto bytes         = xme::as_bytes(xme::ArrayView(record));
+    for(auto&& _ : state)
+        benchmark::DoNotOptimize(xme::crc32c(bytes));
+    state.SetBytesProcessed(state.iterations() * record.size());
+}
+
+void bench_hash_bytes(benchmark::State& state) {
+    const std::string record = make_record(state.range(0));
+    const auto bytes         = xme::as_bytes(xme::ArrayView(record));
+    for(auto&& _ : state)
+        benchmark::DoNotOptimize(xme::hash_bytes(bytes));
+    state.SetBytesProcessed(state.iterations() * record.size());
+}
+
+void bench_std_hash(benchmark::State& state) {
+    const std::string record = make_record(state.range(0));
+    for(auto&& _ : state)
+        benchmark::DoNotOptimize(std::hash<std::string_view>{}(record));
+    state.SetBytesProcessed(state.iterations() * record.size());
+}
+
+void bench_hash_int(benchmark::State& state) {
+    std::uint64_t key = 0;
+    for(auto&& _ : state)
+        benchmark::DoNotOptimize(xme::Hash<std::uint64_t>{}(++key));
+}
+
+BENCHMARK(bench_crc32c)->Range(1 << 4, 1 << 18);
+BENCHMARK(bench_hash_bytes)->Range(1 << 4, 1 << 18);
+BENCHMARK(bench_std_hash)->Range(1 << 4, 1 << 18);
+BENCHMARK(bench_hash_int);
+
+BENCHMARK_MAIN();
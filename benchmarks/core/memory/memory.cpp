@@ -0,0 +1,108 @@
+#include <xme/container/array.hpp>
+#include <xme/container/linked_list.hpp>
+#include <xme/container/spsc_queue.hpp>
+#include <xme/core/memory/huge_page_allocator.hpp>
+#include <xme/core/memory/monotonic_arena.hpp>
+#include <xme/core/memory/pool_allocator.hpp>
+#include <xme/core/memory/slab_allocator.hpp>
+#include <xme/core/memory/tracking_allocator.hpp>
+#include <benchmark/benchmark.h>
+#include <cstdint>
+#include <memory>
+#include <thread>
+
+// Builds and drops a list of state.range(0) nodes, the allocation pattern of scratch data
+template<typename Alloc>
+void build_list(benchmark::State& state, const Alloc& alloc) {
+    xme::LinkedList<int, Alloc> list(alloc);
+    for(int i = 0; i < state.range(0); ++i)
+        list.push_front(i);
+    benchmark::DoNotOptimize(list.front());
+}
+
+void bench_list_std_allocator(benchmark::State& state) {
+    for(auto&& _ : state)
+        build_list(state, std::allocator<int>());
+    state.SetItemsProcessed(state.iterations() * state.range(0));
+}
+
+void bench_list_arena_allocator(benchmark::State& state) {
+    xme::MonotonicArena arena;
+    for(auto&& _ : state) {
+        build_list(state, xme::ArenaAllocator<int>(arena));
+        arena.reset();
+    }
+    state.SetItemsProcessed(state.iterations() * state.range(0));
+}
+
+template<template<typename> typename Alloc>
+void bench_list(benchmark::State& state) {
+    for(auto&& _ : state)
+        build_list(state, Alloc<int>());
+    state.SetItemsProcessed(state.iterations() * state.range(0));
+}
+
+template<typename T>
+using PoolAllocator = xme::PoolAllocator<T>;
+
+template<typename T>
+using TrackingSlabAllocator = xme::TrackingAllocator<xme::SlabAllocator<T>>;
+
+// A producer thread allocates nodes which the consumer frees after taking them from an SPSCQueue
+template<template<typename> typename Alloc>
+void bench_producer_consumer(benchmark::State& state) {
+    constexpr std::int64_t items = 1 << 16;
+    for(auto&& _ : state) {
+        xme::SPSCQueue<std::uint64_t*> queue(1024);
+        std::thread producer([&] {
+            Alloc<std::uint64_t> alloc;
+            for(std::int64_t i = 0; i < items; ++i) {
+                std::uint64_t* p = alloc.allocate(1);
+                *p               = i;
+                while(!queue.push(p))
+                    std::this_thread::yield();
+            }
+        });
+        Alloc<std::uint64_t> alloc;
+        for(std::int64_t i = 0; i < items; ++i) {
+            while(queue.read_available() == 0)
+                std::this_thread::yield();
+            queue.consume([&](std::uint64_t* p) {
+                benchmark::DoNotOptimize(*p);
+                alloc.deallocate(p, 1);
+            });
+        }
+        producer.join();
+    }
+    state.SetItemsProcessed(state.iterations() * items);
+}
+
+// Random reads in an array of state.range(0) MiB, dominated by TLB misses on 4 KiB pages
+template<template<typename> typename Alloc>
+void bench_random_reads(benchmark::State& state) {
+    xme::Array<std::uint64_t, Alloc<std::uint64_t>> array(std::size_t(state.range(0)) << 17, 0);
+    for(std::size_t i = 0; i < array.size(); ++i)
+        array[i] = i;
+    std::uint64_t index = 0;
+    std::uint64_t sum   = 0;
+    for(auto&& _ : state) {
+        for(int i = 0; i < 1024; ++i) {
+            index = (index * 6364136223846793005ull + 1442695040888963407ull);
+            sum += array[(index >> 20) & (array.size() - 1)];
+        }
+    }
+    benchmark::DoNotOptimize(sum);
+    state.SetItemsProcessed(state.iterations() * 1024);
+}
+
+BENCHMARK(bench_list_std_allocator)->Range(64, 64 << 10);
+BENCHMARK(bench_list_arena_allocator)->Range(64, 64 << 10);
+BENCHMARK(bench_list<PoolAllocator>)->Range(64, 64 << 10);
+BENCHMARK(bench_list<xme::SlabAllocator>)->Range(64, 64 << 10);
+BENCHMARK(bench_list<TrackingSlabAllocator>)->Range(64, 64 << 10);
+BENCHMARK(bench_random_reads<std::allocator>)->Arg(256);
+BENCHMARK(bench_random_reads<xme::HugePageAllocator>)->Arg(256);
+BENCHMARK(bench_producer_consumer<std::allocator>)->UseRealTime();
+BENCHMARK(bench_producer_consumer<xme::SlabAllocator>)->UseRealTime();
+
+BENCHMARK_MAIN();
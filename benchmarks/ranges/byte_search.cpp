@@ -0,0 +1,76 @@
+#include <xme/ranges/byte_search.hpp>
+#include <benchmark/benchmark.h>
+#include <algorithm>
+#include <cstring>
+#include <string>
+
+//! A frame of range(0) bytes whose only delimiter is the last byte.
+auto make_frame(std::int64_t size) -> std::string {
+    std::string frame(size, 'a');
+    frame.back() = '\n';
+    return frame;
+}
+
+void bench_find_byte(benchmark::State& state) {
+    const std::string frame = make_frame(state.range(0));
+    for(auto&& _ : state)
+        benchmark::DoNotOptimize(xme::ranges::find_byte(frame, '\n'));
+    state.SetBytesProcessed(state.iterations() * frame.size());
+}
+
+void bench_std_find(benchmark::State& state) {
+    const std::string frame = make_frame(state.range(0));
+    for(auto&& _ : state)
+        benchmark::DoNotOptimize(std::ranges::find(frame, '\n'));
+    state.SetBytesProcessed(state.iterations() * frame.size());
+}
+
+void bench_memchr(benchmark::State& state) {
+    const std::string frame = make_frame(state.range(0));
+    for(auto&& _ : state)
+        benchmark::DoNotOptimize(std::memchr(frame.data(), '\n', frame.size()));
+    state.SetBytesProcessed(state.iterations() * frame.size());
+}
+
+void bench_find_any_of(benchmark::State& state) {
+    const std::string frame = make_frame(state.range(0));
+    const std::string delimiters = "\r\n;";
+    for(auto&& _ : state)
+        benchmark::DoNotOptimize(xme::ranges::find_any_of(frame, delimiters));
+    state.SetBytesProcessed(state.iterations() * frame.size());
+}
+
+void bench_std_find_first_of(benchmark::State& state) {
+    const std::string frame = make_frame(state.range(0));
+    const std::string delimiters = "\r\n;";
+    for(auto&& _ : state)
+        benchmark::DoNotOptimize(std::ranges::find_first_of(frame, delimiters));
+    state.SetBytesProcessed(state.iterations() * frame.size());
+}
+
+void bench_mismatch(benchmark::State& state) {
+    const std::string lhs = make_frame(state.range(0));
+    const std::string rhs = make_frame(state.range(0));
+    for(auto&& _ : state)
+        benchmark::DoNotOptimize(xme::ranges::mismatch(lhs, rhs));
+    state.SetBytesProcessed(state.iterations() * lhs.size());
+}
+
+void bench_std_mismatch(benchmark::State& state) {
+    const std::string lhs = make_frame(state.range(0));
+    const std::string rhs = make_frame(state.range(0));
+    for(auto&& _ : state)
+        benchmark::DoNotOptimize(std::ranges::mismatch(lhs, rhs));
+    state.SetBytesProcessed(state.iterations() * lhs.size());
+}
+
+BENCHMARK(bench_find_byte)->Range(1 << 4, 1 << 16);
+BENCHMARK(bench_std_find)->Range(1 << 4, 1 << 16);
+BENCHMARK(bench_memchr)->Range(1 << 4, 1 << 16);
+
+BENCHMARK(bench_find_any_of)->Range(1 << 4, 1 << 16);
+BENCHMARK(bench_std_find_first_of)->Range(1 << 4, 1 << 16);
+
+BENCHMARK(bench_mismatch)->Range(1 << 4, 1 << 16);
+BENCHMARK(bench_std_mismatch)->Range(1 << 4, 1 << 16);
+BENCHMARK_MAIN();
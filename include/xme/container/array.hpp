@@ -1,9 +1,13 @@
 #pragma once
 #include "concepts.hpp"
+#include "container_policy.hpp"
 #include <algorithm>
 #include <cassert>
+#include <cstring>
+#include <functional>
 #include <memory>
 #include <xme/core/iterators/reverse_iterator.hpp>
+#include <xme/core/memory/allocate_at_least.hpp>
 #include <xme/setup.hpp>
 #include <xme/ranges/uninitialized.hpp>
 #include <xme/ranges/destroy.hpp>
@@ -12,11 +16,16 @@ namespace xme {
 //! Array is a contigous container with dynamic size.
 //! @param T the type of the stored element
 //! @param Alloc must be an allocator that satisfies the Allocator concept
-template<typename T, CAllocator Alloc = std::allocator<T>>
+//! @param Growth policy used to compute the capacity when the array runs out of storage
+template<typename T, CAllocator Alloc = std::allocator<T>, CGrowthPolicy Growth = DoublingGrowth>
 class Array {
 private:
     using alloc_traits = std::allocator_traits<Alloc>;
 
+    //! Relocation is done with memcpy when the allocator does not customize construction.
+    static constexpr bool trivially_relocatable =
+      std::is_trivially_copyable_v<T> && std::is_same_v<Alloc, std::allocator<T>>;
+
     template<bool Const>
     class Iterator;
 
@@ -27,6 +36,7 @@ public:
                   "xme::Array must have the same T as its allocator");
 
     using allocator_type         = Alloc;
+    using growth_policy          = Growth;
     using size_type              = std::size_t;
     using difference_type        = std::ptrdiff_t;
     using value_type             = T;
@@ -39,7 +49,7 @@ public:
     using reverse_iterator       = xme::ReverseIterator<iterator>;
     using const_reverse_iterator = xme::ReverseIterator<const_iterator>;
 
-    constexpr Array() noexcept = default;
+    constexpr Array() noexcept(std::is_nothrow_default_constructible_v<Alloc>) = default;
 
     constexpr Array(const Array& other) : Array(other.begin(), other.end(), other.m_allocator) {}
 
@@ -270,37 +280,64 @@ public:
         return p;
     }
 
-    //! Inserts [first, last) in a specified position..
+    //! Inserts [first, last) in a specified position.
+    //! The tail is shifted once, or relocated once into the new storage when growing.
     //! If the copy/move constructor throw, the state is unspecified.
     //! It is recommended to never throw on move construcor/assignment.
     //! @returns an iterator to the first inserted element.
     template<std::input_iterator Iter, std::sentinel_for<Iter> Sent>
     constexpr auto insert(const_iterator pos, Iter first, Sent last) -> iterator {
-        auto p             = const_cast<pointer>(pos.operator->());
-        size_type elements = std::ranges::distance(first, last);
-        if(size() + elements > capacity()) {
-            Array tmp(capacity() == 0 ? elements : capacity() + elements);
-            size_type elements_before = std::ranges::distance(begin(), pos);
-
-            // Must be constructed first, so if it throws we don't break the original
-            // array
-            for(std::size_t n = 0; first != last; ++first, ++n)
-                alloc_traits::construct(
-                  m_allocator, tmp.m_data.begin + elements_before + n, *first);
-
-            std::ranges::move(cbegin(), pos, tmp.begin());
-            std::ranges::move(pos, cend(), tmp.begin() + elements_before + elements);
-            tmp.m_data.end = tmp.m_data.begin + size() + elements;
-            std::ranges::swap(m_data, tmp.m_data);
-
+        auto p                          = const_cast<pointer>(pos.operator->());
+        const size_type elements_before = p - m_data.begin;
+        if constexpr(!std::forward_iterator<Iter>) {
+            // The elements can only be read once, so they are appended and rotated in place.
+            const size_type old_size = size();
+            for(; first != last; ++first)
+                emplace_back(*first);
+            std::rotate(m_data.begin + elements_before, m_data.begin + old_size, m_data.end);
             return begin() + elements_before;
         }
-
-        std::move_backward(pos, cend(), end() + elements);
-        m_data.end += elements;
-        for(std::size_t n = 0; first != last; ++first, ++n)
-            alloc_traits::construct(m_allocator, p + n, *first);
-        return p;
+        else {
+            const size_type elements = std::ranges::distance(first, last);
+            if(size() + elements > capacity()) {
+                auto [new_begin, new_size] =
+                  xme::allocate_at_least(m_allocator, next_capacity(size() + elements));
+                // Must be constructed first, so if it throws we don't break the original array
+                try {
+                    construct_range(first, last, new_begin + elements_before);
+                }
+                catch(...) {
+                    m_allocator.deallocate(new_begin, new_size);
+                    throw;
+                }
+                const size_type old_size = size();
+                relocate(m_data.begin, p, new_begin);
+                relocate(p, m_data.end, new_begin + elements_before + elements);
+                if(m_data.begin)
+                    m_allocator.deallocate(m_data.begin, capacity());
+                m_data.begin       = new_begin;
+                m_data.end         = new_begin + old_size + elements;
+                m_data.storage_end = new_begin + new_size;
+                return begin() + elements_before;
+            }
+
+            const size_type elements_after = m_data.end - p;
+            pointer old_end                = m_data.end;
+            if(elements_after > elements) {
+                uninitialized_move(old_end - elements, old_end, old_end);
+                std::move_backward(p, old_end - elements, old_end);
+                std::ranges::copy(first, last, p);
+            }
+            else {
+                // The end of the range goes after the old end, in uninitialized memory.
+                auto middle = std::ranges::next(first, elements_after);
+                uninitialized_move(p, old_end, p + elements);
+                construct_range(middle, last, old_end);
+                std::ranges::copy(first, middle, p);
+            }
+            m_data.end += elements;
+            return p;
+        }
     }
 
     //! Inserts [begin(range), end(range)) in a specified position..
@@ -322,9 +359,9 @@ public:
     //! Pushes [first, last) to the end of the array.
     template<std::input_iterator Iter, std::sentinel_for<Iter> Sent>
     constexpr void push_back(Iter first, Sent last) {
-        size_type new_capacity = size() + std::ranges::distance(first, last);
-        if(new_capacity > capacity()) {
-            grow_storage(new_capacity);
+        const size_type required = size() + std::ranges::distance(first, last);
+        if(required > capacity()) {
+            grow_storage(next_capacity(required));
         }
         for(; first != last; ++first) {
             alloc_traits::construct(m_allocator, m_data.end, *first);
@@ -350,7 +387,7 @@ public:
     template<typename... Args>
     constexpr auto emplace_back(Args&&... args) -> reference {
         if(m_data.end == m_data.storage_end)
-            grow_storage(size() + std::max(size(), size_type(1)));
+            grow_storage(next_capacity(size() + 1));
 
         alloc_traits::construct(m_allocator, m_data.end, std::forward<Args>(args)...);
         ++m_data.end;
@@ -361,9 +398,8 @@ public:
     //! @returns an iterator pointing to the element after it
     constexpr auto erase(const_iterator pos) -> iterator {
         auto p = const_cast<pointer>(pos.operator->());
-        ranges::destroy_at_a(p, m_allocator);
-        std::ranges::move(std::ranges::next(pos), cend(), p);
-        --m_data.end;
+        std::ranges::move(p + 1, m_data.end, p);
+        ranges::destroy_at_a(--m_data.end, m_allocator);
         return p;
     }
 
@@ -372,30 +408,109 @@ public:
     constexpr auto erase(const_iterator first, const_iterator last) -> iterator {
         auto p             = const_cast<pointer>(first.operator->());
         size_type elements = std::ranges::distance(first, last);
-        ranges::destroy_n_a(p, elements, m_allocator);
-        std::ranges::move(first + elements, cend(), p);
-        m_data.end -= elements;
+        auto new_end       = std::ranges::move(p + elements, m_data.end, p).out;
+        ranges::destroy_a(new_end, m_data.end, m_allocator);
+        m_data.end = new_end;
         return p;
     }
 
+    //! Erases the element in pos by moving the last element into it, O(1).
+    //! The order of the elements is not preserved.
+    //! @returns an iterator pointing to the element that replaced it
+    constexpr auto unordered_erase(const_iterator pos) -> iterator {
+        auto p = const_cast<pointer>(pos.operator->());
+        if(p != m_data.end - 1)
+            *p = std::move(*(m_data.end - 1));
+        pop_back();
+        return p;
+    }
+
+    //! Erases every element that satisfies pred in a single pass, keeping the order of the others.
+    //! @returns the amount of erased elements
+    template<std::predicate<const T&> Pred>
+    constexpr auto erase_if(Pred pred) -> size_type {
+        auto removed       = std::ranges::remove_if(m_data.begin, m_data.end, std::ref(pred));
+        const size_type n  = removed.size();
+        ranges::destroy_a(removed.begin(), m_data.end, m_allocator);
+        m_data.end = removed.begin();
+        return n;
+    }
+
+    //! Erases every element that satisfies pred in a single pass, the order is not preserved.
+    //! Each erased element is replaced by the last one, which moves fewer elements than erase_if.
+    //! @returns the amount of erased elements
+    template<std::predicate<const T&> Pred>
+    constexpr auto unordered_erase_if(Pred pred) -> size_type {
+        const size_type old_size = size();
+        for(pointer p = m_data.begin; p != m_data.end;) {
+            if(std::invoke(pred, std::as_const(*p)))
+                unordered_erase(p);
+            else
+                ++p;
+        }
+        return old_size - size();
+    }
+
 private:
+    //! @returns the capacity the growth policy wants to hold at least `required` elements.
+    [[nodiscard]]
+    constexpr auto next_capacity(size_type required) const noexcept -> size_type {
+        return Growth::next_capacity(capacity(), required, sizeof(T));
+    }
+
+    //! Move constructs [first, last) into the uninitialized storage at dest,
+    //! and destroys the moved from elements.
+    constexpr void relocate(pointer first, pointer last, pointer dest) {
+        if(trivially_relocatable && !std::is_constant_evaluated()) {
+            if(first != last)
+                std::memcpy(static_cast<void*>(dest), first, (last - first) * sizeof(T));
+            return;
+        }
+        for(; first != last; ++first, (void)++dest) {
+            alloc_traits::construct(m_allocator, dest, std::move(*first));
+            alloc_traits::destroy(m_allocator, first);
+        }
+    }
+
+    //! Copy constructs [first, last) into the uninitialized storage at dest.
+    //! If a constructor throws, the constructed elements are destroyed.
+    template<typename Iter, typename Sent>
+    constexpr void construct_range(Iter first, Sent last, pointer dest) {
+        pointer curr = dest;
+        try {
+            for(; first != last; ++first, (void)++curr)
+                alloc_traits::construct(m_allocator, curr, *first);
+        }
+        catch(...) {
+            ranges::destroy_a(dest, curr, m_allocator);
+            throw;
+        }
+    }
+
+    //! Move constructs [first, last) into the uninitialized storage at dest,
+    //! the moved from elements are kept alive.
+    constexpr void uninitialized_move(pointer first, pointer last, pointer dest) {
+        for(; first != last; ++first, (void)++dest)
+            alloc_traits::construct(m_allocator, dest, std::move(*first));
+    }
+
     constexpr void grow_storage(size_type n) {
-        const auto old_size = size();
-        pointer new_begin   = m_allocator.allocate(n);
+        const auto old_size        = size();
+        auto [new_begin, new_size] = xme::allocate_at_least(m_allocator, n);
 
-        std::ranges::move(*this, new_begin);
+        relocate(m_data.begin, m_data.end, new_begin);
         if(m_data.begin)
             m_allocator.deallocate(m_data.begin, capacity());
         m_data.begin       = new_begin;
         m_data.end         = new_begin + old_size;
-        m_data.storage_end = new_begin + n;
+        m_data.storage_end = new_begin + new_size;
     }
 
     constexpr void shrink_storage(size_type n) {
         size_type elements_to_move = std::min(size(), n);
         pointer new_begin          = m_allocator.allocate(n);
 
-        std::ranges::move(begin(), begin() + elements_to_move, new_begin);
+        relocate(m_data.begin, m_data.begin + elements_to_move, new_begin);
         ranges::destroy_a(m_data.begin + elements_to_move, m_data.end, m_allocator);
         m_allocator.deallocate(m_data.begin, capacity());
         m_data.begin       = new_begin;
@@ -406,14 +521,14 @@ private:
     template<typename... Args>
     constexpr auto realloc_insert(iterator pos, Args&&... args) -> iterator {
         const size_type elements_before = pos - begin();
-        const size_type new_size        = size() + std::max(size(), size_type(1));
         const size_type curr_size       = size();
-        pointer new_start               = m_allocator.allocate(new_size);
+        auto [new_start, new_size] =
+          xme::allocate_at_least(m_allocator, next_capacity(curr_size + 1));
         try {
             alloc_traits::construct(
               m_allocator, new_start + elements_before, std::forward<Args>(args)...);
-            std::ranges::move(begin(), pos, new_start);
-            std::ranges::move(pos, end(), new_start + elements_before + 1);
+            relocate(m_data.begin, m_data.begin + elements_before, new_start);
+            relocate(m_data.begin + elements_before, m_data.end, new_start + elements_before + 1);
         }
         catch(...) {
             ranges::destroy_at_a(new_start + elements_before, m_allocator);
@@ -452,14 +567,14 @@ private:
     Alloc m_allocator;
 };
 
-template<typename T, CAllocator Alloc>
+template<typename T, CAllocator Alloc, CGrowthPolicy Growth>
 template<bool Const>
-class Array<T, Alloc>::Iterator {
+class Array<T, Alloc, Growth>::Iterator {
 public:
     using difference_type   = std::ptrdiff_t;
     using value_type        = T;
-    using reference         = T&;
-    using pointer           = T*;
+    using reference         = std::conditional_t<Const, const T&, T&>;
+    using pointer           = std::conditional_t<Const, const T*, T*>;
     using iterator_category = std::random_access_iterator_tag;
     using iterator_concept  = std::contiguous_iterator_tag;
 
@@ -527,4 +642,11 @@ public:
 private:
     pointer m_cursor = nullptr;
 };
+
+//! Erases every element of array that satisfies pred, see Array::erase_if.
+//! @returns the amount of erased elements
+template<typename T, CAllocator Alloc, CGrowthPolicy Growth, std::predicate<const T&> Pred>
+constexpr auto erase_if(Array<T, Alloc, Growth>& array, Pred pred) -> std::size_t {
+    return array.erase_if(std::move(pred));
+}
 }  // namespace xme
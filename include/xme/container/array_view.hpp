@@ -332,10 +332,10 @@ ArrayView(R&&) -> ArrayView<std::remove_reference_t<std::ranges::range_reference
 //! Creates a readonly byte ArrayView of any ArrayView
 template<typename T, std::size_t Size>
 constexpr auto as_bytes(ArrayView<T, Size> view) noexcept
-  -> ArrayView<const std::byte, Size == -1 ? -1 : sizeof(T) * Size> {
+  -> ArrayView<const std::byte, Size == static_cast<std::size_t>(-1) ? Size : sizeof(T) * Size> {
     auto data                  = reinterpret_cast<const std::byte*>(view.data());
     auto byteSize              = view.size_bytes();
-    constexpr std::size_t size = Size == -1 ? -1 : sizeof(T) * Size;
+    constexpr std::size_t size = Size == static_cast<std::size_t>(-1) ? Size : sizeof(T) * Size;
     return ArrayView<const std::byte, size>(data, byteSize);
 }
 
@@ -343,10 +343,10 @@ constexpr auto as_bytes(ArrayView<T, Size> view) noexcept
 template<typename T, std::size_t Size>
     requires(!std::is_const_v<T>)
 constexpr auto as_writable_bytes(ArrayView<T, Size> view) noexcept
-  -> ArrayView<std::byte, Size == -1 ? -1 : sizeof(T) * Size> {
+  -> ArrayView<std::byte, Size == static_cast<std::size_t>(-1) ? Size : sizeof(T) * Size> {
     auto data                  = reinterpret_cast<std::byte*>(view.data());
     auto byteSize              = view.size_bytes();
-    constexpr std::size_t size = Size == -1 ? -1 : sizeof(T) * Size;
+    constexpr std::size_t size = Size == static_cast<std::size_t>(-1) ? Size : sizeof(T) * Size;
     return ArrayView<std::byte, size>(data, byteSize);
 }
 }  // namespace xme
@@ -0,0 +1,516 @@
+#pragma once
+#include "array_view.hpp"
+#include "strided_view.hpp"
+#include <array>
+#include <cassert>
+#include <concepts>
+#include <cstddef>
+#include <utility>
+
+namespace xme {
+//! Marks an extent that is only known at runtime.
+inline constexpr std::size_t dynamic_extent = static_cast<std::size_t>(-1);
+
+template<std::size_t... E>
+class Extents;
+}  // namespace xme
+
+namespace xme::detail {
+//! Extent of dimension Rank, a distinct type per dimension so that static extents
+//! are empty bases that don't take space.
+template<std::size_t Rank, std::size_t E>
+struct RankExtent : Extent<E> {
+    using Extent<E>::Extent;
+};
+
+template<typename Ranks, std::size_t... E>
+struct ExtentsStorage;
+
+template<std::size_t... Ranks, std::size_t... E>
+struct ExtentsStorage<std::index_sequence<Ranks...>, E...> : RankExtent<Ranks, E>... {
+    constexpr ExtentsStorage() noexcept = default;
+
+    constexpr ExtentsStorage(const std::array<std::size_t, sizeof...(E)>& sizes) noexcept :
+      RankExtent<Ranks, E>(sizes[Ranks])... {}
+
+    [[nodiscard]]
+    constexpr auto extent_at(std::size_t r) const noexcept -> std::size_t {
+        std::size_t result = 0;
+        ((r == Ranks ? (result = static_cast<const RankExtent<Ranks, E>&>(*this).size()) : 0), ...);
+        return result;
+    }
+};
+
+template<std::size_t... Ranks>
+auto make_dynamic_extents(std::index_sequence<Ranks...>)
+  -> Extents<(static_cast<void>(Ranks), xme::dynamic_extent)...>;
+}  // namespace xme::detail
+
+namespace xme {
+//! Extents holds the size of every dimension of a multidimensional view,
+//! each one is either known at compile time, taking no space, or dynamic_extent.
+//! @param E the extent of every dimension, from the first to the last
+template<std::size_t... E>
+class Extents : private detail::ExtentsStorage<std::make_index_sequence<sizeof...(E)>, E...> {
+private:
+    using storage = detail::ExtentsStorage<std::make_index_sequence<sizeof...(E)>, E...>;
+
+public:
+    static_assert(sizeof...(E) > 0, "xme::Extents must have at least one dimension");
+
+    using size_type = std::size_t;
+
+    //! Returns the amount of dimensions
+    [[nodiscard]]
+    static constexpr auto rank() noexcept -> size_type {
+        return sizeof...(E);
+    }
+
+    //! Returns the amount of dimensions whose extent is dynamic
+    [[nodiscard]]
+    static constexpr auto rank_dynamic() noexcept -> size_type {
+        return ((E == dynamic_extent) + ...);
+    }
+
+    //! Returns the extent of dimension r if it is static, dynamic_extent otherwise
+    [[nodiscard]]
+    static constexpr auto static_extent(size_type r) noexcept -> size_type {
+        constexpr size_type extents[]{E...};
+        return extents[r];
+    }
+
+    //! Every dynamic extent is 0
+    constexpr Extents() noexcept = default;
+
+    //! Constructs from the extent of every dimension, the static ones must match
+    constexpr Extents(const std::array<size_type, rank()>& sizes) noexcept : storage(sizes) {
+        for(size_type r = 0; r < rank(); ++r)
+            assert(static_extent(r) == dynamic_extent || static_extent(r) == sizes[r]);
+    }
+
+    //! Constructs from the extent of every dimension, or only of the dynamic ones in order
+    template<std::convertible_to<size_type>... Sizes>
+        requires(sizeof...(Sizes) > 0)
+                && (sizeof...(Sizes) == rank() || sizeof...(Sizes) == rank_dynamic())
+    explicit constexpr Extents(Sizes... sizes) noexcept :
+      Extents(expand(std::array<size_type, sizeof...(Sizes)>{static_cast<size_type>(sizes)...})) {}
+
+    //! Returns the extent of dimension r
+    [[nodiscard]]
+    constexpr auto extent(size_type r) const noexcept -> size_type {
+        assert(r < rank());
+        return storage::extent_at(r);
+    }
+
+    //! Returns the product of the extents
+    [[nodiscard]]
+    constexpr auto size() const noexcept -> size_type {
+        size_type result = 1;
+        for(size_type r = 0; r < rank(); ++r)
+            result *= extent(r);
+        return result;
+    }
+
+    constexpr bool operator==(const Extents& rhs) const noexcept {
+        for(size_type r = 0; r < rank(); ++r) {
+            if(extent(r) != rhs.extent(r))
+                return false;
+        }
+        return true;
+    }
+
+private:
+    template<size_type N>
+    static constexpr auto expand(const std::array<size_type, N>& sizes) noexcept
+      -> std::array<size_type, rank()> {
+        if constexpr(N == rank())
+            return sizes;
+        else {
+            std::array<size_type, rank()> result{};
+            size_type dynamic = 0;
+            for(size_type r = 0; r < rank(); ++r) {
+                const bool is_dynamic = static_extent(r) == dynamic_extent;
+                result[r]             = is_dynamic ? sizes[dynamic++] : static_extent(r);
+            }
+            return result;
+        }
+    }
+};
+
+//! Extents of Rank dimensions that are all dynamic
+template<std::size_t Rank>
+using DynamicExtents = decltype(detail::make_dynamic_extents(std::make_index_sequence<Rank>{}));
+
+//! Row major layout, the last index is contiguous, like C arrays and images
+struct LayoutRowMajor {
+    template<typename Ext>
+    class Mapping {
+    public:
+        using extents_type = Ext;
+        using size_type    = std::size_t;
+
+        static constexpr bool is_contiguous = true;
+
+        constexpr Mapping() noexcept = default;
+
+        constexpr Mapping(const Ext& extents) noexcept : m_extents(extents) {}
+
+        [[nodiscard]]
+        constexpr auto extents() const noexcept -> const Ext& {
+            return m_extents;
+        }
+
+        //! Returns the offset of the element at indices
+        [[nodiscard]]
+        constexpr auto operator()(const std::array<size_type, Ext::rank()>& indices) const noexcept
+          -> size_type {
+            size_type offset = 0;
+            for(size_type r = 0; r < Ext::rank(); ++r)
+                offset = offset * m_extents.extent(r) + indices[r];
+            return offset;
+        }
+
+        //! Returns the distance between two consecutive elements of dimension r
+        [[nodiscard]]
+        constexpr auto stride(size_type r) const noexcept -> size_type {
+            size_type result = 1;
+            for(size_type i = r + 1; i < Ext::rank(); ++i)
+                result *= m_extents.extent(i);
+            return result;
+        }
+
+        //! Returns the amount of elements between the first and the last one, plus one
+        [[nodiscard]]
+        constexpr auto required_span_size() const noexcept -> size_type {
+            return m_extents.size();
+        }
+
+    private:
+        [[no_unique_address]]
+        Ext m_extents;
+    };
+};
+
+//! Column major layout, the first index is contiguous, like Fortran and most BLAS matrices
+struct LayoutColumnMajor {
+    template<typename Ext>
+    class Mapping {
+    public:
+        using extents_type = Ext;
+        using size_type    = std::size_t;
+
+        static constexpr bool is_contiguous = true;
+
+        constexpr Mapping() noexcept = default;
+
+        constexpr Mapping(const Ext& extents) noexcept : m_extents(extents) {}
+
+        [[nodiscard]]
+        constexpr auto extents() const noexcept -> const Ext& {
+            return m_extents;
+        }
+
+        //! Returns the offset of the element at indices
+        [[nodiscard]]
+        constexpr auto operator()(const std::array<size_type, Ext::rank()>& indices) const noexcept
+          -> size_type {
+            size_type offset = 0;
+            for(size_type r = Ext::rank(); r > 0; --r)
+                offset = offset * m_extents.extent(r - 1) + indices[r - 1];
+            return offset;
+        }
+
+        //! Returns the distance between two consecutive elements of dimension r
+        [[nodiscard]]
+        constexpr auto stride(size_type r) const noexcept -> size_type {
+            size_type result = 1;
+            for(size_type i = 0; i < r; ++i)
+                result *= m_extents.extent(i);
+            return result;
+        }
+
+        //! Returns the amount of elements between the first and the last one, plus one
+        [[nodiscard]]
+        constexpr auto required_span_size() const noexcept -> size_type {
+            return m_extents.size();
+        }
+
+    private:
+        [[no_unique_address]]
+        Ext m_extents;
+    };
+};
+
+//! Layout with an arbitrary stride per dimension, the result of slicing the other layouts
+struct LayoutStrided {
+    template<typename Ext>
+    class Mapping {
+    public:
+        using extents_type = Ext;
+        using size_type    = std::size_t;
+
+        static constexpr bool is_contiguous = false;
+
+        constexpr Mapping() noexcept = default;
+
+        constexpr Mapping(const Ext& extents,
+                          const std::array<size_type, Ext::rank()>& strides) noexcept :
+          m_extents(extents),
+          m_strides(strides) {}
+
+        //! Converts the mapping of another layout with the same extents
+        template<typename Other>
+            requires(std::is_same_v<typename Other::extents_type, Ext>)
+        constexpr Mapping(const Other& other) noexcept : m_extents(other.extents()) {
+            for(size_type r = 0; r < Ext::rank(); ++r)
+                m_strides[r] = other.stride(r);
+        }
+
+        [[nodiscard]]
+        constexpr auto extents() const noexcept -> const Ext& {
+            return m_extents;
+        }
+
+        //! Returns the offset of the element at indices
+        [[nodiscard]]
+        constexpr auto operator()(const std::array<size_type, Ext::rank()>& indices) const noexcept
+          -> size_type {
+            size_type offset = 0;
+            for(size_type r = 0; r < Ext::rank(); ++r)
+                offset += indices[r] * m_strides[r];
+            return offset;
+        }
+
+        //! Returns the distance between two consecutive elements of dimension r
+        [[nodiscard]]
+        constexpr auto stride(size_type r) const noexcept -> size_type {
+            return m_strides[r];
+        }
+
+        //! Returns the amount of elements between the first and the last one, plus one
+        [[nodiscard]]
+        constexpr auto required_span_size() const noexcept -> size_type {
+            size_type last = 0;
+            for(size_type r = 0; r < Ext::rank(); ++r) {
+                if(m_extents.extent(r) == 0)
+                    return 0;
+                last += (m_extents.extent(r) - 1) * m_strides[r];
+            }
+            return last + 1;
+        }
+
+    private:
+        [[no_unique_address]]
+        Ext m_extents;
+        std::array<size_type, Ext::rank()> m_strides{};
+    };
+};
+
+//! ArrayViewND is a non owning multidimensional view of a buffer, like std::mdspan.
+//! An element is accessed with one index per dimension, and the Layout maps the indices
+//! to an offset in the buffer.
+//! subview and slice select a part of the view without copying, as a strided view.
+//! ArrayViewND is cheap to copy.
+//! @param T the type of element to view
+//! @param Ext the Extents of the view, which may be static or dynamic per dimension
+//! @param Layout LayoutRowMajor, LayoutColumnMajor or LayoutStrided
+template<typename T, typename Ext, typename Layout = LayoutRowMajor>
+class ArrayViewND {
+public:
+    using extents_type    = Ext;
+    using layout_type     = Layout;
+    using mapping_type    = typename Layout::template Mapping<Ext>;
+    using size_type       = std::size_t;
+    using difference_type = std::ptrdiff_t;
+    using value_type      = std::remove_cv_t<T>;
+    using element_type    = T;
+    using pointer         = T*;
+    using reference       = T&;
+
+    constexpr ArrayViewND() noexcept = default;
+
+    //! Creates an ArrayViewND of the buffer at data, with the extent of every dimension
+    //! or only of the dynamic ones.
+    template<std::convertible_to<size_type>... Sizes>
+        requires(sizeof...(Sizes) == Ext::rank() || sizeof...(Sizes) == Ext::rank_dynamic())
+                && std::is_constructible_v<mapping_type, const Ext&>
+    constexpr ArrayViewND(pointer data, Sizes... sizes) noexcept :
+      m_data(data),
+      m_mapping(make_extents(sizes...)) {}
+
+    //! Creates an ArrayViewND of the buffer at data, with extents
+    constexpr ArrayViewND(pointer data, const Ext& extents) noexcept
+        requires std::is_constructible_v<mapping_type, const Ext&>
+      : m_data(data),
+        m_mapping(extents) {}
+
+    //! Creates an ArrayViewND of the buffer at data, with a layout mapping
+    constexpr ArrayViewND(pointer data, const mapping_type& mapping) noexcept :
+      m_data(data),
+      m_mapping(mapping) {}
+
+    //! Converts a view with another layout or a less const element to this one
+    template<typename U, typename OtherLayout>
+        requires(std::is_convertible_v<U (*)[], T (*)[]>)
+                && std::is_constructible_v<mapping_type,
+                                           typename OtherLayout::template Mapping<Ext>>
+    constexpr ArrayViewND(const ArrayViewND<U, Ext, OtherLayout>& other) noexcept :
+      m_data(other.data()),
+      m_mapping(other.mapping()) {}
+
+    //! Creates an ArrayViewND over the elements of an ArrayView, which must be enough.
+    template<typename U, std::size_t S, std::convertible_to<size_type>... Sizes>
+        requires(std::is_convertible_v<U (*)[], T (*)[]>)
+    constexpr ArrayViewND(ArrayView<U, S> view, Sizes... sizes) noexcept :
+      ArrayViewND(view.data(), sizes...) {
+        assert(m_mapping.required_span_size() <= view.size());
+    }
+
+    //! Returns a reference to the element at indices, one per dimension
+    template<std::convertible_to<size_type>... Indices>
+        requires(sizeof...(Indices) == Ext::rank())
+    [[nodiscard]]
+    constexpr auto operator()(Indices... indices) const noexcept -> reference {
+        return (*this)[std::array<size_type, Ext::rank()>{static_cast<size_type>(indices)...}];
+    }
+
+    //! Returns a reference to the element at indices
+    [[nodiscard]]
+    constexpr auto operator[](const std::array<size_type, Ext::rank()>& indices) const noexcept
+      -> reference {
+        for(size_type r = 0; r < rank(); ++r)
+            assert(indices[r] < extent(r));
+        return m_data[m_mapping(indices)];
+    }
+
+    //! Returns a raw pointer to the first element of the view
+    [[nodiscard]]
+    constexpr auto data() const noexcept -> pointer {
+        return m_data;
+    }
+
+    [[nodiscard]]
+    constexpr auto mapping() const noexcept -> const mapping_type& {
+        return m_mapping;
+    }
+
+    [[nodiscard]]
+    constexpr auto extents() const noexcept -> const Ext& {
+        return m_mapping.extents();
+    }
+
+    //! Returns the amount of dimensions
+    [[nodiscard]]
+    static constexpr auto rank() noexcept -> size_type {
+        return Ext::rank();
+    }
+
+    //! Returns the extent of dimension r
+    [[nodiscard]]
+    constexpr auto extent(size_type r) const noexcept -> size_type {
+        return extents().extent(r);
+    }
+
+    //! Returns the distance in elements between two consecutive elements of dimension r
+    [[nodiscard]]
+    constexpr auto stride(size_type r) const noexcept -> size_type {
+        return m_mapping.stride(r);
+    }
+
+    //! Returns the amount of elements in the view
+    [[nodiscard]]
+    constexpr auto size() const noexcept -> size_type {
+        return extents().size();
+    }
+
+    //! Returns true if any dimension is empty
+    [[nodiscard]]
+    constexpr bool is_empty() const noexcept {
+        return size() == 0;
+    }
+
+    //! Creates a view of counts[r] elements from offsets[r] in every dimension r,
+    //! like a tile of an image.
+    [[nodiscard]]
+    constexpr auto subview(const std::array<size_type, Ext::rank()>& offsets,
+                           const std::array<size_type, Ext::rank()>& counts) const noexcept
+      -> ArrayViewND<T, DynamicExtents<Ext::rank()>, LayoutStrided> {
+        std::array<size_type, Ext::rank()> strides{};
+        bool empty = false;
+        for(size_type r = 0; r < rank(); ++r) {
+            assert(offsets[r] + counts[r] <= extent(r));
+            strides[r] = stride(r);
+            empty |= counts[r] == 0;
+        }
+        using mapping_t = LayoutStrided::Mapping<DynamicExtents<Ext::rank()>>;
+        pointer first   = empty ? m_data : m_data + m_mapping(offsets);
+        return {first, mapping_t(DynamicExtents<Ext::rank()>(counts), strides)};
+    }
+
+    //! Creates a view of the elements whose index in dimension Dim is index,
+    //! which has one dimension less, like a plane of a volume.
+    template<size_type Dim>
+        requires(Dim < Ext::rank() && Ext::rank() > 1)
+    [[nodiscard]]
+    constexpr auto slice(size_type index) const noexcept
+      -> ArrayViewND<T, DynamicExtents<Ext::rank() - 1>, LayoutStrided> {
+        assert(index < extent(Dim));
+        std::array<size_type, Ext::rank() - 1> extents{};
+        std::array<size_type, Ext::rank() - 1> strides{};
+        for(size_type r = 0, i = 0; r < rank(); ++r) {
+            if(r == Dim)
+                continue;
+            extents[i]   = extent(r);
+            strides[i++] = stride(r);
+        }
+        using mapping_t = LayoutStrided::Mapping<DynamicExtents<Ext::rank() - 1>>;
+        return {m_data + index * stride(Dim),
+                mapping_t(DynamicExtents<Ext::rank() - 1>(extents), strides)};
+    }
+
+    //! Creates a StridedView of row i of a 2D view
+    [[nodiscard]]
+    constexpr auto row(size_type i) const noexcept -> StridedView<T>
+        requires(Ext::rank() == 2)
+    {
+        assert(i < extent(0));
+        return {m_data + i * stride(0), extent(1), static_cast<difference_type>(stride(1))};
+    }
+
+    //! Creates a StridedView of column j of a 2D view
+    [[nodiscard]]
+    constexpr auto column(size_type j) const noexcept -> StridedView<T>
+        requires(Ext::rank() == 2)
+    {
+        assert(j < extent(1));
+        return {m_data + j * stride(1), extent(0), static_cast<difference_type>(stride(0))};
+    }
+
+    //! Creates an ArrayView of every element, in the order of the layout
+    [[nodiscard]]
+    constexpr auto as_array_view() const noexcept -> ArrayView<T>
+        requires(mapping_type::is_contiguous)
+    {
+        return ArrayView<T>(m_data, size());
+    }
+
+private:
+    template<typename... Sizes>
+    [[nodiscard]]
+    static constexpr auto make_extents(Sizes... sizes) noexcept -> Ext {
+        if constexpr(sizeof...(Sizes) == 0)
+            return Ext();
+        else
+            return Ext(static_cast<size_type>(sizes)...);
+    }
+
+    pointer m_data = nullptr;
+    [[no_unique_address]]
+    mapping_type m_mapping;
+};
+
+//! 2D view of a matrix or an image, with Rows and Columns extents.
+template<typename T, std::size_t Rows = dynamic_extent, std::size_t Columns = dynamic_extent,
+         typename Layout = LayoutRowMajor>
+using ArrayView2D = ArrayViewND<T, Extents<Rows, Columns>, Layout>;
+}  // namespace xme
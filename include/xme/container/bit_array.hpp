@@ -0,0 +1,378 @@
+#pragma once
+#include "array.hpp"
+#include "array_view.hpp"
+#include <bit>
+#include <cassert>
+#include <cstdint>
+
+#if defined(__BMI2__)
+#    include <immintrin.h>
+#endif
+
+namespace xme {
+namespace detail {
+//! @returns the position of the rank-th set bit of word, rank must be < popcount(word).
+constexpr auto select_in_word(std::uint64_t word, unsigned rank) noexcept -> unsigned {
+#if defined(__BMI2__)
+    if(!std::is_constant_evaluated())
+        return std::countr_zero(_pdep_u64(std::uint64_t(1) << rank, word));
+#endif
+    unsigned position = 0;
+    for(unsigned width = 32; width > 0; width /= 2) {
+        const auto low = unsigned(std::popcount(word & ((std::uint64_t(1) << width) - 1)));
+        if(rank >= low) {
+            rank -= low;
+            word >>= width;
+            position += width;
+        }
+    }
+    return position;
+}
+}  // namespace detail
+
+//! BitArray is a dynamic array of bits packed in 64 bit words.
+//! rank and select use an index of 512 bit superblocks (rank9), which costs 25% of extra memory
+//! and must be rebuilt with build_index after the bits are modified.
+//! Bits past size() in the last word are always 0.
+//! @param Alloc must be an allocator of std::uint64_t that satisfies the Allocator concept
+template<CAllocator Alloc = std::allocator<std::uint64_t>>
+class BitArray {
+private:
+    static constexpr std::size_t word_bits       = 64;
+    static constexpr std::size_t superblock_bits = 512;
+    static constexpr std::size_t words_per_block = superblock_bits / word_bits;
+    static constexpr std::size_t select_sample   = 512;
+
+public:
+    static_assert(std::is_same_v<std::uint64_t, typename Alloc::value_type>,
+                  "xme::BitArray must have an allocator of std::uint64_t");
+
+    using allocator_type = Alloc;
+    using word_type      = std::uint64_t;
+    using size_type      = std::size_t;
+    using value_type     = bool;
+
+    constexpr BitArray() noexcept = default;
+
+    explicit constexpr BitArray(const allocator_type& alloc) noexcept :
+      m_words(alloc), m_rank(alloc), m_select(alloc) {}
+
+    //! Creates a BitArray of n bits set to value.
+    explicit constexpr BitArray(size_type n, bool value = false,
+                                const allocator_type& alloc = allocator_type()) :
+      m_words(words_for(n), value ? ~word_type(0) : word_type(0), alloc), m_rank(alloc),
+      m_select(alloc), m_size(n) {
+        clear_tail();
+    }
+
+    [[nodiscard]]
+    constexpr auto size() const noexcept -> size_type {
+        return m_size;
+    }
+
+    [[nodiscard]]
+    constexpr bool empty() const noexcept {
+        return m_size == 0;
+    }
+
+    [[nodiscard]]
+    constexpr auto capacity() const noexcept -> size_type {
+        return m_words.capacity() * word_bits;
+    }
+
+    //! @returns the words that store the bits, the first bit is the lowest bit of the first word.
+    [[nodiscard]]
+    constexpr auto words() const noexcept -> ArrayView<const word_type> {
+        return {m_words.data(), m_words.size()};
+    }
+
+    [[nodiscard]]
+    constexpr bool operator[](size_type index) const noexcept {
+        return test(index);
+    }
+
+    [[nodiscard]]
+    constexpr bool test(size_type index) const noexcept {
+        assert(index < m_size);
+        return (m_words[index / word_bits] >> (index % word_bits)) & 1;
+    }
+
+    constexpr void set(size_type index, bool value = true) noexcept {
+        assert(index < m_size);
+        const word_type mask = word_type(1) << (index % word_bits);
+        word_type& word      = m_words[index / word_bits];
+        word                 = (word & ~mask) | (word_type(value) << (index % word_bits));
+        m_indexed            = false;
+    }
+
+    constexpr void reset(size_type index) noexcept { set(index, false); }
+
+    constexpr void flip(size_type index) noexcept {
+        assert(index < m_size);
+        m_words[index / word_bits] ^= word_type(1) << (index % word_bits);
+        m_indexed = false;
+    }
+
+    //! Sets every bit to 1.
+    constexpr void set() noexcept {
+        std::ranges::fill(m_words, ~word_type(0));
+        clear_tail();
+        m_indexed = false;
+    }
+
+    //! Sets every bit to 0.
+    constexpr void reset() noexcept {
+        std::ranges::fill(m_words, word_type(0));
+        m_indexed = false;
+    }
+
+    //! Flips every bit.
+    constexpr void flip() noexcept {
+        for(word_type& word : m_words)
+            word = ~word;
+        clear_tail();
+        m_indexed = false;
+    }
+
+    constexpr void push_back(bool value) {
+        if(m_size % word_bits == 0)
+            m_words.push_back(0);
+        m_words.back() |= word_type(value) << (m_size % word_bits);
+        ++m_size;
+        m_indexed = false;
+    }
+
+    //! Changes the amount of bits to n, new bits are set to value.
+    constexpr void resize(size_type n, bool value = false) {
+        const size_type old_size = m_size;
+        if(n > m_size && value && m_size % word_bits != 0)
+            m_words.back() |= ~word_type(0) << (m_size % word_bits);
+        while(m_words.size() < words_for(n))
+            m_words.push_back(value ? ~word_type(0) : word_type(0));
+        while(m_words.size() > words_for(n))
+            m_words.pop_back();
+        m_size = n;
+        clear_tail();
+        m_indexed = m_indexed && old_size == n;
+    }
+
+    constexpr void reserve(size_type n) { m_words.reserve(words_for(n)); }
+
+    constexpr void clear() noexcept {
+        m_words.clear();
+        m_size    = 0;
+        m_indexed = false;
+    }
+
+    //! @returns the amount of bits set to 1.
+    [[nodiscard]]
+    constexpr auto count() const noexcept -> size_type {
+        size_type ones = 0;
+        for(word_type word : m_words)
+            ones += std::popcount(word);
+        return ones;
+    }
+
+    [[nodiscard]]
+    constexpr bool all() const noexcept {
+        return count() == m_size;
+    }
+
+    [[nodiscard]]
+    constexpr bool any() const noexcept {
+        return std::ranges::any_of(m_words, [](word_type word) { return word != 0; });
+    }
+
+    [[nodiscard]]
+    constexpr bool none() const noexcept {
+        return !any();
+    }
+
+    //! @returns the index of the first bit set to 1, or size() if there is none.
+    [[nodiscard]]
+    constexpr auto find_first() const noexcept -> size_type {
+        return find_from_word(0);
+    }
+
+    //! @returns the index of the first bit set to 1 after index, or size() if there is none.
+    [[nodiscard]]
+    constexpr auto find_next(size_type index) const noexcept -> size_type {
+        ++index;
+        if(index >= m_size)
+            return m_size;
+        const size_type word_index = index / word_bits;
+        const word_type word       = m_words[word_index] >> (index % word_bits);
+        if(word != 0)
+            return index + std::countr_zero(word);
+        return find_from_word(word_index + 1);
+    }
+
+    constexpr auto operator&=(const BitArray& other) noexcept -> BitArray& {
+        assert(m_size == other.m_size);
+        for(size_type i = 0; i < m_words.size(); ++i)
+            m_words[i] &= other.m_words[i];
+        m_indexed = false;
+        return *this;
+    }
+
+    constexpr auto operator|=(const BitArray& other) noexcept -> BitArray& {
+        assert(m_size == other.m_size);
+        for(size_type i = 0; i < m_words.size(); ++i)
+            m_words[i] |= other.m_words[i];
+        m_indexed = false;
+        return *this;
+    }
+
+    constexpr auto operator^=(const BitArray& other) noexcept -> BitArray& {
+        assert(m_size == other.m_size);
+        for(size_type i = 0; i < m_words.size(); ++i)
+            m_words[i] ^= other.m_words[i];
+        m_indexed = false;
+        return *this;
+    }
+
+    [[nodiscard]]
+    friend constexpr auto operator&(BitArray lhs, const BitArray& rhs) -> BitArray {
+        return lhs &= rhs;
+    }
+
+    [[nodiscard]]
+    friend constexpr auto operator|(BitArray lhs, const BitArray& rhs) -> BitArray {
+        return lhs |= rhs;
+    }
+
+    [[nodiscard]]
+    friend constexpr auto operator^(BitArray lhs, const BitArray& rhs) -> BitArray {
+        return lhs ^= rhs;
+    }
+
+    [[nodiscard]]
+    constexpr auto operator~() const -> BitArray {
+        BitArray result{*this};
+        result.flip();
+        return result;
+    }
+
+    [[nodiscard]]
+    friend constexpr bool operator==(const BitArray& lhs, const BitArray& rhs) noexcept {
+        return lhs.m_size == rhs.m_size && std::ranges::equal(lhs.m_words, rhs.m_words);
+    }
+
+    //! Builds the index used by rank and select, O(N).
+    constexpr void build_index() {
+        const size_type blocks = (m_words.size() + words_per_block - 1) / words_per_block;
+        m_rank.clear();
+        m_select.clear();
+        m_rank.reserve(2 * blocks + 1);
+
+        size_type ones = 0;
+        for(size_type block = 0; block < blocks; ++block) {
+            m_rank.push_back(ones);
+            word_type relative = 0;
+            size_type in_block = 0;
+            for(size_type j = 0; j < words_per_block; ++j) {
+                const size_type w = block * words_per_block + j;
+                if(j > 0)
+                    relative |= word_type(in_block) << ((j - 1) * 9);
+                if(w < m_words.size())
+                    in_block += std::popcount(m_words[w]);
+            }
+            m_rank.push_back(relative);
+
+            // Samples the superblock that holds every select_sample-th set bit.
+            for(size_type k = (ones + select_sample - 1) / select_sample * select_sample;
+                k < ones + in_block; k += select_sample)
+                m_select.push_back(block);
+            ones += in_block;
+        }
+        m_rank.push_back(ones);
+        m_indexed = true;
+    }
+
+    //! @returns true if the index is up to date with the bits.
+    [[nodiscard]]
+    constexpr bool indexed() const noexcept {
+        return m_indexed;
+    }
+
+    //! @returns the amount of bits set to 1 in [0, index), O(1).
+    //! The index must be up to date.
+    [[nodiscard]]
+    constexpr auto rank(size_type index) const noexcept -> size_type {
+        assert(m_indexed && index <= m_size);
+        if(index == m_size)
+            return m_rank.back();
+        const size_type word  = index / word_bits;
+        const size_type block = word / words_per_block;
+        const size_type j     = word % words_per_block;
+
+        size_type ones = m_rank[2 * block];
+        if(j > 0)
+            ones += (m_rank[2 * block + 1] >> ((j - 1) * 9)) & 0x1FF;
+        const word_type mask = (word_type(1) << (index % word_bits)) - 1;
+        return ones + std::popcount(m_words[word] & mask);
+    }
+
+    //! @returns the index of the bit set to 1 with rank k, or size() if k >= count(), O(log N).
+    //! The index must be up to date.
+    [[nodiscard]]
+    constexpr auto select(size_type k) const noexcept -> size_type {
+        assert(m_indexed);
+        if(k >= m_rank.back())
+            return m_size;
+
+        // The bit is in the last superblock with at most k ones before it, between the
+        // superblocks of the samples around k, found in O(log N) even when they are far apart.
+        const size_type sample = k / select_sample;
+        size_type block        = m_select[sample];
+        size_type last         = sample + 1 < m_select.size() ? m_select[sample + 1]
+                                                              : m_rank.size() / 2 - 1;
+        while(block < last) {
+            const size_type middle = block + (last - block + 1) / 2;
+            if(m_rank[2 * middle] <= k)
+                block = middle;
+            else
+                last = middle - 1;
+        }
+        k -= m_rank[2 * block];
+
+        size_type j              = 0;
+        const word_type relative = m_rank[2 * block + 1];
+        while(j + 1 < words_per_block && ((relative >> (j * 9)) & 0x1FF) <= k)
+            ++j;
+        if(j > 0)
+            k -= (relative >> ((j - 1) * 9)) & 0x1FF;
+        const size_type word = block * words_per_block + j;
+        return word * word_bits + detail::select_in_word(m_words[word], unsigned(k));
+    }
+
+private:
+    [[nodiscard]]
+    static constexpr auto words_for(size_type bits) noexcept -> size_type {
+        return (bits + word_bits - 1) / word_bits;
+    }
+
+    constexpr void clear_tail() noexcept {
+        if(m_size % word_bits != 0)
+            m_words.back() &= (word_type(1) << (m_size % word_bits)) - 1;
+    }
+
+    [[nodiscard]]
+    constexpr auto find_from_word(size_type word_index) const noexcept -> size_type {
+        for(; word_index < m_words.size(); ++word_index) {
+            if(m_words[word_index] != 0)
+                return word_index * word_bits + std::countr_zero(m_words[word_index]);
+        }
+        return m_size;
+    }
+
+    Array<word_type, Alloc> m_words;
+    //! Two words per superblock, the amount of ones before it and the amount of ones
+    //! before each of its words packed in 9 bit fields, followed by the total amount of ones.
+    Array<word_type, Alloc> m_rank;
+    //! The superblock of every select_sample-th bit set to 1.
+    Array<word_type, Alloc> m_select;
+    size_type m_size = 0;
+    bool m_indexed   = false;
+};
+}  // namespace xme
@@ -0,0 +1,269 @@
+#pragma once
+#include "concepts.hpp"
+#include <atomic>
+#include <bit>
+#include <cassert>
+#include <memory>
+#include <new>
+
+namespace xme {
+namespace detail {
+template<typename T>
+struct ConcurrentArraySlot {
+    alignas(T) unsigned char storage[sizeof(T)];
+    std::atomic<bool> published = false;
+};
+}  // namespace detail
+
+//! ConcurrentArray is an append only array that many threads may push_back to,
+//! while other threads read it.
+//! A slot is reserved with an atomic increment and the element is published
+//! with a per slot flag, so no lock is taken.
+//! The elements live in buckets of exponentially increasing size, which are never relocated,
+//! so pointers and references are stable.
+//! Iteration only sees published elements, which may not be contiguous while
+//! writers are in progress.
+//! @param T the type of the stored element
+//! @param FirstBucketSize amount of elements in the first bucket, must be a power of 2
+//! @param Alloc must be an allocator that satisfies the Allocator concept
+template<typename T, std::size_t FirstBucketSize = 64, CAllocator Alloc = std::allocator<T>>
+class ConcurrentArray {
+private:
+    using slot        = detail::ConcurrentArraySlot<T>;
+    using slot_alloc  = typename std::allocator_traits<Alloc>::template rebind_alloc<slot>;
+    using slot_traits = std::allocator_traits<slot_alloc>;
+
+    static constexpr std::size_t first_bucket_shift = std::countr_zero(FirstBucketSize);
+    static constexpr std::size_t bucket_count       = 64 - first_bucket_shift;
+
+    class Iterator;
+
+public:
+    static_assert(std::has_single_bit(FirstBucketSize), "FirstBucketSize must be a power of 2");
+    static_assert(std::is_same_v<T, std::remove_cv_t<T>>,
+                  "xme::ConcurrentArray must have a non-const and non-volatile T");
+    static_assert(std::is_same_v<T, typename Alloc::value_type>,
+                  "xme::ConcurrentArray must have the same T as its allocator");
+
+    using allocator_type  = Alloc;
+    using size_type       = std::size_t;
+    using difference_type = std::ptrdiff_t;
+    using value_type      = T;
+    using reference       = T&;
+    using const_reference = const T&;
+    using iterator        = Iterator;
+    using const_iterator  = Iterator;
+
+    ConcurrentArray() noexcept(std::is_nothrow_default_constructible_v<slot_alloc>) = default;
+
+    explicit ConcurrentArray(const allocator_type& alloc) noexcept : m_allocator(alloc) {}
+
+    ConcurrentArray(const ConcurrentArray&) = delete;
+
+    auto operator=(const ConcurrentArray&) -> ConcurrentArray& = delete;
+
+    ~ConcurrentArray() { release_storage(); }
+
+    //! Thread safe.
+    //! @returns the index of the pushed element
+    auto push_back(const T& value) -> size_type { return emplace_back(value); }
+
+    //! Thread safe.
+    //! @returns the index of the pushed element
+    auto push_back(T&& value) -> size_type { return emplace_back(std::move(value)); }
+
+    //! Constructs an element in the end, thread safe.
+    //! If the constructor throws, the slot is reserved but is never published.
+    //! @returns the index of the constructed element
+    template<typename... Args>
+    auto emplace_back(Args&&... args) -> size_type {
+        const size_type index = m_size.fetch_add(1, std::memory_order_relaxed);
+        slot& s               = slot_at(index);
+        ::new(static_cast<void*>(s.storage)) T(std::forward<Args>(args)...);
+        s.published.store(true, std::memory_order_release);
+        return index;
+    }
+
+    //! Allocates the buckets to hold at least n elements, thread safe.
+    void reserve(size_type n) {
+        if(n == 0)
+            return;
+        const size_type last = bucket_of(n - 1);
+        for(size_type bucket = 0; bucket <= last; ++bucket)
+            bucket_at(bucket, true);
+    }
+
+    //! @returns true if the element at index is constructed and visible to this thread.
+    [[nodiscard]]
+    bool is_published(size_type index) const noexcept {
+        if(index >= size())
+            return false;
+        const slot* s = find_slot(index);
+        return s && s->published.load(std::memory_order_acquire);
+    }
+
+    //! The element must be published.
+    [[nodiscard]]
+    auto operator[](size_type index) noexcept -> reference {
+        assert(is_published(index));
+        return *std::launder(reinterpret_cast<T*>(find_slot(index)->storage));
+    }
+
+    //! The element must be published.
+    [[nodiscard]]
+    auto operator[](size_type index) const noexcept -> const_reference {
+        assert(is_published(index));
+        return *std::launder(reinterpret_cast<const T*>(find_slot(index)->storage));
+    }
+
+    //! @returns an iterator to the first published element.
+    [[nodiscard]]
+    auto begin() const noexcept -> const_iterator {
+        return {this, 0, size()};
+    }
+
+    [[nodiscard]]
+    auto end() const noexcept -> const_iterator {
+        return {};
+    }
+
+    //! @returns the amount of reserved slots, which includes elements that are not published yet.
+    [[nodiscard]]
+    auto size() const noexcept -> size_type {
+        return m_size.load(std::memory_order_acquire);
+    }
+
+    [[nodiscard]]
+    bool empty() const noexcept {
+        return size() == 0;
+    }
+
+    //! Not thread safe.
+    void clear() noexcept {
+        release_storage();
+        m_size.store(0, std::memory_order_relaxed);
+    }
+
+private:
+    //! Bucket k holds [FirstBucketSize * (2^k - 1), FirstBucketSize * (2^(k+1) - 1)).
+    [[nodiscard]]
+    static constexpr auto bucket_of(size_type index) noexcept -> size_type {
+        return std::bit_width(index + FirstBucketSize) - 1 - first_bucket_shift;
+    }
+
+    [[nodiscard]]
+    static constexpr auto bucket_size(size_type bucket) noexcept -> size_type {
+        return FirstBucketSize << bucket;
+    }
+
+    [[nodiscard]]
+    static constexpr auto offset_in_bucket(size_type index, size_type bucket) noexcept
+      -> size_type {
+        return index + FirstBucketSize - bucket_size(bucket);
+    }
+
+    //! Allocates the bucket if it does not exist and allocate is true.
+    //! The thread that loses the race to publish the bucket frees its own.
+    auto bucket_at(size_type bucket, bool allocate) -> slot* {
+        slot* slots = m_buckets[bucket].load(std::memory_order_acquire);
+        if(slots || !allocate)
+            return slots;
+
+        slot* fresh = slot_traits::allocate(m_allocator, bucket_size(bucket));
+        for(size_type i = 0; i < bucket_size(bucket); ++i)
+            slot_traits::construct(m_allocator, fresh + i);
+        if(m_buckets[bucket].compare_exchange_strong(slots, fresh, std::memory_order_acq_rel,
+                                                     std::memory_order_acquire))
+            return fresh;
+        slot_traits::deallocate(m_allocator, fresh, bucket_size(bucket));
+        return slots;
+    }
+
+    auto slot_at(size_type index) -> slot& {
+        const size_type bucket = bucket_of(index);
+        return bucket_at(bucket, true)[offset_in_bucket(index, bucket)];
+    }
+
+    auto find_slot(size_type index) const noexcept -> slot* {
+        const size_type bucket = bucket_of(index);
+        slot* slots            = m_buckets[bucket].load(std::memory_order_acquire);
+        return slots ? slots + offset_in_bucket(index, bucket) : nullptr;
+    }
+
+    void release_storage() noexcept {
+        for(size_type bucket = 0; bucket < bucket_count; ++bucket) {
+            slot* slots = m_buckets[bucket].exchange(nullptr, std::memory_order_relaxed);
+            if(slots == nullptr)
+                continue;
+            for(size_type i = 0; i < bucket_size(bucket); ++i) {
+                if constexpr(!std::is_trivially_destructible_v<T>)
+                    if(slots[i].published.load(std::memory_order_relaxed))
+                        std::destroy_at(std::launder(reinterpret_cast<T*>(slots[i].storage)));
+            }
+            slot_traits::deallocate(m_allocator, slots, bucket_size(bucket));
+        }
+    }
+
+    std::atomic<slot*> m_buckets[bucket_count]{};
+    alignas(64) std::atomic<size_type> m_size = 0;
+    [[no_unique_address]]
+    slot_alloc m_allocator;
+};
+
+//! Forward iterator that skips the slots that are not published.
+template<typename T, std::size_t FirstBucketSize, CAllocator Alloc>
+class ConcurrentArray<T, FirstBucketSize, Alloc>::Iterator {
+public:
+    using difference_type   = std::ptrdiff_t;
+    using value_type        = T;
+    using reference         = const T&;
+    using pointer           = const T*;
+    using iterator_category = std::forward_iterator_tag;
+
+    Iterator() noexcept = default;
+
+    Iterator(const ConcurrentArray* array, size_type index, size_type last) noexcept :
+      m_array(array), m_index(index), m_last(last) {
+        skip_unpublished();
+    }
+
+    auto operator*() const noexcept -> reference { return (*m_array)[m_index]; }
+
+    auto operator->() const noexcept -> pointer { return std::addressof(**this); }
+
+    auto operator++() noexcept -> Iterator& {
+        ++m_index;
+        skip_unpublished();
+        return *this;
+    }
+
+    auto operator++(int) noexcept -> Iterator {
+        Iterator tmp{*this};
+        ++*this;
+        return tmp;
+    }
+
+    //! Every iterator that reached the end compares equal to the default constructed one.
+    bool operator==(const Iterator& rhs) const noexcept {
+        return m_array == rhs.m_array && m_index == rhs.m_index;
+    }
+
+    //! @returns the index of the current element.
+    [[nodiscard]]
+    auto index() const noexcept -> size_type {
+        return m_index;
+    }
+
+private:
+    void skip_unpublished() noexcept {
+        while(m_index < m_last && !m_array->is_published(m_index))
+            ++m_index;
+        if(m_index >= m_last)
+            *this = {};
+    }
+
+    const ConcurrentArray* m_array = nullptr;
+    size_type m_index              = 0;
+    size_type m_last               = 0;
+};
+}  // namespace xme
@@ -0,0 +1,447 @@
+#pragma once
+#include "../../../private/container/epoch.hpp"
+#include "pair.hpp"
+#include <atomic>
+#include <bit>
+#include <cstdint>
+#include <functional>
+#include <iterator>
+#include <new>
+#include <optional>
+
+namespace xme {
+namespace detail {
+//! A skip list node, followed in the same allocation by its tower of next pointers.
+//! The lowest bit of a next pointer marks the node as deleted at that level.
+template<typename K, typename V>
+struct SkipListNode {
+    using link = std::atomic<std::uintptr_t>;
+
+    template<typename... Args>
+    SkipListNode(std::uint32_t height, const K& k, Args&&... args) :
+      key(k), value(std::forward<Args>(args)...), levels(height) {}
+
+    [[nodiscard]]
+    static constexpr auto tower_offset() noexcept -> std::size_t {
+        return (sizeof(SkipListNode) + alignof(link) - 1) / alignof(link) * alignof(link);
+    }
+
+    [[nodiscard]]
+    static constexpr auto bytes(std::uint32_t height) noexcept -> std::size_t {
+        return tower_offset() + height * sizeof(link);
+    }
+
+    [[nodiscard]]
+    auto tower() noexcept -> link* {
+        return std::launder(
+          reinterpret_cast<link*>(reinterpret_cast<std::byte*>(this) + tower_offset()));
+    }
+
+    K key;
+    V value;
+    std::uint32_t levels;
+    //! The inserting and the erasing threads, the last one to finish retires the node.
+    std::atomic<std::uint32_t> owners = 2;
+};
+}  // namespace detail
+
+//! ConcurrentSkipListMap is an ordered map that many threads may insert to, erase from,
+//! search and iterate at the same time without taking a lock.
+//! erase marks the node as deleted, then unlinks it from every level.
+//! Unlinked nodes are retired to an epoch based reclamation domain, and freed once no thread
+//! can still be reading them, so readers never touch freed memory.
+//! Values are immutable once inserted, find returns a copy.
+//! Iterators keep their thread in a critical section, so they must not be passed to
+//! another thread and should not be kept for long, as they delay reclamation.
+//! Iteration sees the keys in order, skipping erased ones, and may or may not see the
+//! keys inserted or erased while it is in progress.
+//! @param K the type of the keys
+//! @param V the type of the values
+//! @param Compare strict weak ordering of the keys
+template<typename K, typename V, typename Compare = std::less<K>>
+class ConcurrentSkipListMap {
+private:
+    using node = detail::SkipListNode<K, V>;
+    using link = typename node::link;
+
+    static constexpr std::uint32_t max_levels = 32;
+
+    class Iterator;
+
+public:
+    using key_type        = K;
+    using mapped_type     = V;
+    using key_compare     = Compare;
+    using size_type       = std::size_t;
+    using difference_type = std::ptrdiff_t;
+    using iterator        = Iterator;
+    using const_iterator  = Iterator;
+
+    ConcurrentSkipListMap() noexcept = default;
+
+    explicit ConcurrentSkipListMap(const Compare& compare) noexcept : m_compare(compare) {}
+
+    ConcurrentSkipListMap(const ConcurrentSkipListMap&) = delete;
+
+    auto operator=(const ConcurrentSkipListMap&) -> ConcurrentSkipListMap& = delete;
+
+    //! Frees every node, not thread safe.
+    ~ConcurrentSkipListMap() {
+        node* curr = to_node(m_head[0].load(std::memory_order_acquire));
+        while(curr) {
+            node* next = to_node(curr->tower()[0].load(std::memory_order_relaxed));
+            destroy_node(curr);
+            curr = next;
+        }
+    }
+
+    //! Inserts key with value, thread safe.
+    //! @returns false if the key was already in the map
+    bool insert(const K& key, const V& value) { return try_emplace(key, value); }
+
+    //! Constructs the value from args if key is not in the map, thread safe.
+    //! @returns false if the key was already in the map
+    template<typename... Args>
+    bool try_emplace(const K& key, Args&&... args) {
+        detail::EpochGuard guard;
+        node* preds[max_levels];
+        node* succs[max_levels];
+        if(find_position(key, preds, succs))
+            return false;
+
+        node* created = create_node(random_height(), key, std::forward<Args>(args)...);
+        link* tower   = created->tower();
+        for(;;) {
+            for(std::uint32_t level = 0; level < created->levels; ++level)
+                tower[level].store(to_link(succs[level]), std::memory_order_relaxed);
+            std::uintptr_t expected = to_link(succs[0]);
+            if(next_link(preds[0], 0).compare_exchange_strong(expected, to_link(created),
+                                                              std::memory_order_release,
+                                                              std::memory_order_relaxed))
+                break;
+            if(find_position(key, preds, succs)) {
+                // Never published, so it can be freed right away.
+                destroy_node(created);
+                return false;
+            }
+        }
+        m_size.fetch_add(1, std::memory_order_relaxed);
+
+        link_upper_levels(created, preds, succs);
+        // Pairs with the fence in unlink, either this sees the mark or the eraser sees
+        // the levels linked above.
+        std::atomic_thread_fence(std::memory_order_seq_cst);
+        if(is_marked(tower[0].load(std::memory_order_relaxed)))
+            unlink(created);
+        release(created);
+        return true;
+    }
+
+    //! Erases key, thread safe.
+    //! @returns false if the key was not in the map
+    bool erase(const K& key) {
+        detail::EpochGuard guard;
+        node* preds[max_levels];
+        node* succs[max_levels];
+        if(!find_position(key, preds, succs))
+            return false;
+
+        node* victim = succs[0];
+        link* tower  = victim->tower();
+        for(std::uint32_t level = victim->levels - 1; level > 0; --level) {
+            std::uintptr_t next = tower[level].load(std::memory_order_relaxed);
+            while(!is_marked(next)
+                  && !tower[level].compare_exchange_weak(next, next | 1, std::memory_order_acq_rel,
+                                                         std::memory_order_relaxed)) {}
+        }
+        std::uintptr_t next = tower[0].load(std::memory_order_relaxed);
+        for(;;) {
+            // Whoever marks the bottom level owns the erasure.
+            if(is_marked(next))
+                return false;
+            if(tower[0].compare_exchange_weak(next, next | 1, std::memory_order_acq_rel,
+                                              std::memory_order_relaxed))
+                break;
+        }
+        m_size.fetch_sub(1, std::memory_order_relaxed);
+        unlink(victim);
+        release(victim);
+        return true;
+    }
+
+    //! Thread safe.
+    //! @returns a copy of the value of key, or std::nullopt if it is not in the map
+    [[nodiscard]]
+    auto find(const K& key) const -> std::optional<V> {
+        detail::EpochGuard guard;
+        node* found = find_node(key);
+        if(found && !m_compare(key, found->key))
+            return found->value;
+        return std::nullopt;
+    }
+
+    //! Thread safe.
+    [[nodiscard]]
+    bool contains(const K& key) const {
+        detail::EpochGuard guard;
+        node* found = find_node(key);
+        return found && !m_compare(key, found->key);
+    }
+
+    //! @returns an iterator to the first key that is not less than key, thread safe.
+    [[nodiscard]]
+    auto lower_bound(const K& key) const -> iterator {
+        iterator it;
+        it.m_node = find_node(key);
+        return it;
+    }
+
+    //! @returns an iterator to the smallest key, thread safe.
+    [[nodiscard]]
+    auto begin() const -> iterator {
+        iterator it;
+        it.m_node = first_live(to_node(m_head[0].load(std::memory_order_acquire)));
+        return it;
+    }
+
+    [[nodiscard]]
+    auto end() const -> iterator {
+        return {};
+    }
+
+    //! @returns the amount of keys, which may be outdated by the time it is used.
+    [[nodiscard]]
+    auto size() const noexcept -> size_type {
+        return m_size.load(std::memory_order_relaxed);
+    }
+
+    [[nodiscard]]
+    bool empty() const noexcept {
+        return size() == 0;
+    }
+
+private:
+    [[nodiscard]]
+    static auto to_node(std::uintptr_t link_value) noexcept -> node* {
+        return reinterpret_cast<node*>(link_value & ~std::uintptr_t(1));
+    }
+
+    [[nodiscard]]
+    static auto to_link(node* n) noexcept -> std::uintptr_t {
+        return reinterpret_cast<std::uintptr_t>(n);
+    }
+
+    [[nodiscard]]
+    static bool is_marked(std::uintptr_t link_value) noexcept {
+        return link_value & 1;
+    }
+
+    //! @returns the next pointer at level of n, or of the head if n is nullptr.
+    [[nodiscard]]
+    auto next_link(node* n, std::uint32_t level) const noexcept -> link& {
+        return n ? n->tower()[level] : m_head[level];
+    }
+
+    [[nodiscard]]
+    static auto random_height() noexcept -> std::uint32_t {
+        static thread_local std::uint64_t state =
+          reinterpret_cast<std::uintptr_t>(&state) * 0x9E3779B97F4A7C15ull | 1;
+        state ^= state << 13;
+        state ^= state >> 7;
+        state ^= state << 17;
+        // Each level is kept with a probability of 1/2.
+        return std::countr_zero(state | (std::uint64_t(1) << (max_levels - 1))) + 1;
+    }
+
+    template<typename... Args>
+    [[nodiscard]]
+    static auto create_node(std::uint32_t height, const K& key, Args&&... args) -> node* {
+        void* memory = ::operator new(node::bytes(height), std::align_val_t(alignof(node)));
+        node* n;
+        try {
+            n = ::new(memory) node(height, key, std::forward<Args>(args)...);
+        }
+        catch(...) {
+            ::operator delete(memory, node::bytes(height), std::align_val_t(alignof(node)));
+            throw;
+        }
+        for(std::uint32_t level = 0; level < height; ++level)
+            ::new(static_cast<void*>(n->tower() + level)) link(0);
+        return n;
+    }
+
+    static void destroy_node(void* object) noexcept {
+        auto* n                    = static_cast<node*>(object);
+        const std::uint32_t height = n->levels;
+        std::destroy_n(n->tower(), height);
+        n->~node();
+        ::operator delete(object, node::bytes(height), std::align_val_t(alignof(node)));
+    }
+
+    //! Retires the node once both its inserting and its erasing threads are done with it.
+    static void release(node* n) {
+        if(n->owners.fetch_sub(1, std::memory_order_acq_rel) == 1)
+            detail::EpochDomain::instance().retire(n, &destroy_node);
+    }
+
+    //! Fills preds and succs with the nodes around key at every level,
+    //! unlinking the marked nodes on the way. Must be in a critical section.
+    //! @returns true if succs[0] holds key
+    bool find_position(const K& key, node** preds, node** succs) const {
+    retry:
+        node* pred = nullptr;
+        for(std::uint32_t level = max_levels; level-- > 0;) {
+            node* curr = to_node(next_link(pred, level).load(std::memory_order_acquire));
+            while(curr) {
+                std::uintptr_t succ = curr->tower()[level].load(std::memory_order_acquire);
+                if(is_marked(succ)) {
+                    std::uintptr_t expected = to_link(curr);
+                    if(!next_link(pred, level).compare_exchange_strong(
+                         expected, succ & ~std::uintptr_t(1), std::memory_order_acq_rel,
+                         std::memory_order_relaxed))
+                        goto retry;
+                    curr = to_node(succ);
+                    continue;
+                }
+                if(!m_compare(curr->key, key))
+                    break;
+                pred = curr;
+                curr = to_node(succ);
+            }
+            preds[level] = pred;
+            succs[level] = curr;
+        }
+        return succs[0] && !m_compare(key, succs[0]->key);
+    }
+
+    //! Links the levels above the bottom one, stopping early if the node gets erased.
+    void link_upper_levels(node* n, node** preds, node** succs) {
+        link* tower = n->tower();
+        for(std::uint32_t level = 1; level < n->levels; ++level) {
+            for(;;) {
+                std::uintptr_t next = tower[level].load(std::memory_order_acquire);
+                if(is_marked(next))
+                    return;
+                if(next != to_link(succs[level])
+                   && !tower[level].compare_exchange_strong(next, to_link(succs[level]),
+                                                            std::memory_order_acq_rel,
+                                                            std::memory_order_relaxed))
+                    return;
+                std::uintptr_t expected = to_link(succs[level]);
+                if(next_link(preds[level], level)
+                     .compare_exchange_strong(expected, to_link(n), std::memory_order_release,
+                                              std::memory_order_relaxed))
+                    break;
+                find_position(n->key, preds, succs);
+                if(succs[0] != n)
+                    return;
+            }
+        }
+    }
+
+    //! Unlinks a marked node from every level.
+    //! A concurrent insert of the same key may link its node in front of n, so every level
+    //! is walked over all the nodes with an equivalent key.
+    void unlink(node* n) {
+        std::atomic_thread_fence(std::memory_order_seq_cst);
+    retry:
+        node* preds[max_levels];
+        node* succs[max_levels];
+        find_position(n->key, preds, succs);
+        for(std::uint32_t level = 0; level < n->levels; ++level) {
+            node* pred = preds[level];
+            node* curr = to_node(next_link(pred, level).load(std::memory_order_acquire));
+            while(curr && !m_compare(n->key, curr->key)) {
+                std::uintptr_t succ = curr->tower()[level].load(std::memory_order_acquire);
+                if(is_marked(succ)) {
+                    std::uintptr_t expected = to_link(curr);
+                    if(!next_link(pred, level).compare_exchange_strong(
+                         expected, succ & ~std::uintptr_t(1), std::memory_order_acq_rel,
+                         std::memory_order_relaxed))
+                        goto retry;
+                }
+                else
+                    pred = curr;
+                curr = to_node(succ);
+            }
+        }
+    }
+
+    //! @returns the first node that is not less than key and not erased.
+    [[nodiscard]]
+    auto find_node(const K& key) const -> node* {
+        node* pred = nullptr;
+        node* curr = nullptr;
+        for(std::uint32_t level = max_levels; level-- > 0;) {
+            curr = to_node(next_link(pred, level).load(std::memory_order_acquire));
+            while(curr && m_compare(curr->key, key)) {
+                pred = curr;
+                curr = to_node(curr->tower()[level].load(std::memory_order_acquire));
+            }
+        }
+        return first_live(curr);
+    }
+
+    //! @returns n or the first node after it that is not erased.
+    [[nodiscard]]
+    static auto first_live(node* n) noexcept -> node* {
+        while(n) {
+            const std::uintptr_t next = n->tower()[0].load(std::memory_order_acquire);
+            if(!is_marked(next))
+                return n;
+            n = to_node(next);
+        }
+        return nullptr;
+    }
+
+    mutable link m_head[max_levels]{};
+    alignas(64) std::atomic<size_type> m_size = 0;
+    [[no_unique_address]]
+    Compare m_compare;
+};
+
+//! Forward iterator over the keys in order, skipping the erased ones.
+//! It keeps its thread in a critical section, so the current node is never freed under it.
+template<typename K, typename V, typename Compare>
+class ConcurrentSkipListMap<K, V, Compare>::Iterator {
+private:
+    friend class ConcurrentSkipListMap;
+
+public:
+    using difference_type   = std::ptrdiff_t;
+    using value_type        = Pair<const K, V>;
+    using reference         = Pair<const K&, const V&>;
+    using iterator_category = std::forward_iterator_tag;
+
+    Iterator() = default;
+
+    auto operator*() const noexcept -> reference { return {m_node->key, m_node->value}; }
+
+    [[nodiscard]]
+    auto key() const noexcept -> const K& {
+        return m_node->key;
+    }
+
+    [[nodiscard]]
+    auto value() const noexcept -> const V& {
+        return m_node->value;
+    }
+
+    auto operator++() noexcept -> Iterator& {
+        m_node = first_live(to_node(m_node->tower()[0].load(std::memory_order_acquire)));
+        return *this;
+    }
+
+    auto operator++(int) -> Iterator {
+        Iterator tmp{*this};
+        ++*this;
+        return tmp;
+    }
+
+    bool operator==(const Iterator& rhs) const noexcept { return m_node == rhs.m_node; }
+
+private:
+    detail::EpochGuard m_guard;
+    node* m_node = nullptr;
+};
+}  // namespace xme
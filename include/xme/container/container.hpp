@@ -3,7 +3,27 @@
 #include "aligned_data.hpp"
 #include "array.hpp"
 #include "array_view.hpp"
+#include "array_view_nd.hpp"
+#include "bit_array.hpp"
+#include "concurrent_array.hpp"
+#include "concurrent_skip_list.hpp"
+#include "doubly_linked_list.hpp"
+#include "flat_map.hpp"
+#include "flat_set.hpp"
+#include "hash_map.hpp"
+#include "hash_set.hpp"
+#include "intrusive_list.hpp"
+#include "intrusive_slist.hpp"
 #include "linked_list.hpp"
+#include "lock_free_stack.hpp"
+#include "lru_cache.hpp"
+#include "mapped_array.hpp"
+#include "mpsc_queue.hpp"
+#include "packed_int_array.hpp"
+#include "segmented_array.hpp"
+#include "soa_array.hpp"
 #include "spsc_queue.hpp"
+#include "strided_view.hpp"
 #include "tuple.hpp"
+#include "unrolled_list.hpp"
 #include "pair.hpp"
@@ -1,4 +1,6 @@
 #pragma once
+#include <algorithm>
+#include <concepts>
 #include <cstddef>
 
 //! Made in its own file for future use.
@@ -8,4 +10,62 @@ template<std::size_t N>
 struct Capacity {
     static constexpr std::size_t capacity = N;
 };
-};  // namespace xme
\ No newline at end of file
+
+//! A growth policy decides the next capacity of a dynamic container.
+//! next_capacity(capacity, required, element_size) must return a value >= required.
+template<typename G>
+concept CGrowthPolicy = requires(std::size_t n) {
+    { G::next_capacity(n, n, n) } -> std::same_as<std::size_t>;
+};
+
+//! Multiplies the capacity by Num / Den.
+//! @param Num numerator of the growth factor
+//! @param Den denominator of the growth factor, Num / Den must be greater than 1
+template<std::size_t Num, std::size_t Den>
+struct GeometricGrowth {
+    static_assert(Num > Den, "The growth factor must be greater than 1");
+
+    [[nodiscard]]
+    static constexpr auto next_capacity(std::size_t capacity, std::size_t required,
+                                        std::size_t) noexcept -> std::size_t {
+        const std::size_t grown = capacity + std::max(capacity * (Num - Den) / Den, std::size_t(1));
+        return std::max(grown, required);
+    }
+};
+
+//! Doubles the capacity, wastes up to 50% of memory but does the fewest reallocations.
+using DoublingGrowth = GeometricGrowth<2, 1>;
+
+//! Grows the capacity by 1.5x, allows the allocator to reuse previously freed blocks.
+using HalfGrowth = GeometricGrowth<3, 2>;
+
+//! Grows the capacity by a fixed amount of elements.
+//! @param Step amount of elements added in every growth
+template<std::size_t Step>
+struct FixedStepGrowth {
+    static_assert(Step > 0, "Step must be greater than 0");
+
+    [[nodiscard]]
+    static constexpr auto next_capacity(std::size_t capacity, std::size_t required,
+                                        std::size_t) noexcept -> std::size_t {
+        return std::max(capacity + Step, required);
+    }
+};
+
+//! Uses Growth and rounds the amount of bytes to a multiple of PageSize.
+//! @param Growth the policy used to compute the next capacity before rounding
+//! @param PageSize must be a power of 2
+template<CGrowthPolicy Growth = DoublingGrowth, std::size_t PageSize = 4096>
+struct PageRoundedGrowth {
+    static_assert(PageSize != 0 && (PageSize & (PageSize - 1)) == 0,
+                  "PageSize must be a power of 2");
+
+    [[nodiscard]]
+    static constexpr auto next_capacity(std::size_t capacity, std::size_t required,
+                                        std::size_t element_size) noexcept -> std::size_t {
+        const std::size_t grown = Growth::next_capacity(capacity, required, element_size);
+        const std::size_t bytes = (grown * element_size + PageSize - 1) & ~(PageSize - 1);
+        return std::max(bytes / element_size, grown);
+    }
+};
+};  // namespace xme
@@ -0,0 +1,437 @@
+#pragma once
+#include "../../../private/container/doubly_linked_list_base.hpp"
+#include "concepts.hpp"
+#include <cassert>
+#include <iterator>
+#include <memory>
+#include <utility>
+
+namespace xme {
+//! DoublyLinkedList is a circular doubly linked list with a sentinel node.
+//! Access is O(N), unless it is the front or the back which is O(1).
+//! insert, erase and splice of a single element are O(1) at any position,
+//! and never invalidate iterators to the other elements.
+//! @param T the type of the stored element
+//! @param Alloc must be an allocator that satisfies the Allocator concept
+template<typename T, typename Alloc = std::allocator<T>>
+class DoublyLinkedList {
+private:
+    using node_base = detail::DoublyLinkedListNodeBase;
+    using node      = detail::DoublyLinkedListNode<T>;
+
+    template<bool Const>
+    class Iterator;
+
+public:
+    static_assert(std::is_same_v<T, std::remove_cv_t<T>>,
+                  "xme::DoublyLinkedList must have a non-const and non-volatile T");
+    static_assert(std::is_same_v<T, typename Alloc::value_type>,
+                  "xme::DoublyLinkedList must have the same T as its allocator");
+
+    using allocator_type = typename std::allocator_traits<Alloc>::template rebind_alloc<node>;
+
+private:
+    using alloc_traits = std::allocator_traits<allocator_type>;
+
+public:
+    using size_type              = std::size_t;
+    using difference_type        = std::ptrdiff_t;
+    using value_type             = T;
+    using pointer                = T*;
+    using const_pointer          = const T*;
+    using reference              = T&;
+    using const_reference        = const T&;
+    using iterator               = Iterator<false>;
+    using const_iterator         = Iterator<true>;
+    using reverse_iterator       = std::reverse_iterator<iterator>;
+    using const_reverse_iterator = std::reverse_iterator<const_iterator>;
+
+    constexpr DoublyLinkedList() noexcept(std::is_nothrow_default_constructible_v<allocator_type>) {
+        m_head.next = m_head.prev = &m_head;
+    }
+
+    //! Default constructs N nodes
+    explicit constexpr DoublyLinkedList(size_type n) : DoublyLinkedList() {
+        reserve_nodes(n);
+        for(; n > 0; --n)
+            emplace_back();
+    }
+
+    //! Constructs N nodes with value
+    constexpr DoublyLinkedList(size_type n, const T& value) : DoublyLinkedList() {
+        reserve_nodes(n);
+        for(; n > 0; --n)
+            emplace_back(value);
+    }
+
+    //! Constructs a DoublyLinkedList from a [first, end) range
+    template<std::input_iterator Iter, std::sentinel_for<Iter> Sent>
+    constexpr DoublyLinkedList(Iter first, Sent last) : DoublyLinkedList() {
+        insert(end(), first, last);
+    }
+
+    //! Constructs a DoublyLinkedList with the initializer_list syntax
+    explicit constexpr DoublyLinkedList(std::initializer_list<T> list) :
+      DoublyLinkedList(list.begin(), list.end()) {}
+
+    //! Constructs a DoublyLinkedList from [begin(range), end(range)) range
+    template<std::ranges::input_range R>
+        requires(std::convertible_to<std::ranges::range_reference_t<R>, T>)
+    explicit constexpr DoublyLinkedList(R&& range) :
+      DoublyLinkedList(std::ranges::begin(range), std::ranges::end(range)) {}
+
+    //! Constructs a DoublyLinkedList by copying elements from other.
+    constexpr DoublyLinkedList(const DoublyLinkedList& other) :
+      DoublyLinkedList(other.begin(), other.end()) {}
+
+    //! Constructs a DoublyLinkedList by transfering elements from other
+    constexpr DoublyLinkedList(DoublyLinkedList&& other) noexcept : DoublyLinkedList() {
+        m_allocator = other.m_allocator;
+        take_nodes(other);
+    }
+
+    constexpr ~DoublyLinkedList() noexcept { clear(); }
+
+    //! Clears the current elements and copy the elements from other
+    constexpr auto operator=(const DoublyLinkedList& other) -> DoublyLinkedList& {
+        if(this != &other)
+            assign(other.begin(), other.end());
+        return *this;
+    }
+
+    //! Clears the current elements and transfer elements from other
+    constexpr auto operator=(DoublyLinkedList&& other) noexcept -> DoublyLinkedList& {
+        clear();
+        if constexpr(alloc_traits::propagate_on_container_move_assignment::value)
+            m_allocator = other.m_allocator;
+        take_nodes(other);
+        return *this;
+    }
+
+    //! Clears the current elements and copy elements from list
+    constexpr auto operator=(std::initializer_list<T> list) -> DoublyLinkedList& {
+        assign(list.begin(), list.end());
+        return *this;
+    }
+
+    //! Returns a iterator to the first element
+    constexpr auto begin() noexcept -> iterator { return {m_head.next}; }
+    //! Returns a iterator to the first element
+    constexpr auto begin() const noexcept -> const_iterator { return {m_head.next}; }
+
+    //! Returns a iterator representing the end of the DoublyLinkedList
+    constexpr auto end() noexcept -> iterator { return {&m_head}; }
+    //! Returns a iterator representing the end of the DoublyLinkedList
+    constexpr auto end() const noexcept -> const_iterator { return {&m_head}; }
+
+    //! Returns a const iterator to the first element
+    constexpr auto cbegin() const noexcept -> const_iterator { return begin(); }
+    //! Returns a const iterator representing the end of the DoublyLinkedList
+    constexpr auto cend() const noexcept -> const_iterator { return end(); }
+
+    constexpr auto rbegin() noexcept -> reverse_iterator { return reverse_iterator(end()); }
+    constexpr auto rbegin() const noexcept -> const_reverse_iterator {
+        return const_reverse_iterator(end());
+    }
+
+    constexpr auto rend() noexcept -> reverse_iterator { return reverse_iterator(begin()); }
+    constexpr auto rend() const noexcept -> const_reverse_iterator {
+        return const_reverse_iterator(begin());
+    }
+
+    //! Returns a reference to the first element
+    constexpr auto front() noexcept -> reference { return *begin(); }
+    //! Returns a reference to the first element
+    constexpr auto front() const noexcept -> const_reference { return *begin(); }
+
+    //! Returns a reference to the last element
+    constexpr auto back() noexcept -> reference { return *std::prev(end()); }
+    //! Returns a reference to the last element
+    constexpr auto back() const noexcept -> const_reference { return *std::prev(end()); }
+
+    //! Returns true if there are no elements in the DoublyLinkedList
+    constexpr bool is_empty() const noexcept { return m_size == 0; }
+
+    //! Returns the amount of elements, O(1).
+    [[nodiscard]]
+    constexpr auto size() const noexcept -> size_type {
+        return m_size;
+    }
+
+    //! Erases every element in the DoublyLinkedList
+    constexpr void clear() noexcept { erase(begin(), end()); }
+
+    //! Clears the current DoublyLinkedList and copy elements from a [first, end) range
+    //! Existing nodes are reused.
+    template<std::input_iterator Iter, std::sentinel_for<Iter> Sent>
+    constexpr void assign(Iter first, Sent last) {
+        auto curr = begin();
+        for(; curr != end() && first != last; ++curr, ++first)
+            *curr = *first;
+        if(first != last)
+            insert(end(), first, last);
+        else
+            erase(curr, end());
+    }
+
+    //! Creates a node at the front by copying value
+    constexpr void push_front(const T& value) { emplace(begin(), value); }
+    //! Creates a node at the front by moving value
+    constexpr void push_front(T&& value) { emplace(begin(), std::move(value)); }
+
+    //! Creates a node at the back by copying value
+    constexpr void push_back(const T& value) { emplace(end(), value); }
+    //! Creates a node at the back by moving value
+    constexpr void push_back(T&& value) { emplace(end(), std::move(value)); }
+
+    //! Erases the node at the front
+    constexpr void pop_front() noexcept { erase(begin()); }
+
+    //! Erases the node at the back
+    constexpr void pop_back() noexcept { erase(std::prev(end())); }
+
+    //! Creates a node at the front by forwarding args.
+    //! @returns a reference to the newly inserted element.
+    template<typename... Args>
+    constexpr auto emplace_front(Args&&... args) -> reference {
+        return *emplace(begin(), std::forward<Args>(args)...);
+    }
+
+    //! Creates a node at the back by forwarding args.
+    //! @returns a reference to the newly inserted element.
+    template<typename... Args>
+    constexpr auto emplace_back(Args&&... args) -> reference {
+        return *emplace(end(), std::forward<Args>(args)...);
+    }
+
+    //! Inserts a node before pos.
+    //! @returns an iterator to the new node.
+    template<std::convertible_to<T> U>
+    constexpr auto insert(const_iterator pos, U&& value) -> iterator {
+        return emplace(pos, std::forward<U>(value));
+    }
+
+    //! Inserts a [first, last) range of nodes before pos.
+    //! @returns an iterator to the first inserted element, or pos if the range is empty.
+    template<std::input_iterator Iter, std::sentinel_for<Iter> Sent>
+    constexpr auto insert(const_iterator pos, Iter first, Sent last) -> iterator {
+        if constexpr(std::forward_iterator<Iter>)
+            reserve_nodes(std::ranges::distance(first, last));
+        iterator result{pos.m_node};
+        if(first == last)
+            return result;
+        result = emplace(pos, *first);
+        for(++first; first != last; ++first)
+            emplace(pos, *first);
+        return result;
+    }
+
+    //! Inserts a [begin(range), end(range)) range of nodes before pos.
+    //! @returns an iterator to the first inserted element, or pos if the range is empty.
+    template<std::ranges::input_range R>
+        requires(std::is_convertible_v<std::ranges::range_reference_t<R>, T>)
+    constexpr auto insert(const_iterator pos, R&& range) -> iterator {
+        return insert(pos, std::ranges::begin(range), std::ranges::end(range));
+    }
+
+    //! Constructs a node before pos by forwarding args.
+    //! @returns an iterator to the new node.
+    template<typename... Args>
+    constexpr auto emplace(const_iterator pos, Args&&... args) -> iterator {
+        node* new_node = create_node(std::forward<Args>(args)...);
+        link_before(pos.m_node, new_node);
+        ++m_size;
+        return {new_node};
+    }
+
+    //! Erases the node at pos.
+    //! @returns an iterator to the node after it.
+    constexpr auto erase(const_iterator pos) noexcept -> iterator {
+        assert(pos != end());
+        node_base* next = pos.m_node->next;
+        unlink(pos.m_node);
+        destroy_node(static_cast<node*>(pos.m_node));
+        --m_size;
+        return {next};
+    }
+
+    //! Erases the nodes in [first, last).
+    //! @returns last.
+    constexpr auto erase(const_iterator first, const_iterator last) noexcept -> iterator {
+        while(first != last)
+            first = erase(first);
+        return {last.m_node};
+    }
+
+    //! Moves every element of other before pos, O(1).
+    constexpr void splice(const_iterator pos, DoublyLinkedList& other) noexcept {
+        if(this == &other || other.is_empty())
+            return;
+        const size_type n = other.m_size;
+        splice_nodes(pos.m_node, other.m_head.next, &other.m_head);
+        other.m_size = 0;
+        m_size += n;
+    }
+
+    //! Moves the element at it from other before pos, O(1).
+    //! Moving an element of this list to a new position never invalidates it.
+    constexpr void splice(const_iterator pos, DoublyLinkedList& other, const_iterator it) noexcept {
+        if(pos == it || pos.m_node == it.m_node->next)
+            return;
+        splice_nodes(pos.m_node, it.m_node, it.m_node->next);
+        --other.m_size;
+        ++m_size;
+    }
+
+    //! Moves the elements in [first, last) from other before pos.
+    //! O(1) when other is this list, otherwise O(distance(first, last)) to count them.
+    constexpr void splice(const_iterator pos, DoublyLinkedList& other, const_iterator first,
+                          const_iterator last) noexcept {
+        if(first == last)
+            return;
+        if(this != &other) {
+            const auto n = static_cast<size_type>(std::distance(first, last));
+            other.m_size -= n;
+            m_size += n;
+        }
+        splice_nodes(pos.m_node, first.m_node, last.m_node);
+    }
+
+    //! Reverses the list, making the last element the first
+    constexpr void reverse() noexcept {
+        node_base* curr = &m_head;
+        do {
+            std::swap(curr->next, curr->prev);
+            curr = curr->prev;
+        } while(curr != &m_head);
+    }
+
+private:
+    template<typename... Args>
+    constexpr auto create_node(Args&&... args) -> node* {
+        node* new_node = alloc_traits::allocate(m_allocator, 1);
+        try {
+            std::ranges::construct_at(new_node);
+            std::ranges::construct_at(new_node->storage.data(), std::forward<Args>(args)...);
+        }
+        catch(...) {
+            alloc_traits::deallocate(m_allocator, new_node, 1);
+            throw;
+        }
+        return new_node;
+    }
+
+    constexpr void destroy_node(node* n) noexcept {
+        std::ranges::destroy_at(n->storage.data());
+        alloc_traits::deallocate(m_allocator, n, 1);
+    }
+
+    //! Allocators that support it, like PoolAllocator, carve the next n nodes from
+    //! a single block, so they are allocated at once and are adjacent in memory.
+    constexpr void reserve_nodes(size_type n) {
+        if constexpr(requires { m_allocator.reserve(n); })
+            m_allocator.reserve(n);
+    }
+
+    static constexpr void link_before(node_base* next, node_base* n) noexcept {
+        n->next          = next;
+        n->prev          = next->prev;
+        next->prev->next = n;
+        next->prev       = n;
+    }
+
+    static constexpr void unlink(node_base* n) noexcept {
+        n->prev->next = n->next;
+        n->next->prev = n->prev;
+    }
+
+    //! Moves the nodes in [first, last) before pos.
+    static constexpr void splice_nodes(node_base* pos, node_base* first, node_base* last) noexcept {
+        node_base* tail   = last->prev;
+        first->prev->next = last;
+        last->prev        = first->prev;
+
+        first->prev     = pos->prev;
+        pos->prev->next = first;
+        tail->next      = pos;
+        pos->prev       = tail;
+    }
+
+    //! Takes the nodes of other, which becomes empty.
+    constexpr void take_nodes(DoublyLinkedList& other) noexcept {
+        if(other.is_empty())
+            return;
+        m_head.next       = other.m_head.next;
+        m_head.prev       = other.m_head.prev;
+        m_head.next->prev = &m_head;
+        m_head.prev->next = &m_head;
+        m_size            = std::exchange(other.m_size, 0);
+        other.m_head.next = other.m_head.prev = &other.m_head;
+    }
+
+    node_base m_head;
+    size_type m_size = 0;
+    [[no_unique_address]]
+    allocator_type m_allocator;
+};
+
+template<typename T, typename Alloc>
+template<bool Const>
+class DoublyLinkedList<T, Alloc>::Iterator {
+private:
+    friend class DoublyLinkedList;
+
+public:
+    using difference_type   = std::ptrdiff_t;
+    using value_type        = T;
+    using reference         = std::conditional_t<Const, const T&, T&>;
+    using pointer           = std::conditional_t<Const, const T*, T*>;
+    using iterator_category = std::bidirectional_iterator_tag;
+
+    template<bool>
+    friend class Iterator;
+
+    constexpr Iterator() noexcept = default;
+
+    constexpr Iterator(const node_base* n) noexcept : m_node(const_cast<node_base*>(n)) {}
+
+    constexpr Iterator(const Iterator<!Const>& it) noexcept
+        requires(Const)
+      : m_node(it.m_node) {}
+
+    constexpr auto operator*() const noexcept -> reference {
+        return *static_cast<node*>(m_node)->storage.data();
+    }
+
+    constexpr auto operator->() const noexcept -> pointer {
+        return static_cast<node*>(m_node)->storage.data();
+    }
+
+    constexpr auto operator++() noexcept -> Iterator& {
+        m_node = m_node->next;
+        return *this;
+    }
+
+    constexpr auto operator++(int) noexcept -> Iterator {
+        Iterator tmp{*this};
+        m_node = m_node->next;
+        return tmp;
+    }
+
+    constexpr auto operator--() noexcept -> Iterator& {
+        m_node = m_node->prev;
+        return *this;
+    }
+
+    constexpr auto operator--(int) noexcept -> Iterator {
+        Iterator tmp{*this};
+        m_node = m_node->prev;
+        return tmp;
+    }
+
+    constexpr bool operator==(const Iterator& rhs) const noexcept = default;
+
+private:
+    node_base* m_node = nullptr;
+};
+}  // namespace xme
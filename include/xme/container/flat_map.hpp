@@ -0,0 +1,380 @@
+#pragma once
+#include "../../../private/container/flat_base.hpp"
+#include "array.hpp"
+#include "array_view.hpp"
+#include "pair.hpp"
+#include <algorithm>
+#include <functional>
+
+namespace xme {
+//! FlatMap is an ordered map stored in two sorted contiguous containers,
+//! one for the keys and one for the values, so searching only touches the keys.
+//! Lookup is a branchless binary search, O(log(N)).
+//! Insertion and erase are O(N), prefer insert_range for bulk insertion.
+//! @param K the type of the key
+//! @param V the type of the mapped value
+//! @param Compare strict weak ordering of the keys
+//! @param KeyContainer contiguous container of K
+//! @param MappedContainer contiguous container of V
+template<typename K, typename V, typename Compare = std::less<K>,
+         std::ranges::contiguous_range KeyContainer    = Array<K>,
+         std::ranges::contiguous_range MappedContainer = Array<V>>
+class FlatMap {
+private:
+    template<bool Const>
+    class Iterator;
+
+public:
+    using key_type               = K;
+    using mapped_type            = V;
+    using value_type             = Pair<K, V>;
+    using key_compare            = Compare;
+    using size_type              = std::size_t;
+    using difference_type        = std::ptrdiff_t;
+    using reference              = Pair<const K&, V&>;
+    using const_reference        = Pair<const K&, const V&>;
+    using iterator               = Iterator<false>;
+    using const_iterator         = Iterator<true>;
+    using key_container_type     = KeyContainer;
+    using mapped_container_type  = MappedContainer;
+
+    constexpr FlatMap() = default;
+
+    constexpr FlatMap(std::initializer_list<value_type> list) { insert_range(list); }
+
+    //! Creates a map with [begin(range), end(range)) elements.
+    template<std::ranges::input_range R>
+        requires(CPairLike<std::ranges::range_reference_t<R>>)
+                && (!std::is_same_v<FlatMap, std::remove_cvref_t<R>>)
+    explicit constexpr FlatMap(R&& range) {
+        insert_range(std::forward<R>(range));
+    }
+
+    [[nodiscard]]
+    constexpr auto begin() noexcept -> iterator {
+        return {this, 0};
+    }
+
+    [[nodiscard]]
+    constexpr auto end() noexcept -> iterator {
+        return {this, size()};
+    }
+
+    [[nodiscard]]
+    constexpr auto begin() const noexcept -> const_iterator {
+        return {this, 0};
+    }
+
+    [[nodiscard]]
+    constexpr auto end() const noexcept -> const_iterator {
+        return {this, size()};
+    }
+
+    [[nodiscard]]
+    constexpr auto cbegin() const noexcept -> const_iterator {
+        return begin();
+    }
+
+    [[nodiscard]]
+    constexpr auto cend() const noexcept -> const_iterator {
+        return end();
+    }
+
+    //! @returns a sorted view of every key.
+    [[nodiscard]]
+    constexpr auto keys() const noexcept -> ArrayView<const K> {
+        return {std::ranges::data(m_keys), std::ranges::size(m_keys)};
+    }
+
+    //! @returns a view of every value, in the same order as the keys.
+    [[nodiscard]]
+    constexpr auto values() noexcept -> ArrayView<V> {
+        return {std::ranges::data(m_values), std::ranges::size(m_values)};
+    }
+
+    //! @returns a view of every value, in the same order as the keys.
+    [[nodiscard]]
+    constexpr auto values() const noexcept -> ArrayView<const V> {
+        return {std::ranges::data(m_values), std::ranges::size(m_values)};
+    }
+
+    [[nodiscard]]
+    constexpr auto size() const noexcept -> size_type {
+        return std::ranges::size(m_keys);
+    }
+
+    [[nodiscard]]
+    constexpr bool empty() const noexcept {
+        return size() == 0;
+    }
+
+    constexpr void reserve(size_type n) {
+        m_keys.reserve(n);
+        m_values.reserve(n);
+    }
+
+    constexpr void clear() noexcept {
+        m_keys.clear();
+        m_values.clear();
+    }
+
+    //! @returns an iterator to the first element whose key is not less than key.
+    [[nodiscard]]
+    constexpr auto lower_bound(const K& key) noexcept -> iterator {
+        return {this, lower_bound_index(key)};
+    }
+
+    //! @returns an iterator to the first element whose key is not less than key.
+    [[nodiscard]]
+    constexpr auto lower_bound(const K& key) const noexcept -> const_iterator {
+        return {this, lower_bound_index(key)};
+    }
+
+    [[nodiscard]]
+    constexpr auto find(const K& key) noexcept -> iterator {
+        return {this, find_index(key)};
+    }
+
+    [[nodiscard]]
+    constexpr auto find(const K& key) const noexcept -> const_iterator {
+        return {this, find_index(key)};
+    }
+
+    [[nodiscard]]
+    constexpr bool contains(const K& key) const noexcept {
+        return find_index(key) != size();
+    }
+
+    [[nodiscard]]
+    constexpr auto count(const K& key) const noexcept -> size_type {
+        return contains(key) ? 1 : 0;
+    }
+
+    //! @returns a reference to the value of key, it is default constructed when missing.
+    constexpr auto operator[](const K& key) -> V& { return get<1>(*try_emplace(key).first); }
+
+    //! Constructs V from args if key is not in the map, otherwise nothing happens.
+    //! @returns an iterator to the element with the key and true if it was inserted
+    template<typename KK, typename... Args>
+        requires(std::constructible_from<K, KK>)
+    constexpr auto try_emplace(KK&& key, Args&&... args) -> Pair<iterator, bool> {
+        const size_type index = lower_bound_index(key);
+        if(index != size() && !m_compare(key, m_keys[index]))
+            return {iterator{this, index}, false};
+
+        m_keys.insert(m_keys.begin() + index, K(std::forward<KK>(key)));
+        try {
+            m_values.insert(m_values.begin() + index, V(std::forward<Args>(args)...));
+        }
+        catch(...) {
+            m_keys.erase(m_keys.begin() + index);
+            throw;
+        }
+        return {iterator{this, index}, true};
+    }
+
+    //! Inserts value if its key is not in the map.
+    //! @returns an iterator to the element with the key and true if it was inserted
+    template<CPairLike P>
+    constexpr auto insert(P&& value) -> Pair<iterator, bool> {
+        return try_emplace(get<0>(std::forward<P>(value)), get<1>(std::forward<P>(value)));
+    }
+
+    //! Assigns value to the element with key, or inserts it.
+    //! @returns an iterator to the element with the key and true if it was inserted
+    template<typename KK, typename U>
+        requires(std::constructible_from<K, KK>)
+    constexpr auto insert_or_assign(KK&& key, U&& value) -> Pair<iterator, bool> {
+        auto result = try_emplace(std::forward<KK>(key), std::forward<U>(value));
+        if(!result.second)
+            get<1>(*result.first) = std::forward<U>(value);
+        return result;
+    }
+
+    //! Inserts every element of range whose key is not in the map.
+    //! The new elements are sorted and merged in a single pass, O(N + M*log(M)).
+    template<std::ranges::input_range R>
+        requires(CPairLike<std::ranges::range_reference_t<R>>)
+    constexpr void insert_range(R&& range) {
+        Array<value_type> incoming;
+        if constexpr(std::ranges::sized_range<R>)
+            incoming.reserve(std::ranges::size(range));
+        for(auto&& value : range)
+            incoming.emplace_back(get<0>(value), get<1>(value));
+
+        auto compare_keys = [this](const value_type& lhs, const value_type& rhs) {
+            return m_compare(lhs.first, rhs.first);
+        };
+        std::ranges::stable_sort(incoming, compare_keys);
+
+        KeyContainer keys;
+        MappedContainer values;
+        keys.reserve(size() + incoming.size());
+        values.reserve(size() + incoming.size());
+
+        size_type old = 0;
+        for(auto it = incoming.begin(); it != incoming.end(); ++it) {
+            // Equal keys in incoming are adjacent, only the first one is kept.
+            if(it != incoming.begin() && !m_compare((it - 1)->first, it->first))
+                continue;
+            for(; old < size() && m_compare(m_keys[old], it->first); ++old) {
+                keys.push_back(std::move(m_keys[old]));
+                values.push_back(std::move(m_values[old]));
+            }
+            if(old < size() && !m_compare(it->first, m_keys[old]))
+                continue;
+            keys.push_back(std::move(it->first));
+            values.push_back(std::move(it->second));
+        }
+        for(; old < size(); ++old) {
+            keys.push_back(std::move(m_keys[old]));
+            values.push_back(std::move(m_values[old]));
+        }
+        m_keys   = std::move(keys);
+        m_values = std::move(values);
+    }
+
+    //! Erases the element at pos.
+    //! @returns an iterator to the element after it
+    constexpr auto erase(const_iterator pos) -> iterator {
+        m_keys.erase(m_keys.begin() + pos.m_index);
+        m_values.erase(m_values.begin() + pos.m_index);
+        return {this, pos.m_index};
+    }
+
+    //! Erases the element with key.
+    //! @returns the amount of erased elements
+    constexpr auto erase(const K& key) -> size_type {
+        const size_type index = find_index(key);
+        if(index == size())
+            return 0;
+        erase(const_iterator{this, index});
+        return 1;
+    }
+
+private:
+    template<typename KK>
+    constexpr auto lower_bound_index(const KK& key) const noexcept -> size_type {
+        return detail::branchless_lower_bound(
+          std::ranges::data(m_keys), std::ranges::size(m_keys), key, m_compare);
+    }
+
+    constexpr auto find_index(const K& key) const noexcept -> size_type {
+        const size_type index = lower_bound_index(key);
+        if(index != size() && !m_compare(key, m_keys[index]))
+            return index;
+        return size();
+    }
+
+    KeyContainer m_keys;
+    MappedContainer m_values;
+    [[no_unique_address]]
+    mutable Compare m_compare;
+};
+
+template<typename K, typename V, typename Compare, std::ranges::contiguous_range KeyContainer,
+         std::ranges::contiguous_range MappedContainer>
+template<bool Const>
+class FlatMap<K, V, Compare, KeyContainer, MappedContainer>::Iterator {
+private:
+    using container = std::conditional_t<Const, const FlatMap, FlatMap>;
+
+    friend class FlatMap;
+
+public:
+    using difference_type = std::ptrdiff_t;
+    using value_type      = Pair<K, V>;
+    using reference =
+      std::conditional_t<Const, Pair<const K&, const V&>, Pair<const K&, V&>>;
+    using iterator_category = std::random_access_iterator_tag;
+
+    //! Returned by operator->, since keys and values are not stored as pairs.
+    //! Holds the reference, so it->second accesses the mapped value.
+    struct ArrowProxy {
+        reference ref;
+
+        constexpr auto operator->() noexcept -> reference* { return &ref; }
+    };
+
+    using pointer = ArrowProxy;
+
+    template<bool>
+    friend class Iterator;
+
+    constexpr Iterator() noexcept = default;
+
+    constexpr Iterator(container* map, size_type index) noexcept : m_map(map), m_index(index) {}
+
+    constexpr Iterator(const Iterator<!Const>& it) noexcept
+        requires(Const)
+      : m_map(it.m_map), m_index(it.m_index) {}
+
+    constexpr auto operator*() const noexcept -> reference {
+        return {m_map->m_keys[m_index], m_map->m_values[m_index]};
+    }
+
+    constexpr auto operator->() const noexcept -> ArrowProxy { return {**this}; }
+
+    constexpr auto operator++() noexcept -> Iterator& {
+        ++m_index;
+        return *this;
+    }
+
+    constexpr auto operator++(int) noexcept -> Iterator {
+        Iterator tmp{*this};
+        ++m_index;
+        return tmp;
+    }
+
+    constexpr auto operator--() noexcept -> Iterator& {
+        --m_index;
+        return *this;
+    }
+
+    constexpr auto operator--(int) noexcept -> Iterator {
+        Iterator tmp{*this};
+        --m_index;
+        return tmp;
+    }
+
+    constexpr auto operator+(difference_type n) const noexcept -> Iterator {
+        return {m_map, m_index + n};
+    }
+
+    friend constexpr auto operator+(difference_type n, const Iterator& it) noexcept -> Iterator {
+        return it + n;
+    }
+
+    constexpr auto operator-(difference_type n) const noexcept -> Iterator {
+        return {m_map, m_index - n};
+    }
+
+    constexpr auto operator-(const Iterator& it) const noexcept -> difference_type {
+        return difference_type(m_index) - difference_type(it.m_index);
+    }
+
+    constexpr auto operator+=(difference_type n) noexcept -> Iterator& {
+        m_index += n;
+        return *this;
+    }
+
+    constexpr auto operator-=(difference_type n) noexcept -> Iterator& {
+        m_index -= n;
+        return *this;
+    }
+
+    constexpr auto operator[](difference_type n) const noexcept -> reference {
+        return *(*this + n);
+    }
+
+    constexpr bool operator==(const Iterator& rhs) const noexcept { return m_index == rhs.m_index; }
+
+    constexpr auto operator<=>(const Iterator& rhs) const noexcept {
+        return m_index <=> rhs.m_index;
+    }
+
+private:
+    container* m_map  = nullptr;
+    size_type m_index = 0;
+};
+}  // namespace xme
@@ -0,0 +1,177 @@
+#pragma once
+#include "../../../private/container/flat_base.hpp"
+#include "array.hpp"
+#include "array_view.hpp"
+#include "pair.hpp"
+#include <algorithm>
+#include <functional>
+
+namespace xme {
+//! FlatSet is an ordered set of unique keys stored in a sorted contiguous container.
+//! Lookup is a branchless binary search, O(log(N)).
+//! Insertion and erase are O(N), prefer insert_range for bulk insertion.
+//! @param K the type of the key
+//! @param Compare strict weak ordering of the keys
+//! @param KeyContainer contiguous container of K
+template<typename K, typename Compare = std::less<K>,
+         std::ranges::contiguous_range KeyContainer = Array<K>>
+class FlatSet {
+public:
+    using key_type           = K;
+    using value_type         = K;
+    using key_compare        = Compare;
+    using size_type          = std::size_t;
+    using difference_type    = std::ptrdiff_t;
+    using reference          = const K&;
+    using const_reference    = const K&;
+    using iterator           = const K*;
+    using const_iterator     = const K*;
+    using container_type     = KeyContainer;
+
+    constexpr FlatSet() = default;
+
+    constexpr FlatSet(std::initializer_list<K> list) { insert_range(list); }
+
+    //! Creates a set with [begin(range), end(range)) elements.
+    template<std::ranges::input_range R>
+        requires(std::constructible_from<K, std::ranges::range_reference_t<R>>)
+                && (!std::is_same_v<FlatSet, std::remove_cvref_t<R>>)
+    explicit constexpr FlatSet(R&& range) {
+        insert_range(std::forward<R>(range));
+    }
+
+    [[nodiscard]]
+    constexpr auto begin() const noexcept -> const_iterator {
+        return std::ranges::data(m_keys);
+    }
+
+    [[nodiscard]]
+    constexpr auto end() const noexcept -> const_iterator {
+        return begin() + size();
+    }
+
+    [[nodiscard]]
+    constexpr auto cbegin() const noexcept -> const_iterator {
+        return begin();
+    }
+
+    [[nodiscard]]
+    constexpr auto cend() const noexcept -> const_iterator {
+        return end();
+    }
+
+    //! @returns a sorted view of every key.
+    [[nodiscard]]
+    constexpr auto keys() const noexcept -> ArrayView<const K> {
+        return {begin(), size()};
+    }
+
+    [[nodiscard]]
+    constexpr auto size() const noexcept -> size_type {
+        return std::ranges::size(m_keys);
+    }
+
+    [[nodiscard]]
+    constexpr bool empty() const noexcept {
+        return size() == 0;
+    }
+
+    constexpr void reserve(size_type n) { m_keys.reserve(n); }
+
+    constexpr void clear() noexcept { m_keys.clear(); }
+
+    //! @returns an iterator to the first key that is not less than key.
+    [[nodiscard]]
+    constexpr auto lower_bound(const K& key) const noexcept -> const_iterator {
+        return begin() + lower_bound_index(key);
+    }
+
+    [[nodiscard]]
+    constexpr auto find(const K& key) const noexcept -> const_iterator {
+        return begin() + find_index(key);
+    }
+
+    [[nodiscard]]
+    constexpr bool contains(const K& key) const noexcept {
+        return find_index(key) != size();
+    }
+
+    [[nodiscard]]
+    constexpr auto count(const K& key) const noexcept -> size_type {
+        return contains(key) ? 1 : 0;
+    }
+
+    //! Constructs a key from args and inserts it if it is not in the set.
+    //! @returns an iterator to the key and true if it was inserted
+    template<typename... Args>
+    constexpr auto emplace(Args&&... args) -> Pair<const_iterator, bool> {
+        return insert(K(std::forward<Args>(args)...));
+    }
+
+    //! Inserts key if it is not in the set.
+    //! @returns an iterator to the key and true if it was inserted
+    template<typename U>
+        requires(std::constructible_from<K, U>)
+    constexpr auto insert(U&& key) -> Pair<const_iterator, bool> {
+        const size_type index = lower_bound_index(key);
+        if(index != size() && !m_compare(key, m_keys[index]))
+            return {begin() + index, false};
+        m_keys.insert(m_keys.begin() + index, K(std::forward<U>(key)));
+        return {begin() + index, true};
+    }
+
+    //! Inserts every key of range that is not in the set.
+    //! The new keys are sorted and merged in a single pass, O(N + M*log(M)).
+    template<std::ranges::input_range R>
+        requires(std::constructible_from<K, std::ranges::range_reference_t<R>>)
+    constexpr void insert_range(R&& range) {
+        const auto old_size = static_cast<std::ptrdiff_t>(size());
+        for(auto&& key : range)
+            m_keys.push_back(K(std::forward<decltype(key)>(key)));
+
+        auto first  = m_keys.begin();
+        auto middle = first + old_size;
+        std::ranges::stable_sort(middle, m_keys.end(), m_compare);
+        std::ranges::inplace_merge(first, middle, m_keys.end(), m_compare);
+        // inplace_merge is stable, so the existing key comes before an equal new key.
+        auto removed = std::ranges::unique(first, m_keys.end(), [this](const K& lhs, const K& rhs) {
+            return !m_compare(lhs, rhs);
+        });
+        m_keys.erase(removed.begin(), m_keys.end());
+    }
+
+    //! Erases the key at pos.
+    //! @returns an iterator to the key after it
+    constexpr auto erase(const_iterator pos) -> const_iterator {
+        const auto index = pos - begin();
+        m_keys.erase(m_keys.begin() + index);
+        return begin() + index;
+    }
+
+    //! Erases key.
+    //! @returns the amount of erased keys
+    constexpr auto erase(const K& key) -> size_type {
+        const size_type index = find_index(key);
+        if(index == size())
+            return 0;
+        erase(begin() + index);
+        return 1;
+    }
+
+private:
+    constexpr auto lower_bound_index(const K& key) const noexcept -> size_type {
+        return detail::branchless_lower_bound(begin(), size(), key, m_compare);
+    }
+
+    constexpr auto find_index(const K& key) const noexcept -> size_type {
+        const size_type index = lower_bound_index(key);
+        if(index != size() && !m_compare(key, m_keys[index]))
+            return index;
+        return size();
+    }
+
+    KeyContainer m_keys;
+    [[no_unique_address]]
+    mutable Compare m_compare;
+};
+}  // namespace xme
@@ -0,0 +1,74 @@
+#pragma once
+#include "../../../private/container/hash_table_base.hpp"
+#include "concepts.hpp"
+#include "pair.hpp"
+#include <functional>
+
+namespace xme {
+//! HashMap is an open addressing hash table, elements are stored in a flat array.
+//! Every slot has 1 byte of metadata, which is probed a group at a time,
+//! with SSE2 when enabled through xme::hal::enabled_simd, or 64 bit arithmetic otherwise.
+//! Lookup, insertion and erase are O(1) on average.
+//! References and iterators are invalidated on rehash.
+//! Heterogeneous lookup is enabled when both Hash and KeyEqual define is_transparent.
+//! @param K the type of the key
+//! @param V the type of the mapped value
+//! @param Alloc must be an allocator that satisfies the Allocator concept
+template<typename K, typename V, typename Hash = std::hash<K>, typename KeyEqual = std::equal_to<K>,
+         CAllocator Alloc = std::allocator<Pair<const K, V>>>
+class HashMap : public detail::HashTable<detail::HashMapPolicy<K, V>, Hash, KeyEqual, Alloc> {
+private:
+    using super = detail::HashTable<detail::HashMapPolicy<K, V>, Hash, KeyEqual, Alloc>;
+
+public:
+    static_assert(std::is_same_v<K, std::remove_cv_t<K>>,
+                  "xme::HashMap must have a non-const and non-volatile K");
+
+    using mapped_type = V;
+    using typename super::iterator;
+    using typename super::key_type;
+
+    using super::super;
+
+    //! Constructs V from args if key is not in the map, otherwise nothing happens.
+    //! @returns an iterator to the element with the key and true if it was inserted
+    template<typename KK, typename... Args>
+        requires(std::constructible_from<K, KK>)
+    auto try_emplace(KK&& key, Args&&... args) -> Pair<iterator, bool> {
+        auto [index, inserted] = super::find_or_prepare_insert(key);
+        if(inserted)
+            construct_entry(index, std::forward<KK>(key), std::forward<Args>(args)...);
+        return {super::iterator_at(index), inserted};
+    }
+
+    //! Assigns value to the element with key, or inserts it.
+    //! @returns an iterator to the element with the key and true if it was inserted
+    template<typename KK, typename U>
+        requires(std::constructible_from<K, KK>)
+    auto insert_or_assign(KK&& key, U&& value) -> Pair<iterator, bool> {
+        auto [index, inserted] = super::find_or_prepare_insert(key);
+        if(inserted)
+            construct_entry(index, std::forward<KK>(key), std::forward<U>(value));
+        else
+            super::slot_at(index).second = std::forward<U>(value);
+        return {super::iterator_at(index), inserted};
+    }
+
+    //! @returns a reference to the value of key, it is default constructed when missing.
+    auto operator[](const key_type& key) -> V& { return try_emplace(key).first->second; }
+
+    //! @returns a reference to the value of key, it is default constructed when missing.
+    auto operator[](key_type&& key) -> V& { return try_emplace(std::move(key)).first->second; }
+
+private:
+    //! Constructs the key and the value from args in the slot prepared at index, so a throwing
+    //! constructor leaves the slot empty.
+    template<typename KK, typename... Args>
+    void construct_entry(typename super::size_type index, KK&& key, Args&&... args) {
+        auto make_key   = [&] { return K(std::forward<KK>(key)); };
+        auto make_value = [&] { return V(std::forward<Args>(args)...); };
+        super::construct_slot(
+          index, detail::DeferredValue{make_key}, detail::DeferredValue{make_value});
+    }
+};
+}  // namespace xme
@@ -0,0 +1,27 @@
+#pragma once
+#include "../../../private/container/hash_table_base.hpp"
+#include "concepts.hpp"
+#include <functional>
+
+namespace xme {
+//! HashSet is an open addressing hash table of unique keys, stored in a flat array.
+//! Every slot has 1 byte of metadata, which is probed a group at a time,
+//! with SSE2 when enabled through xme::hal::enabled_simd, or 64 bit arithmetic otherwise.
+//! Lookup, insertion and erase are O(1) on average.
+//! References and iterators are invalidated on rehash.
+//! Heterogeneous lookup is enabled when both Hash and KeyEqual define is_transparent.
+//! @param K the type of the key
+//! @param Alloc must be an allocator that satisfies the Allocator concept
+template<typename K, typename Hash = std::hash<K>, typename KeyEqual = std::equal_to<K>,
+         CAllocator Alloc = std::allocator<K>>
+class HashSet : public detail::HashTable<detail::HashSetPolicy<K>, Hash, KeyEqual, Alloc> {
+private:
+    using super = detail::HashTable<detail::HashSetPolicy<K>, Hash, KeyEqual, Alloc>;
+
+public:
+    static_assert(std::is_same_v<K, std::remove_cv_t<K>>,
+                  "xme::HashSet must have a non-const and non-volatile K");
+
+    using super::super;
+};
+}  // namespace xme
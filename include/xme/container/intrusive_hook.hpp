@@ -0,0 +1,75 @@
+#pragma once
+#include <cstddef>
+#include <memory>
+
+namespace xme {
+//! Hook of an IntrusiveList, must be a base or a member of the stored type.
+struct IntrusiveListHook {
+    constexpr IntrusiveListHook() noexcept = default;
+
+    //! Copying an object does not copy its position in a list.
+    constexpr IntrusiveListHook(const IntrusiveListHook&) noexcept {}
+
+    constexpr auto operator=(const IntrusiveListHook&) noexcept -> IntrusiveListHook& {
+        return *this;
+    }
+
+    [[nodiscard]]
+    constexpr bool is_linked() const noexcept {
+        return next != nullptr;
+    }
+
+    IntrusiveListHook* next = nullptr;
+    IntrusiveListHook* prev = nullptr;
+};
+
+//! Hook of an IntrusiveSList, must be a base or a member of the stored type.
+struct IntrusiveSListHook {
+    constexpr IntrusiveSListHook() noexcept = default;
+
+    //! Copying an object does not copy its position in a list.
+    constexpr IntrusiveSListHook(const IntrusiveSListHook&) noexcept {}
+
+    constexpr auto operator=(const IntrusiveSListHook&) noexcept -> IntrusiveSListHook& {
+        return *this;
+    }
+
+    IntrusiveSListHook* next = nullptr;
+};
+
+//! Uses a Hook base class of T.
+template<typename T, typename Hook = IntrusiveListHook>
+struct BaseHook {
+    using value_type = T;
+    using hook_type  = Hook;
+
+    static constexpr auto to_hook(T& value) noexcept -> Hook* { return std::addressof(value); }
+
+    static constexpr auto to_value(Hook* hook) noexcept -> T* { return static_cast<T*>(hook); }
+};
+
+template<auto Member>
+struct MemberHook;
+
+//! Uses the Hook member of T pointed by Member.
+template<typename T, typename Hook, Hook T::*Member>
+struct MemberHook<Member> {
+    using value_type = T;
+    using hook_type  = Hook;
+
+    static constexpr auto to_hook(T& value) noexcept -> Hook* {
+        return std::addressof(value.*Member);
+    }
+
+    static auto to_value(Hook* hook) noexcept -> T* {
+        return reinterpret_cast<T*>(reinterpret_cast<std::byte*>(hook) - offset());
+    }
+
+private:
+    static auto offset() noexcept -> std::ptrdiff_t {
+        alignas(T) static std::byte storage[sizeof(T)];
+        const T* object = reinterpret_cast<const T*>(storage);
+        return reinterpret_cast<const std::byte*>(std::addressof(object->*Member)) - storage;
+    }
+};
+}  // namespace xme
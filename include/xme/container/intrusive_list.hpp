@@ -0,0 +1,275 @@
+#pragma once
+#include "intrusive_hook.hpp"
+#include <cassert>
+#include <iterator>
+#include <utility>
+
+namespace xme {
+//! IntrusiveList is a doubly linked list of objects that hold their own IntrusiveListHook,
+//! so it never allocates and never copies or destroys the objects.
+//! An object can only be in one list per hook, and must outlive its time in the list.
+//! insert, erase, splice and iterator_to are O(1).
+//! @param T the type of the linked objects
+//! @param Hook how to reach the hook from T, BaseHook<T> or MemberHook<&T::member>
+template<typename T, typename Hook = BaseHook<T>>
+class IntrusiveList {
+private:
+    using hook = IntrusiveListHook;
+
+    template<bool Const>
+    class Iterator;
+
+public:
+    static_assert(std::is_same_v<typename Hook::hook_type, IntrusiveListHook>,
+                  "xme::IntrusiveList must use an IntrusiveListHook");
+
+    using value_type      = T;
+    using size_type       = std::size_t;
+    using difference_type = std::ptrdiff_t;
+    using reference       = T&;
+    using const_reference = const T&;
+    using pointer         = T*;
+    using const_pointer   = const T*;
+    using iterator        = Iterator<false>;
+    using const_iterator  = Iterator<true>;
+
+    constexpr IntrusiveList() noexcept { m_head.next = m_head.prev = &m_head; }
+
+    IntrusiveList(const IntrusiveList&) = delete;
+
+    constexpr IntrusiveList(IntrusiveList&& other) noexcept : IntrusiveList() {
+        splice(end(), other);
+    }
+
+    auto operator=(const IntrusiveList&) -> IntrusiveList& = delete;
+
+    constexpr auto operator=(IntrusiveList&& other) noexcept -> IntrusiveList& {
+        clear();
+        splice(end(), other);
+        return *this;
+    }
+
+    //! Unlinks every object.
+    constexpr ~IntrusiveList() { clear(); }
+
+    [[nodiscard]]
+    constexpr auto begin() noexcept -> iterator {
+        return {m_head.next};
+    }
+
+    [[nodiscard]]
+    constexpr auto end() noexcept -> iterator {
+        return {&m_head};
+    }
+
+    [[nodiscard]]
+    constexpr auto begin() const noexcept -> const_iterator {
+        return {m_head.next};
+    }
+
+    [[nodiscard]]
+    constexpr auto end() const noexcept -> const_iterator {
+        return {const_cast<hook*>(&m_head)};
+    }
+
+    [[nodiscard]]
+    constexpr auto cbegin() const noexcept -> const_iterator {
+        return begin();
+    }
+
+    [[nodiscard]]
+    constexpr auto cend() const noexcept -> const_iterator {
+        return end();
+    }
+
+    [[nodiscard]]
+    constexpr auto front() noexcept -> reference {
+        assert(!empty());
+        return *begin();
+    }
+
+    [[nodiscard]]
+    constexpr auto back() noexcept -> reference {
+        assert(!empty());
+        return *Hook::to_value(m_head.prev);
+    }
+
+    [[nodiscard]]
+    constexpr auto size() const noexcept -> size_type {
+        return m_size;
+    }
+
+    [[nodiscard]]
+    constexpr bool empty() const noexcept {
+        return m_size == 0;
+    }
+
+    //! @returns an iterator to value, which must be in this list, O(1).
+    [[nodiscard]]
+    static constexpr auto iterator_to(T& value) noexcept -> iterator {
+        return {Hook::to_hook(value)};
+    }
+
+    constexpr void push_front(T& value) noexcept { insert(begin(), value); }
+
+    constexpr void push_back(T& value) noexcept { insert(end(), value); }
+
+    constexpr void pop_front() noexcept { erase(begin()); }
+
+    constexpr void pop_back() noexcept { erase(iterator{m_head.prev}); }
+
+    //! Links value before pos, value must not be in a list.
+    //! @returns an iterator to value
+    constexpr auto insert(const_iterator pos, T& value) noexcept -> iterator {
+        hook* node = Hook::to_hook(value);
+        assert(!node->is_linked());
+        hook* next       = pos.m_node;
+        node->next       = next;
+        node->prev       = next->prev;
+        next->prev->next = node;
+        next->prev       = node;
+        ++m_size;
+        return {node};
+    }
+
+    //! Unlinks the object at pos.
+    //! @returns an iterator to the object after it
+    constexpr auto erase(const_iterator pos) noexcept -> iterator {
+        assert(pos != end());
+        hook* node = pos.m_node;
+        hook* next = node->next;
+        unlink(node);
+        --m_size;
+        return {next};
+    }
+
+    //! Unlinks value, which must be in this list, O(1).
+    constexpr void remove(T& value) noexcept { erase(iterator_to(value)); }
+
+    //! Unlinks every object that satisfies pred.
+    //! @returns the amount of unlinked objects
+    template<typename Pred>
+    constexpr auto remove_if(Pred pred) -> size_type {
+        const size_type old_size = m_size;
+        for(auto it = begin(); it != end();) {
+            if(pred(*it))
+                it = erase(it);
+            else
+                ++it;
+        }
+        return old_size - m_size;
+    }
+
+    //! Unlinks every object, O(N).
+    constexpr void clear() noexcept {
+        hook* node = m_head.next;
+        while(node != &m_head) {
+            hook* next = node->next;
+            node->next = node->prev = nullptr;
+            node       = next;
+        }
+        m_head.next = m_head.prev = &m_head;
+        m_size                    = 0;
+    }
+
+    //! Moves every object of other before pos, O(1).
+    constexpr void splice(const_iterator pos, IntrusiveList& other) noexcept {
+        if(other.empty())
+            return;
+        hook* first = other.m_head.next;
+        hook* last  = other.m_head.prev;
+        hook* next  = pos.m_node;
+
+        first->prev      = next->prev;
+        next->prev->next = first;
+        last->next       = next;
+        next->prev       = last;
+
+        m_size += other.m_size;
+        other.m_head.next = other.m_head.prev = &other.m_head;
+        other.m_size                          = 0;
+    }
+
+    //! Moves the object at it from other before pos, O(1).
+    constexpr void splice(const_iterator pos, IntrusiveList& other, const_iterator it) noexcept {
+        T& value = const_cast<T&>(*it);
+        other.erase(it);
+        insert(pos, value);
+    }
+
+    //! Reverses the order of the objects, O(N).
+    constexpr void reverse() noexcept {
+        hook* node = &m_head;
+        do {
+            std::swap(node->next, node->prev);
+            node = node->prev;
+        } while(node != &m_head);
+    }
+
+private:
+    static constexpr void unlink(hook* node) noexcept {
+        node->prev->next = node->next;
+        node->next->prev = node->prev;
+        node->next = node->prev = nullptr;
+    }
+
+    hook m_head;
+    size_type m_size = 0;
+};
+
+template<typename T, typename Hook>
+template<bool Const>
+class IntrusiveList<T, Hook>::Iterator {
+private:
+    friend class IntrusiveList;
+
+public:
+    using difference_type   = std::ptrdiff_t;
+    using value_type        = T;
+    using reference         = std::conditional_t<Const, const T&, T&>;
+    using pointer           = std::conditional_t<Const, const T*, T*>;
+    using iterator_category = std::bidirectional_iterator_tag;
+
+    template<bool>
+    friend class Iterator;
+
+    constexpr Iterator() noexcept = default;
+
+    constexpr Iterator(hook* node) noexcept : m_node(node) {}
+
+    constexpr Iterator(const Iterator<!Const>& it) noexcept
+        requires(Const)
+      : m_node(it.m_node) {}
+
+    constexpr auto operator*() const noexcept -> reference { return *Hook::to_value(m_node); }
+
+    constexpr auto operator->() const noexcept -> pointer { return Hook::to_value(m_node); }
+
+    constexpr auto operator++() noexcept -> Iterator& {
+        m_node = m_node->next;
+        return *this;
+    }
+
+    constexpr auto operator++(int) noexcept -> Iterator {
+        Iterator tmp{*this};
+        m_node = m_node->next;
+        return tmp;
+    }
+
+    constexpr auto operator--() noexcept -> Iterator& {
+        m_node = m_node->prev;
+        return *this;
+    }
+
+    constexpr auto operator--(int) noexcept -> Iterator {
+        Iterator tmp{*this};
+        m_node = m_node->prev;
+        return tmp;
+    }
+
+    constexpr bool operator==(const Iterator& rhs) const noexcept = default;
+
+private:
+    hook* m_node = nullptr;
+};
+}  // namespace xme
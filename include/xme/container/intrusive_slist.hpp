@@ -0,0 +1,257 @@
+#pragma once
+#include "intrusive_hook.hpp"
+#include <cassert>
+#include <iterator>
+#include <utility>
+
+namespace xme {
+//! IntrusiveSList is a singly linked list of objects that hold their own IntrusiveSListHook,
+//! so it never allocates and never copies or destroys the objects.
+//! An object can only be in one list per hook, and must outlive its time in the list.
+//! insert_after, erase_after and iterator_to are O(1).
+//! @param T the type of the linked objects
+//! @param Hook how to reach the hook from T,
+//! BaseHook<T, IntrusiveSListHook> or MemberHook<&T::member>
+template<typename T, typename Hook = BaseHook<T, IntrusiveSListHook>>
+class IntrusiveSList {
+private:
+    using hook = IntrusiveSListHook;
+
+    template<bool Const>
+    class Iterator;
+
+public:
+    static_assert(std::is_same_v<typename Hook::hook_type, IntrusiveSListHook>,
+                  "xme::IntrusiveSList must use an IntrusiveSListHook");
+
+    using value_type      = T;
+    using size_type       = std::size_t;
+    using difference_type = std::ptrdiff_t;
+    using reference       = T&;
+    using const_reference = const T&;
+    using pointer         = T*;
+    using const_pointer   = const T*;
+    using iterator        = Iterator<false>;
+    using const_iterator  = Iterator<true>;
+
+    constexpr IntrusiveSList() noexcept = default;
+
+    IntrusiveSList(const IntrusiveSList&) = delete;
+
+    constexpr IntrusiveSList(IntrusiveSList&& other) noexcept :
+      m_size(std::exchange(other.m_size, 0)) {
+        m_head.next = std::exchange(other.m_head.next, nullptr);
+    }
+
+    auto operator=(const IntrusiveSList&) -> IntrusiveSList& = delete;
+
+    constexpr auto operator=(IntrusiveSList&& other) noexcept -> IntrusiveSList& {
+        clear();
+        m_head.next = std::exchange(other.m_head.next, nullptr);
+        m_size      = std::exchange(other.m_size, 0);
+        return *this;
+    }
+
+    //! Unlinks every object.
+    constexpr ~IntrusiveSList() { clear(); }
+
+    //! @returns an iterator before the first object, which must not be dereferenced.
+    [[nodiscard]]
+    constexpr auto before_begin() noexcept -> iterator {
+        return {&m_head};
+    }
+
+    [[nodiscard]]
+    constexpr auto before_begin() const noexcept -> const_iterator {
+        return {const_cast<hook*>(&m_head)};
+    }
+
+    [[nodiscard]]
+    constexpr auto begin() noexcept -> iterator {
+        return {m_head.next};
+    }
+
+    [[nodiscard]]
+    constexpr auto end() noexcept -> iterator {
+        return {};
+    }
+
+    [[nodiscard]]
+    constexpr auto begin() const noexcept -> const_iterator {
+        return {m_head.next};
+    }
+
+    [[nodiscard]]
+    constexpr auto end() const noexcept -> const_iterator {
+        return {};
+    }
+
+    [[nodiscard]]
+    constexpr auto cbegin() const noexcept -> const_iterator {
+        return begin();
+    }
+
+    [[nodiscard]]
+    constexpr auto cend() const noexcept -> const_iterator {
+        return end();
+    }
+
+    [[nodiscard]]
+    constexpr auto front() noexcept -> reference {
+        assert(!empty());
+        return *begin();
+    }
+
+    [[nodiscard]]
+    constexpr auto size() const noexcept -> size_type {
+        return m_size;
+    }
+
+    [[nodiscard]]
+    constexpr bool empty() const noexcept {
+        return m_size == 0;
+    }
+
+    //! @returns an iterator to value, which must be in this list, O(1).
+    [[nodiscard]]
+    static constexpr auto iterator_to(T& value) noexcept -> iterator {
+        return {Hook::to_hook(value)};
+    }
+
+    constexpr void push_front(T& value) noexcept { insert_after(before_begin(), value); }
+
+    constexpr void pop_front() noexcept { erase_after(before_begin()); }
+
+    //! Links value after pos, value must not be in a list.
+    //! @returns an iterator to value
+    constexpr auto insert_after(const_iterator pos, T& value) noexcept -> iterator {
+        hook* node       = Hook::to_hook(value);
+        node->next       = pos.m_node->next;
+        pos.m_node->next = node;
+        ++m_size;
+        return {node};
+    }
+
+    //! Unlinks the object after pos.
+    //! @returns an iterator to the object after the unlinked one
+    constexpr auto erase_after(const_iterator pos) noexcept -> iterator {
+        hook* node = pos.m_node->next;
+        assert(node != nullptr);
+        pos.m_node->next = node->next;
+        node->next       = nullptr;
+        --m_size;
+        return {pos.m_node->next};
+    }
+
+    //! Unlinks every object that satisfies pred.
+    //! @returns the amount of unlinked objects
+    template<typename Pred>
+    constexpr auto remove_if(Pred pred) -> size_type {
+        const size_type old_size = m_size;
+        for(auto prev = before_begin(); prev.m_node->next != nullptr;) {
+            if(pred(*Hook::to_value(prev.m_node->next)))
+                erase_after(prev);
+            else
+                ++prev;
+        }
+        return old_size - m_size;
+    }
+
+    //! Unlinks every object, O(N).
+    constexpr void clear() noexcept {
+        hook* node = m_head.next;
+        while(node) {
+            hook* next = node->next;
+            node->next = nullptr;
+            node       = next;
+        }
+        m_head.next = nullptr;
+        m_size      = 0;
+    }
+
+    //! Moves every object of other after pos, O(other.size()).
+    constexpr void splice_after(const_iterator pos, IntrusiveSList& other) noexcept {
+        if(other.empty())
+            return;
+        hook* last = other.m_head.next;
+        while(last->next)
+            last = last->next;
+
+        last->next       = pos.m_node->next;
+        pos.m_node->next = other.m_head.next;
+        m_size += other.m_size;
+        other.m_head.next = nullptr;
+        other.m_size      = 0;
+    }
+
+    //! Moves the object after it from other after pos, O(1).
+    constexpr void splice_after(const_iterator pos, IntrusiveSList& other,
+                                const_iterator it) noexcept {
+        T& value = *Hook::to_value(it.m_node->next);
+        other.erase_after(it);
+        insert_after(pos, value);
+    }
+
+    //! Reverses the order of the objects, O(N).
+    constexpr void reverse() noexcept {
+        hook* reversed = nullptr;
+        hook* node     = m_head.next;
+        while(node) {
+            hook* next = node->next;
+            node->next = reversed;
+            reversed   = node;
+            node       = next;
+        }
+        m_head.next = reversed;
+    }
+
+private:
+    hook m_head;
+    size_type m_size = 0;
+};
+
+template<typename T, typename Hook>
+template<bool Const>
+class IntrusiveSList<T, Hook>::Iterator {
+private:
+    friend class IntrusiveSList;
+
+public:
+    using difference_type   = std::ptrdiff_t;
+    using value_type        = T;
+    using reference         = std::conditional_t<Const, const T&, T&>;
+    using pointer           = std::conditional_t<Const, const T*, T*>;
+    using iterator_category = std::forward_iterator_tag;
+
+    template<bool>
+    friend class Iterator;
+
+    constexpr Iterator() noexcept = default;
+
+    constexpr Iterator(hook* node) noexcept : m_node(node) {}
+
+    constexpr Iterator(const Iterator<!Const>& it) noexcept
+        requires(Const)
+      : m_node(it.m_node) {}
+
+    constexpr auto operator*() const noexcept -> reference { return *Hook::to_value(m_node); }
+
+    constexpr auto operator->() const noexcept -> pointer { return Hook::to_value(m_node); }
+
+    constexpr auto operator++() noexcept -> Iterator& {
+        m_node = m_node->next;
+        return *this;
+    }
+
+    constexpr auto operator++(int) noexcept -> Iterator {
+        Iterator tmp{*this};
+        m_node = m_node->next;
+        return tmp;
+    }
+
+    constexpr bool operator==(const Iterator& rhs) const noexcept = default;
+
+private:
+    hook* m_node = nullptr;
+};
+}  // namespace xme
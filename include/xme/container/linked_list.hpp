@@ -1,8 +1,15 @@
 #pragma once
 #include "../../../private/container/linked_list_base.hpp"
+#include "array.hpp"
 #include "concepts.hpp"
+#include "pair.hpp"
+#include <algorithm>
+#include <cassert>
+#include <functional>
 #include <iterator>
 #include <memory>
+#include <ranges>
+#include <utility>
 
 namespace xme {
 //! LinkedList is a singly linked list.
@@ -11,7 +18,8 @@ namespace xme {
 //! insert at the middle is O(n).
 //! @param T the type of the stored element
 //! @param Alloc must be an allocator that satisfies the Allocator concept
-template<typename T, typename Alloc = std::allocator<T>>
+//! @param TrackSize keeps the amount of elements, which enables size()
+template<typename T, typename Alloc = std::allocator<T>, bool TrackSize = false>
 class LinkedList {
 private:
     using node_base = detail::LinkedListNodeBase;
@@ -26,6 +34,11 @@ public:
     using allocator_type =
       typename std::allocator_traits<Alloc>::template rebind_alloc<detail::LinkedListNode<T>>;
 
+private:
+    using alloc_traits = std::allocator_traits<allocator_type>;
+
+public:
+
     using value_type      = T;
     using pointer         = T*;
     using const_pointer   = const T*;
@@ -34,10 +47,21 @@ public:
     using iterator        = detail::LinkedListIterator<T>;
     using const_iterator  = detail::LinkedListConstIterator<T>;
 
-    constexpr LinkedList() noexcept = default;
+    using prefetch_iterator       = detail::LinkedListPrefetchIterator<T>;
+    using const_prefetch_iterator = detail::LinkedListPrefetchIterator<const T>;
+
+    //! Nodes prefetched ahead of the current one by default during a prefetching traversal.
+    static constexpr std::size_t default_prefetch_distance = 8;
+
+    constexpr LinkedList()
+      noexcept(std::is_nothrow_default_constructible_v<allocator_type>) = default;
+
+    //! Creates an empty LinkedList whose nodes are allocated with alloc
+    explicit constexpr LinkedList(const Alloc& alloc) noexcept : m_allocator(alloc) {}
 
     //! Default constructs N nodes
     explicit constexpr LinkedList(std::size_t n) {
+        reserve_nodes(n);
         node_base* curr = &m_head;
         for(; n > 0; --n) {
             curr->next = create_node();
@@ -47,6 +71,7 @@ public:
 
     //! Constructs N nodes with value
     constexpr LinkedList(std::size_t n, const T& value) {
+        reserve_nodes(n);
         node_base* curr = &m_head;
         for(; n > 0; --n) {
             curr->next = create_node(value);
@@ -78,7 +103,8 @@ public:
     }
 
     //! Constructs a LinkedList by transfering elements from other
-    explicit constexpr LinkedList(LinkedList&& other) noexcept {
+    explicit constexpr LinkedList(LinkedList&& other) noexcept :
+      m_allocator(other.m_allocator), m_size(std::exchange(other.m_size, {})) {
         m_head.next       = other.m_head.next;
         other.m_head.next = nullptr;
     }
@@ -95,6 +121,9 @@ public:
     constexpr auto operator=(LinkedList&& other) noexcept -> LinkedList& {
         clear();
         std::ranges::swap(m_head.next, other.m_head.next);
+        std::ranges::swap(m_size, other.m_size);
+        if constexpr(alloc_traits::propagate_on_container_move_assignment::value)
+            m_allocator = other.m_allocator;
         return *this;
     }
 
@@ -135,6 +164,14 @@ public:
     //! Returns true if there are no elements in the LinkedList
     constexpr bool is_empty() const noexcept { return m_head.next == nullptr; }
 
+    //! Returns the amount of elements, O(1).
+    [[nodiscard]]
+    constexpr auto size() const noexcept -> std::size_t
+        requires(TrackSize)
+    {
+        return m_size.value;
+    }
+
     //! Erases every element in the LinkedList
     constexpr void clear() noexcept { erase_after(before_begin(), nullptr); }
 
@@ -194,6 +231,8 @@ public:
     //! @returns an iterator to the last inserted element.
     template<std::input_iterator Iter, std::sentinel_for<Iter> Sent>
     constexpr auto insert_after(const_iterator pos, Iter first, Sent last) -> iterator {
+        if constexpr(std::forward_iterator<Iter>)
+            reserve_nodes(std::ranges::distance(first, last));
         for(; first != last; ++first)
             pos = emplace_after(pos, *first);
         return iterator(const_cast<node_base*>(pos.current_node));
@@ -224,6 +263,7 @@ public:
         const_cast<node_base*>(pos.current_node)->next = tmp->next;
         std::ranges::destroy_at(static_cast<node*>(tmp)->storage.data());
         m_allocator.deallocate(static_cast<node*>(tmp), 1);
+        m_size.sub(1);
     }
 
     //! Erases the node after pos until one before last
@@ -234,6 +274,7 @@ public:
             node* const tmp{static_cast<node*>(curr->next)};
             std::ranges::destroy_at(curr->storage.data());
             m_allocator.deallocate(curr, 1);
+            m_size.sub(1);
             curr = tmp;
         }
         const_cast<node_base*>(pos.current_node)->next = const_cast<node_base*>(last.current_node);
@@ -253,6 +294,222 @@ public:
         }
     }
 
+    //! Moves every element of other after pos, without copying or allocating.
+    //! O(other.size()), to find the last node of other. The allocators must be equal.
+    constexpr void splice_after(const_iterator pos, LinkedList& other) noexcept {
+        splice_after(pos, other, other.before_begin(), other.end());
+    }
+
+    //! Moves the element after it from other after pos, O(1).
+    constexpr void splice_after(const_iterator pos, LinkedList& other,
+                                const_iterator it) noexcept {
+        assert(m_allocator == other.m_allocator);
+        node_base* to    = const_cast<node_base*>(pos.current_node);
+        node_base* prev  = const_cast<node_base*>(it.current_node);
+        node_base* moved = prev->next;
+        if(to == prev || to == moved)
+            return;
+        prev->next  = moved->next;
+        moved->next = to->next;
+        to->next    = moved;
+        other.m_size.sub(1);
+        m_size.add(1);
+    }
+
+    //! Moves the elements in (first, last) from other after pos.
+    //! O(distance(first, last)), to find the last moved node.
+    constexpr void splice_after(const_iterator pos, LinkedList& other, const_iterator first,
+                                const_iterator last) noexcept {
+        assert(m_allocator == other.m_allocator);
+        node_base* before = const_cast<node_base*>(first.current_node);
+        if(before->next == last.current_node)
+            return;
+        node_base* tail = before->next;
+        std::size_t n   = 1;
+        for(; tail->next != last.current_node; tail = tail->next)
+            ++n;
+
+        node_base* to    = const_cast<node_base*>(pos.current_node);
+        node_base* moved = before->next;
+        before->next     = tail->next;
+        tail->next       = to->next;
+        to->next         = moved;
+        other.m_size.sub(n);
+        m_size.add(n);
+    }
+
+    //! Moves the elements of other into this list, both must be sorted by comp.
+    //! The result is sorted and stable, elements of this list go before the equal
+    //! elements of other. No element is copied and no node is allocated, O(N + M).
+    //! The allocators must be equal.
+    template<typename Compare = std::less<>>
+    constexpr void merge(LinkedList& other, Compare comp = {}) {
+        if(this == &other)
+            return;
+        assert(m_allocator == other.m_allocator);
+        m_head.next       = merge_nodes(m_head.next, other.m_head.next, comp);
+        other.m_head.next = nullptr;
+        m_size.take(other.m_size);
+    }
+
+    template<typename Compare = std::less<>>
+    constexpr void merge(LinkedList&& other, Compare comp = {}) {
+        merge(other, comp);
+    }
+
+    //! Sorts the elements by relinking the nodes with a bottom up merge sort.
+    //! Runs of 2^i nodes are kept in bins and merged like a binary counter,
+    //! so merges happen while the nodes are still in cache.
+    //! The sort is stable, O(N log N) and uses O(1) extra space.
+    template<typename Compare = std::less<>>
+    constexpr void sort(Compare comp = {}) {
+        node_base* bins[64]{};
+        std::size_t used = 0;
+        node_base* curr  = m_head.next;
+        while(curr) {
+            node_base* carry = curr;
+            curr             = curr->next;
+            carry->next      = nullptr;
+
+            std::size_t i = 0;
+            for(; i < used && bins[i]; ++i) {
+                carry   = merge_nodes(bins[i], carry, comp);
+                bins[i] = nullptr;
+            }
+            bins[i] = carry;
+            used    = std::max(used, i + 1);
+        }
+
+        node_base* sorted = nullptr;
+        for(std::size_t i = 0; i < used; ++i)
+            sorted = merge_nodes(bins[i], sorted, comp);
+        m_head.next = sorted;
+    }
+
+    //! Erases every element that satisfies pred in a single pass.
+    //! @returns the amount of erased elements.
+    template<typename Pred>
+    constexpr auto remove_if(Pred pred) -> std::size_t {
+        std::size_t erased = 0;
+        node_base* prev    = &m_head;
+        while(prev->next) {
+            if(pred(value_of(prev->next))) {
+                erase_after(prev);
+                ++erased;
+            }
+            else
+                prev = prev->next;
+        }
+        return erased;
+    }
+
+    //! Erases every element equal to value, which may be an element of the list.
+    //! @returns the amount of erased elements.
+    constexpr auto remove(const T& value) -> std::size_t {
+        // The node holding value is unlinked to aliased and only destroyed after the pass
+        node_base aliased;
+        std::size_t erased = 0;
+        node_base* prev    = &m_head;
+        while(node_base* curr = prev->next) {
+            if(!(value_of(curr) == value)) {
+                prev = curr;
+                continue;
+            }
+            if(std::addressof(value_of(curr)) == std::addressof(value)) {
+                prev->next   = curr->next;
+                aliased.next = curr;
+                curr->next   = nullptr;
+            }
+            else
+                erase_after(prev);
+            ++erased;
+        }
+        if(aliased.next)
+            erase_after(&aliased);
+        return erased;
+    }
+
+    //! Erases every element equal to the element before it, according to pred.
+    //! @returns the amount of erased elements.
+    template<typename BinaryPred = std::equal_to<>>
+    constexpr auto unique(BinaryPred pred = {}) -> std::size_t {
+        std::size_t erased = 0;
+        node_base* curr    = m_head.next;
+        while(curr && curr->next) {
+            if(pred(value_of(curr), value_of(curr->next))) {
+                erase_after(curr);
+                ++erased;
+            }
+            else
+                curr = curr->next;
+        }
+        return erased;
+    }
+
+    //! Returns a range over the elements whose iterator prefetches the node distance
+    //! positions ahead, for long traversals of nodes that are scattered in memory.
+    constexpr auto prefetched(std::size_t distance = default_prefetch_distance) noexcept
+      -> std::ranges::subrange<prefetch_iterator, std::default_sentinel_t> {
+        return {prefetch_iterator(m_head.next, distance), std::default_sentinel};
+    }
+
+    //! Returns a range over the elements whose iterator prefetches the node distance
+    //! positions ahead, for long traversals of nodes that are scattered in memory.
+    constexpr auto prefetched(std::size_t distance = default_prefetch_distance) const noexcept
+      -> std::ranges::subrange<const_prefetch_iterator, std::default_sentinel_t> {
+        return {const_prefetch_iterator(m_head.next, distance), std::default_sentinel};
+    }
+
+    //! Calls fn with every element in order, prefetching the node distance positions ahead.
+    template<typename Fn>
+    constexpr void for_each_prefetch(Fn fn, std::size_t distance = default_prefetch_distance) {
+        for(T& value : prefetched(distance))
+            std::invoke(fn, value);
+    }
+
+    //! Calls fn with every element in order, prefetching the node distance positions ahead.
+    template<typename Fn>
+    constexpr void for_each_prefetch(Fn fn,
+                                     std::size_t distance = default_prefetch_distance) const {
+        for(const T& value : prefetched(distance))
+            std::invoke(fn, value);
+    }
+
+    //! Moves the elements between the nodes, so that walking the list visits the nodes
+    //! in ascending address order, which is the allocation order of most allocators.
+    //! A list whose order no longer matches its memory, after sort, splice or insertions
+    //! in the middle, is traversed sequentially again.
+    //! No node is allocated, iterators stay valid but may refer to other elements.
+    //! O(N log N) with O(N) extra space, the list is unchanged if that space can't be allocated.
+    constexpr void compact()
+        requires(std::is_nothrow_swappable_v<T>)
+    {
+        // Every node with the list position of the element it holds.
+        Array<Pair<node_base*, std::size_t>> nodes;
+        if constexpr(TrackSize)
+            nodes.reserve(m_size.value);
+        std::size_t position = 0;
+        for(node_base* curr = m_head.next; curr; curr = curr->next)
+            nodes.push_back(Pair<node_base*, std::size_t>{curr, position++});
+        std::ranges::sort(nodes, std::less<>{}, [](const auto& entry) { return entry.first; });
+
+        // Applies the permutation one cycle at a time, nodes[k] must hold position k.
+        for(std::size_t k = 0; k < nodes.size(); ++k) {
+            while(nodes[k].second != k) {
+                const std::size_t target = nodes[k].second;
+                std::ranges::swap(value_of(nodes[k].first), value_of(nodes[target].first));
+                std::swap(nodes[k].second, nodes[target].second);
+            }
+        }
+
+        node_base* tail = &m_head;
+        for(auto& entry : nodes) {
+            tail->next = entry.first;
+            tail       = entry.first;
+        }
+        tail->next = nullptr;
+    }
+
 private:
     template<typename... Args>
     constexpr auto create_node(Args&&... args) -> node* {
@@ -265,11 +522,48 @@ private:
             m_allocator.deallocate(new_node, 1);
             throw;
         }
+        m_size.add(1);
         return new_node;
     }
 
+    //! Allocators that support it, like PoolAllocator, carve the next n nodes from
+    //! a single block, so they are allocated at once and are adjacent in memory.
+    constexpr void reserve_nodes(std::size_t n) {
+        if constexpr(requires { m_allocator.reserve(n); })
+            m_allocator.reserve(n);
+    }
+
+    [[nodiscard]]
+    static constexpr auto value_of(node_base* n) noexcept -> T& {
+        return *static_cast<node*>(n)->storage.data();
+    }
+
+    //! Merges two sorted null terminated chains, taking from lhs on ties.
+    //! @returns the first node of the merged chain
+    template<typename Compare>
+    static constexpr auto merge_nodes(node_base* lhs, node_base* rhs, Compare& comp)
+      -> node_base* {
+        node_base head;
+        node_base* tail = &head;
+        while(lhs && rhs) {
+            if(comp(value_of(rhs), value_of(lhs))) {
+                tail->next = rhs;
+                rhs        = rhs->next;
+            }
+            else {
+                tail->next = lhs;
+                lhs        = lhs->next;
+            }
+            tail = tail->next;
+        }
+        tail->next = lhs ? lhs : rhs;
+        return head.next;
+    }
+
     template<std::input_iterator Iter, std::sentinel_for<Iter> Sent>
     constexpr void range_initialize(Iter first, Sent last) {
+        if constexpr(std::forward_iterator<Iter>)
+            reserve_nodes(std::ranges::distance(first, last));
         node_base* curr = &m_head;
         for(; first != last; ++first) {
             curr->next = create_node(*first);
@@ -280,5 +574,7 @@ private:
     node_base m_head;
     [[no_unique_address]]
     allocator_type m_allocator;
+    [[no_unique_address]]
+    detail::LinkedListSize<TrackSize> m_size;
 };
 }  // namespace xme
@@ -0,0 +1,110 @@
+#pragma once
+#include "../../../private/container/linked_list_base.hpp"
+#include <atomic>
+#include <cassert>
+#include <cstdint>
+#include <type_traits>
+#include <xme/hal/architecture_detection.hpp>
+
+namespace xme {
+//! LockFreeStack is an intrusive Treiber stack, a LIFO that many threads may push to
+//! and pop from without taking a lock.
+//! The top pointer carries a 16 bit tag in the upper bits that x86-64 addresses leave
+//! unused, so the stack is only available there. The tag is incremented on every change,
+//! so a node that is popped and pushed back between the load and the compare exchange of
+//! another pop (the ABA problem) makes that compare exchange fail.
+//! A popped node may still be read by a concurrent pop, so its memory must stay
+//! readable while the stack is in use, which is the case for pools and free lists.
+//! @param T the type of the linked objects, must derive from LinkedListHook
+template<typename T = LinkedListHook>
+class LockFreeStack {
+private:
+    using node_base = detail::LinkedListNodeBase;
+
+    // User space addresses on x86-64 fit in 48 bits, the upper 16 bits are 0 unless 5 level
+    // paging is enabled and an address above 2^47 is explicitly requested from mmap
+    static constexpr unsigned tag_shift          = 48;
+    static constexpr std::uintptr_t pointer_mask = (std::uintptr_t(1) << tag_shift) - 1;
+
+public:
+    static_assert(std::is_base_of_v<LinkedListHook, T>,
+                  "xme::LockFreeStack must have a T derived from LinkedListHook");
+    static_assert(XME_ARCH_X86 && sizeof(T*) == 8,
+                  "xme::LockFreeStack needs the 48 bit addresses of x86-64");
+
+    using value_type = T;
+    using pointer    = T*;
+
+    LockFreeStack() noexcept = default;
+
+    LockFreeStack(const LockFreeStack&) = delete;
+
+    auto operator=(const LockFreeStack&) -> LockFreeStack& = delete;
+
+    //! Links value at the top, thread safe.
+    void push(T& value) noexcept { push_chain(value, value); }
+
+    //! Links the chain [first, last] at the top with a single compare exchange, thread safe.
+    //! The nodes must already be linked from first to last through next.
+    void push_chain(T& first, T& last) noexcept {
+        node_base* node    = &first;
+        std::uintptr_t top = m_top.load(std::memory_order_relaxed);
+        do {
+            next_of(&last).store(to_node(top), std::memory_order_relaxed);
+        } while(!m_top.compare_exchange_weak(top, make_top(node, top), std::memory_order_release,
+                                             std::memory_order_relaxed));
+    }
+
+    //! Unlinks the object at the top, thread safe.
+    //! @returns the unlinked object or nullptr if the stack is empty
+    [[nodiscard]]
+    auto pop() noexcept -> T* {
+        std::uintptr_t top = m_top.load(std::memory_order_acquire);
+        while(node_base* node = to_node(top)) {
+            node_base* next = next_of(node).load(std::memory_order_relaxed);
+            if(m_top.compare_exchange_weak(top, make_top(next, top), std::memory_order_acquire,
+                                           std::memory_order_acquire))
+                return static_cast<T*>(node);
+        }
+        return nullptr;
+    }
+
+    //! Unlinks every object at once, thread safe.
+    //! @returns the former top, whose objects stay linked through next, or nullptr
+    [[nodiscard]]
+    auto pop_all() noexcept -> T* {
+        std::uintptr_t top = m_top.load(std::memory_order_relaxed);
+        while(!m_top.compare_exchange_weak(top, make_top(nullptr, top), std::memory_order_acquire,
+                                           std::memory_order_relaxed)) {}
+        return static_cast<T*>(to_node(top));
+    }
+
+    //! The result may be outdated by the time it is used.
+    [[nodiscard]]
+    bool empty() const noexcept {
+        return to_node(m_top.load(std::memory_order_relaxed)) == nullptr;
+    }
+
+private:
+    [[nodiscard]]
+    static auto to_node(std::uintptr_t top) noexcept -> node_base* {
+        return reinterpret_cast<node_base*>(top & pointer_mask);
+    }
+
+    //! @returns node with the tag of the previous top incremented.
+    [[nodiscard]]
+    static auto make_top(node_base* node, std::uintptr_t previous) noexcept -> std::uintptr_t {
+        assert((reinterpret_cast<std::uintptr_t>(node) & ~pointer_mask) == 0);
+        const std::uintptr_t tag = (previous >> tag_shift) + 1;
+        return reinterpret_cast<std::uintptr_t>(node) | (tag << tag_shift);
+    }
+
+    //! next is written by push and read by concurrent pops, so it is accessed atomically.
+    [[nodiscard]]
+    static auto next_of(node_base* node) noexcept -> std::atomic_ref<node_base*> {
+        return std::atomic_ref<node_base*>(node->next);
+    }
+
+    alignas(64) std::atomic<std::uintptr_t> m_top = 0;
+};
+}  // namespace xme
@@ -0,0 +1,255 @@
+#pragma once
+#include "concepts.hpp"
+#include "doubly_linked_list.hpp"
+#include "hash_map.hpp"
+#include "pair.hpp"
+#include <concepts>
+#include <cstddef>
+#include <functional>
+#include <iterator>
+#include <memory>
+#include <utility>
+
+namespace xme {
+//! Weighs every entry of a LRUCache as 1, so its capacity is in entries.
+struct UnitWeigher {
+    template<typename K, typename V>
+    constexpr auto operator()(const K&, const V&) const noexcept -> std::size_t {
+        return 1;
+    }
+};
+
+//! LRUCache keeps at most capacity worth of entries, evicting the least recently used
+//! one when a new entry would not fit.
+//! Entries are kept in a DoublyLinkedList from the most to the least recently used,
+//! and a HashMap indexes the list nodes by key, so get, put and eviction are O(1).
+//! The node of an evicted entry is reused by the entry that caused the eviction,
+//! so a full cache does not allocate.
+//! Pointers to values stay valid until their entry is evicted or erased.
+//! @param K the type of the key
+//! @param V the type of the cached value
+//! @param Weigher returns the weight of an entry from (const K&, const V&),
+//! capacity is the maximum sum of the weights, which are computed on put.
+//! UnitWeigher bounds the amount of entries, a weigher returning a size bounds the bytes.
+//! @param Alloc must be an allocator that satisfies the Allocator concept
+template<typename K, typename V, typename Weigher = UnitWeigher, typename Hash = std::hash<K>,
+         typename KeyEqual = std::equal_to<K>, CAllocator Alloc = std::allocator<Pair<K, V>>>
+class LRUCache {
+private:
+    using list_type = DoublyLinkedList<Pair<K, V>, Alloc>;
+    using index_type =
+      HashMap<K, typename list_type::iterator, Hash, KeyEqual,
+              typename std::allocator_traits<Alloc>::template rebind_alloc<
+                Pair<const K, typename list_type::iterator>>>;
+
+public:
+    static_assert(std::is_invocable_r_v<std::size_t, const Weigher&, const K&, const V&>,
+                  "xme::LRUCache must have a Weigher callable with (const K&, const V&)");
+
+    using key_type       = K;
+    using mapped_type    = V;
+    using value_type     = Pair<K, V>;
+    using size_type      = std::size_t;
+    using weigher_type   = Weigher;
+    using const_iterator = typename list_type::const_iterator;
+
+    //! @param capacity the maximum sum of the weights of the entries
+    explicit LRUCache(size_type capacity, const Weigher& weigher = Weigher()) :
+      m_capacity(capacity),
+      m_weigher(weigher) {}
+
+    LRUCache(const LRUCache&)                    = delete;
+    auto operator=(const LRUCache&) -> LRUCache& = delete;
+
+    LRUCache(LRUCache&& other) noexcept :
+      m_list(std::move(other.m_list)),
+      m_index(std::move(other.m_index)),
+      m_capacity(other.m_capacity),
+      m_weight(std::exchange(other.m_weight, 0)),
+      m_weigher(std::move(other.m_weigher)) {}
+
+    auto operator=(LRUCache&& other) noexcept -> LRUCache& {
+        m_list     = std::move(other.m_list);
+        m_index    = std::move(other.m_index);
+        m_capacity = other.m_capacity;
+        m_weight   = std::exchange(other.m_weight, 0);
+        m_weigher  = std::move(other.m_weigher);
+        return *this;
+    }
+
+    //! Marks the entry of key as the most recently used.
+    //! @returns a pointer to its value, or nullptr if key is not cached
+    [[nodiscard]]
+    auto get(const K& key) -> V* {
+        auto found = m_index.find(key);
+        if(found == m_index.end())
+            return nullptr;
+        auto node = found->second;
+        m_list.splice(m_list.begin(), m_list, node);
+        return &node->second;
+    }
+
+    //! Same as get, without changing the order of eviction.
+    [[nodiscard]]
+    auto peek(const K& key) const -> const V* {
+        auto found = m_index.find(key);
+        return found == m_index.end() ? nullptr : &found->second->second;
+    }
+
+    //! Inserts or assigns the value of key, and marks it as the most recently used.
+    //! Least recently used entries are evicted until it fits.
+    //! @returns a pointer to the cached value, or nullptr if the entry alone weighs more
+    //! than the capacity, in which case key is no longer cached.
+    template<typename KK, typename VV>
+        requires(std::constructible_from<K, KK &&> && std::assignable_from<V&, VV &&>)
+    auto put(KK&& key, VV&& value) -> V* {
+        auto found = m_index.find(key);
+        if(found != m_index.end())
+            return assign(found, std::forward<VV>(value));
+
+        const size_type weight = m_weigher(std::as_const(key), std::as_const(value));
+        if(weight > m_capacity)
+            return nullptr;
+        const bool recycled = evict_until(m_capacity - weight);
+        if(recycled) {
+            // The least recently used node was moved to the front by evict_until.
+            try {
+                m_list.front().first  = std::forward<KK>(key);
+                m_list.front().second = std::forward<VV>(value);
+            }
+            catch(...) {
+                m_list.pop_front();
+                throw;
+            }
+        }
+        else {
+            m_list.emplace_front(std::forward<KK>(key), std::forward<VV>(value));
+        }
+
+        try {
+            m_index.try_emplace(m_list.front().first, m_list.begin());
+        }
+        catch(...) {
+            m_list.pop_front();
+            throw;
+        }
+        m_weight += weight;
+        return &m_list.front().second;
+    }
+
+    //! Removes the entry of key.
+    //! @returns true if key was cached
+    bool erase(const K& key) noexcept {
+        auto found = m_index.find(key);
+        if(found == m_index.end())
+            return false;
+        auto node = found->second;
+        m_weight -= m_weigher(std::as_const(node->first), std::as_const(node->second));
+        m_index.erase(found);
+        m_list.erase(node);
+        return true;
+    }
+
+    //! Changes the capacity, evicting least recently used entries until the cache fits.
+    void set_capacity(size_type capacity) noexcept {
+        m_capacity = capacity;
+        while(m_weight > m_capacity)
+            evict_back();
+    }
+
+    //! Removes every entry
+    void clear() noexcept {
+        m_index.clear();
+        m_list.clear();
+        m_weight = 0;
+    }
+
+    //! Returns true if key is cached, without changing the order of eviction.
+    [[nodiscard]]
+    bool contains(const K& key) const noexcept {
+        return m_index.contains(key);
+    }
+
+    //! Returns true if there are no entries
+    [[nodiscard]]
+    bool is_empty() const noexcept {
+        return m_list.is_empty();
+    }
+
+    //! Returns the amount of entries
+    [[nodiscard]]
+    auto size() const noexcept -> size_type {
+        return m_list.size();
+    }
+
+    //! Returns the sum of the weights of the entries
+    [[nodiscard]]
+    auto weight() const noexcept -> size_type {
+        return m_weight;
+    }
+
+    [[nodiscard]]
+    auto capacity() const noexcept -> size_type {
+        return m_capacity;
+    }
+
+    //! Iterates from the most to the least recently used entry
+    auto begin() const noexcept -> const_iterator { return m_list.begin(); }
+    auto end() const noexcept -> const_iterator { return m_list.end(); }
+
+private:
+    template<typename VV>
+    auto assign(typename index_type::iterator found, VV&& value) -> V* {
+        auto node = found->second;
+        m_list.splice(m_list.begin(), m_list, node);
+        m_weight -= m_weigher(std::as_const(node->first), std::as_const(node->second));
+        node->second           = std::forward<VV>(value);
+        const size_type weight = m_weigher(std::as_const(node->first), std::as_const(node->second));
+        if(weight > m_capacity) {
+            m_index.erase(found);
+            m_list.erase(node);
+            return nullptr;
+        }
+        m_weight += weight;
+        while(m_weight > m_capacity)
+            evict_back();
+        return &node->second;
+    }
+
+    //! Evicts least recently used entries until the weight is at most limit.
+    //! The node of the first evicted entry is kept at the front to be reused when
+    //! the types are assignable.
+    //! @returns true if a node was kept
+    bool evict_until(size_type limit) noexcept {
+        constexpr bool reusable = std::is_nothrow_destructible_v<Pair<K, V>> &&
+                                  std::is_move_assignable_v<K> && std::is_move_assignable_v<V>;
+        bool recycled = false;
+        while(m_weight > limit) {
+            if(reusable && !recycled) {
+                auto last = std::prev(m_list.end());
+                m_weight -= m_weigher(std::as_const(last->first), std::as_const(last->second));
+                m_index.erase(last->first);
+                m_list.splice(m_list.begin(), m_list, last);
+                recycled = true;
+            }
+            else
+                evict_back();
+        }
+        return recycled;
+    }
+
+    void evict_back() noexcept {
+        auto last = std::prev(m_list.end());
+        m_weight -= m_weigher(std::as_const(last->first), std::as_const(last->second));
+        m_index.erase(last->first);
+        m_list.erase(last);
+    }
+
+    list_type m_list;
+    index_type m_index;
+    size_type m_capacity;
+    size_type m_weight = 0;
+    [[no_unique_address]]
+    Weigher m_weigher;
+};
+}  // namespace xme
@@ -0,0 +1,363 @@
+#pragma once
+#include "array_view.hpp"
+#include "container_policy.hpp"
+#include <algorithm>
+#include <cassert>
+#include <cerrno>
+#include <cstdint>
+#include <cstring>
+#include <filesystem>
+#include <system_error>
+#include <type_traits>
+#include <utility>
+#include <xme/hal/platform_macros.hpp>
+
+#if XME_PLATFORM_LINUX || XME_PLATFORM_APPLE
+#    include <fcntl.h>
+#    include <sys/mman.h>
+#    include <sys/stat.h>
+#    include <unistd.h>
+
+namespace xme {
+enum class MapMode {
+    read_only,
+    read_write,
+};
+
+//! Access pattern hints given to the kernel through madvise.
+enum class MapAdvice {
+    normal     = MADV_NORMAL,
+    sequential = MADV_SEQUENTIAL,
+    random     = MADV_RANDOM,
+    will_need  = MADV_WILLNEED,
+    dont_need  = MADV_DONTNEED,
+};
+
+//! MappedArray is a dynamic array of records stored in a memory mapped file.
+//! The file holds the raw elements, so opening it is O(1) and pages are read on demand.
+//! Appending grows the file with ftruncate, the extra capacity is trimmed on close.
+//! Pointers and references are invalidated when the capacity grows.
+//! Writing to a MappedArray opened with MapMode::read_only is undefined.
+//! @param T must be trivially copyable
+template<typename T>
+class MappedArray {
+public:
+    static_assert(std::is_trivially_copyable_v<T>,
+                  "xme::MappedArray must have a trivially copyable T");
+
+    using value_type      = T;
+    using size_type       = std::size_t;
+    using difference_type = std::ptrdiff_t;
+    using reference       = T&;
+    using const_reference = const T&;
+    using pointer         = T*;
+    using const_pointer   = const T*;
+    using iterator        = T*;
+    using const_iterator  = const T*;
+
+    constexpr MappedArray() noexcept = default;
+
+    //! Maps the file at path, it is created when mode is MapMode::read_write.
+    //! @throws std::system_error if the file could not be opened or mapped
+    MappedArray(const std::filesystem::path& path, MapMode mode = MapMode::read_write) {
+        if(!open(path, mode))
+            throw std::system_error(errno, std::generic_category(), "xme::MappedArray");
+    }
+
+    MappedArray(const MappedArray&) = delete;
+
+    MappedArray(MappedArray&& other) noexcept :
+      m_data(std::exchange(other.m_data, nullptr)), m_size(std::exchange(other.m_size, 0)),
+      m_capacity(std::exchange(other.m_capacity, 0)), m_fd(std::exchange(other.m_fd, -1)),
+      m_mode(other.m_mode) {}
+
+    auto operator=(const MappedArray&) -> MappedArray& = delete;
+
+    auto operator=(MappedArray&& other) noexcept -> MappedArray& {
+        swap(other);
+        return *this;
+    }
+
+    ~MappedArray() { close(); }
+
+    //! Maps the file at path, closing the current one.
+    //! A file whose size is not a multiple of sizeof(T) is not opened.
+    //! @returns true if the file was mapped, otherwise errno tells why
+    bool open(const std::filesystem::path& path, MapMode mode = MapMode::read_write) {
+        close();
+        const int flags = mode == MapMode::read_write ? O_RDWR | O_CREAT : O_RDONLY;
+        m_fd            = ::open(path.c_str(), flags | O_CLOEXEC, 0644);
+        if(m_fd == -1)
+            return false;
+
+        struct stat status;
+        if(::fstat(m_fd, &status) == -1)
+            return fail(errno);
+        if(status.st_size % sizeof(T) != 0)
+            return fail(EINVAL);
+        m_mode = mode;
+        m_size = status.st_size / sizeof(T);
+        if(m_size != 0 && !map(m_size))
+            return fail(errno);
+        return true;
+    }
+
+    //! Unmaps the file and trims it to size().
+    void close() noexcept {
+        if(m_fd == -1)
+            return;
+        if(m_data)
+            ::munmap(m_data, m_capacity * sizeof(T));
+        if(m_mode == MapMode::read_write && m_capacity != m_size) {
+            // On failure the file only keeps the unused capacity at the end.
+            [[maybe_unused]] const int result = ::ftruncate(m_fd, m_size * sizeof(T));
+        }
+        ::close(m_fd);
+        m_data     = nullptr;
+        m_size     = 0;
+        m_capacity = 0;
+        m_fd       = -1;
+    }
+
+    [[nodiscard]]
+    bool is_open() const noexcept {
+        return m_fd != -1;
+    }
+
+    [[nodiscard]]
+    auto mode() const noexcept -> MapMode {
+        return m_mode;
+    }
+
+    [[nodiscard]]
+    auto operator[](size_type index) noexcept -> reference {
+        assert(index < size());
+        return m_data[index];
+    }
+
+    [[nodiscard]]
+    auto operator[](size_type index) const noexcept -> const_reference {
+        assert(index < size());
+        return m_data[index];
+    }
+
+    [[nodiscard]]
+    auto front() noexcept -> reference {
+        return (*this)[0];
+    }
+
+    [[nodiscard]]
+    auto front() const noexcept -> const_reference {
+        return (*this)[0];
+    }
+
+    [[nodiscard]]
+    auto back() noexcept -> reference {
+        return (*this)[size() - 1];
+    }
+
+    [[nodiscard]]
+    auto back() const noexcept -> const_reference {
+        return (*this)[size() - 1];
+    }
+
+    [[nodiscard]]
+    auto data() noexcept -> pointer {
+        return m_data;
+    }
+
+    [[nodiscard]]
+    auto data() const noexcept -> const_pointer {
+        return m_data;
+    }
+
+    [[nodiscard]]
+    auto begin() noexcept -> iterator {
+        return m_data;
+    }
+
+    [[nodiscard]]
+    auto end() noexcept -> iterator {
+        return m_data + m_size;
+    }
+
+    [[nodiscard]]
+    auto begin() const noexcept -> const_iterator {
+        return m_data;
+    }
+
+    [[nodiscard]]
+    auto end() const noexcept -> const_iterator {
+        return m_data + m_size;
+    }
+
+    [[nodiscard]]
+    auto cbegin() const noexcept -> const_iterator {
+        return begin();
+    }
+
+    [[nodiscard]]
+    auto cend() const noexcept -> const_iterator {
+        return end();
+    }
+
+    //! @returns a view of every element.
+    [[nodiscard]]
+    auto view() noexcept -> ArrayView<T> {
+        return {m_data, m_size};
+    }
+
+    //! @returns a view of every element.
+    [[nodiscard]]
+    auto view() const noexcept -> ArrayView<const T> {
+        return {m_data, m_size};
+    }
+
+    [[nodiscard]]
+    auto size() const noexcept -> size_type {
+        return m_size;
+    }
+
+    [[nodiscard]]
+    auto capacity() const noexcept -> size_type {
+        return m_capacity;
+    }
+
+    [[nodiscard]]
+    bool empty() const noexcept {
+        return m_size == 0;
+    }
+
+    //! Grows the file to hold at least n elements.
+    //! @throws std::system_error if the file could not be resized or mapped
+    void reserve(size_type n) {
+        assert(is_open() && m_mode == MapMode::read_write);
+        if(n <= m_capacity)
+            return;
+        if(::ftruncate(m_fd, n * sizeof(T)) == -1)
+            throw std::system_error(errno, std::generic_category(), "xme::MappedArray::reserve");
+        if(!map(n)) {
+            const int error = errno;
+            // Shrinks the file back, so it does not keep the capacity that was never mapped
+            [[maybe_unused]] const int result = ::ftruncate(m_fd, m_capacity * sizeof(T));
+            throw std::system_error(error, std::generic_category(), "xme::MappedArray::reserve");
+        }
+    }
+
+    //! Changes the size to n, new elements are zero initialized.
+    void resize(size_type n) {
+        reserve(n);
+        if(n > m_size)
+            std::memset(static_cast<void*>(m_data + m_size), 0, (n - m_size) * sizeof(T));
+        m_size = n;
+    }
+
+    void push_back(const T& value) {
+        if(m_size == m_capacity)
+            reserve(next_capacity(m_size + 1));
+        m_data[m_size++] = value;
+    }
+
+    template<typename... Args>
+    auto emplace_back(Args&&... args) -> reference {
+        if(m_size == m_capacity)
+            reserve(next_capacity(m_size + 1));
+        return *::new(static_cast<void*>(m_data + m_size++)) T(std::forward<Args>(args)...);
+    }
+
+    //! Appends every element of range, growing the file once.
+    template<std::ranges::input_range R>
+        requires(std::convertible_to<std::ranges::range_reference_t<R>, T>)
+    void append_range(R&& range) {
+        if constexpr(std::ranges::sized_range<R>) {
+            const size_type required = m_size + std::ranges::size(range);
+            if(required > m_capacity)
+                reserve(next_capacity(required));
+        }
+        for(auto&& value : range)
+            push_back(value);
+    }
+
+    void pop_back() noexcept {
+        assert(!empty());
+        --m_size;
+    }
+
+    void clear() noexcept { m_size = 0; }
+
+    //! Writes the modified pages back to the file.
+    //! @param async if true, returns before the write completes
+    //! @returns true on success
+    bool flush(bool async = false) noexcept {
+        if(m_data == nullptr)
+            return true;
+        return ::msync(m_data, m_size * sizeof(T), async ? MS_ASYNC : MS_SYNC) == 0;
+    }
+
+    //! Tells the kernel how [first, first + count) is going to be accessed.
+    //! @returns true on success
+    bool advise(MapAdvice advice, size_type first = 0,
+                size_type count = size_type(-1)) const noexcept {
+        if(m_data == nullptr || first >= m_size)
+            return true;
+        count = std::min(count, m_size - first);
+
+        // madvise requires a page aligned address.
+        const auto page  = static_cast<std::uintptr_t>(::sysconf(_SC_PAGESIZE));
+        const auto start = reinterpret_cast<std::uintptr_t>(m_data + first);
+        const auto begin = start & ~(page - 1);
+        const auto bytes = count * sizeof(T) + (start - begin);
+        return ::madvise(reinterpret_cast<void*>(begin), bytes, static_cast<int>(advice)) == 0;
+    }
+
+    void swap(MappedArray& other) noexcept {
+        std::ranges::swap(m_data, other.m_data);
+        std::ranges::swap(m_size, other.m_size);
+        std::ranges::swap(m_capacity, other.m_capacity);
+        std::ranges::swap(m_fd, other.m_fd);
+        std::ranges::swap(m_mode, other.m_mode);
+    }
+
+private:
+    [[nodiscard]]
+    auto next_capacity(size_type required) const noexcept -> size_type {
+        return PageRoundedGrowth<>::next_capacity(m_capacity, required, sizeof(T));
+    }
+
+    //! Closes the file after a failed open, keeping error in errno.
+    bool fail(int error) noexcept {
+        close();
+        errno = error;
+        return false;
+    }
+
+    //! Maps the first n elements of the file, replacing the current mapping.
+    bool map(size_type n) noexcept {
+        const int protection =
+          m_mode == MapMode::read_write ? PROT_READ | PROT_WRITE : PROT_READ;
+        void* address = nullptr;
+#    if XME_PLATFORM_LINUX
+        if(m_data)
+            address = ::mremap(m_data, m_capacity * sizeof(T), n * sizeof(T), MREMAP_MAYMOVE);
+        else
+            address = ::mmap(nullptr, n * sizeof(T), protection, MAP_SHARED, m_fd, 0);
+#    else
+        address = ::mmap(nullptr, n * sizeof(T), protection, MAP_SHARED, m_fd, 0);
+        if(address != MAP_FAILED && m_data)
+            ::munmap(m_data, m_capacity * sizeof(T));
+#    endif
+        if(address == MAP_FAILED)
+            return false;
+        m_data     = static_cast<T*>(address);
+        m_capacity = n;
+        return true;
+    }
+
+    T* m_data           = nullptr;
+    size_type m_size     = 0;
+    size_type m_capacity = 0;
+    int m_fd             = -1;
+    MapMode m_mode       = MapMode::read_only;
+};
+}  // namespace xme
+#endif
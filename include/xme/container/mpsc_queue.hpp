@@ -0,0 +1,89 @@
+#pragma once
+#include "../../../private/container/linked_list_base.hpp"
+#include <atomic>
+#include <type_traits>
+
+namespace xme {
+//! MPSCQueue is an intrusive multi-producer, single-consumer FIFO (Vyukov's node queue).
+//! push is wait-free, a single atomic exchange, and pop is lock-free.
+//! A stub node keeps the queue from ever being empty, so producers never touch the tail.
+//! pop may return nullptr while a push is between its exchange and its link,
+//! in which case the pushed objects become visible when that push completes.
+//! @param T the type of the linked objects, must derive from LinkedListHook
+template<typename T = LinkedListHook>
+class MPSCQueue {
+private:
+    using node_base = detail::LinkedListNodeBase;
+
+public:
+    static_assert(std::is_base_of_v<LinkedListHook, T>,
+                  "xme::MPSCQueue must have a T derived from LinkedListHook");
+
+    using value_type = T;
+    using pointer    = T*;
+
+    MPSCQueue() noexcept = default;
+
+    MPSCQueue(const MPSCQueue&) = delete;
+
+    auto operator=(const MPSCQueue&) -> MPSCQueue& = delete;
+
+    //! Links value at the back, thread safe.
+    void push(T& value) noexcept { push_node(&value); }
+
+    //! Unlinks the object at the front, must only be called by the consumer.
+    //! @returns the unlinked object or nullptr if there is none ready
+    [[nodiscard]]
+    auto pop() noexcept -> T* {
+        node_base* tail = m_tail;
+        node_base* next = next_of(tail).load(std::memory_order_acquire);
+        if(tail == &m_stub) {
+            if(next == nullptr)
+                return nullptr;
+            m_tail = next;
+            tail   = next;
+            next   = next_of(tail).load(std::memory_order_acquire);
+        }
+        if(next) {
+            m_tail = next;
+            return static_cast<T*>(tail);
+        }
+
+        // tail is the last node, unless a producer is linking a new one after it.
+        if(tail != m_head.load(std::memory_order_acquire))
+            return nullptr;
+        push_node(&m_stub);
+        next = next_of(tail).load(std::memory_order_acquire);
+        if(next) {
+            m_tail = next;
+            return static_cast<T*>(tail);
+        }
+        return nullptr;
+    }
+
+    //! Must only be called by the consumer, the result may be outdated by the time it is used.
+    [[nodiscard]]
+    bool empty() const noexcept {
+        return m_tail == &m_stub && next_of(&m_stub).load(std::memory_order_acquire) == nullptr;
+    }
+
+private:
+    void push_node(node_base* node) noexcept {
+        next_of(node).store(nullptr, std::memory_order_relaxed);
+        node_base* prev = m_head.exchange(node, std::memory_order_acq_rel);
+        next_of(prev).store(node, std::memory_order_release);
+    }
+
+    //! next is written by producers and read by the consumer, so it is accessed atomically.
+    [[nodiscard]]
+    static auto next_of(const node_base* node) noexcept -> std::atomic_ref<node_base*> {
+        return std::atomic_ref<node_base*>(const_cast<node_base*>(node)->next);
+    }
+
+    //! The last pushed node, producers exchange it.
+    alignas(64) std::atomic<node_base*> m_head = &m_stub;
+    //! The next node to pop, only used by the consumer.
+    alignas(64) node_base* m_tail = &m_stub;
+    node_base m_stub;
+};
+}  // namespace xme
@@ -0,0 +1,461 @@
+#pragma once
+#include "../../../private/core/byte_load.hpp"
+#include "array.hpp"
+#include "array_view.hpp"
+#include <algorithm>
+#include <bit>
+#include <cassert>
+#include <cstdint>
+#include <xme/hal/simd_detection.hpp>
+
+#if XME_USE_SIMD_AVX2
+#    include <immintrin.h>
+#endif
+
+namespace xme {
+namespace detail {
+#if XME_USE_SIMD_AVX2
+//! Byte shuffle and shifts that move 8 values of width bits into the 32 bit lanes of a
+//! vector, from two 16 byte loads of the block of width bytes that holds them: one at its
+//! start and one at byte 4 * width / 8, where the fifth value starts.
+struct UnpackPattern {
+    __m256i shuffle;
+    __m256i shift;
+};
+
+//! @returns false if a value and its offset in its first byte do not fit in 32 bits.
+inline bool make_unpack_pattern(unsigned width, UnpackPattern& pattern) noexcept {
+    alignas(32) std::int8_t shuffle[32];
+    alignas(32) std::int32_t shift[8];
+    const unsigned second_lane = 4 * width / 8;
+    for(unsigned k = 0; k < 8; ++k) {
+        const unsigned bit = k * width - (k < 4 ? 0 : 8 * second_lane);
+        if(bit % 8 + width > 32)
+            return false;
+        shift[k] = static_cast<std::int32_t>(bit % 8);
+        for(unsigned b = 0; b < 4; ++b) {
+            const unsigned byte = bit / 8 + b;
+            shuffle[4 * k + b]  = byte < 16 ? static_cast<std::int8_t>(byte) : std::int8_t(-128);
+        }
+    }
+    pattern.shuffle = _mm256_load_si256(reinterpret_cast<const __m256i*>(shuffle));
+    pattern.shift   = _mm256_load_si256(reinterpret_cast<const __m256i*>(shift));
+    return true;
+}
+#endif
+}  // namespace detail
+
+//! PackedIntArray is a dynamic array of unsigned integers stored with width bits each,
+//! from 1 to 64, packed back to back in 64 bit words. A column of values below 2^width
+//! uses 64 / width times less memory than an array of std::uint64_t, and scans of it
+//! through unpack read that much less memory.
+//! One word past the values is always allocated, so the decoders can load 8 bytes
+//! from the start of any value.
+//! @param Alloc must be an allocator of std::uint64_t that satisfies the Allocator concept
+template<CAllocator Alloc = std::allocator<std::uint64_t>>
+class PackedIntArray {
+private:
+    static constexpr std::size_t word_bits = 64;
+
+public:
+    static_assert(std::is_same_v<std::uint64_t, typename Alloc::value_type>,
+                  "xme::PackedIntArray must have an allocator of std::uint64_t");
+
+    using allocator_type = Alloc;
+    using word_type      = std::uint64_t;
+    using size_type      = std::size_t;
+    using value_type     = std::uint64_t;
+
+    //! Creates an empty PackedIntArray of 64 bit values.
+    constexpr PackedIntArray() noexcept = default;
+
+    //! Creates an empty PackedIntArray of width bits values.
+    explicit constexpr PackedIntArray(unsigned width,
+                                      const allocator_type& alloc = allocator_type()) noexcept :
+      m_words(alloc),
+      m_width(width),
+      m_mask(mask_for(width)) {
+        assert(width >= 1 && width <= 64);
+    }
+
+    //! Creates a PackedIntArray of n values of width bits equal to value.
+    constexpr PackedIntArray(unsigned width, size_type n, value_type value = 0,
+                             const allocator_type& alloc = allocator_type()) :
+      PackedIntArray(width, alloc) {
+        resize(n, value);
+    }
+
+    //! @returns the smallest width that can store value, at least 1.
+    [[nodiscard]]
+    static constexpr auto width_for(value_type value) noexcept -> unsigned {
+        return value == 0 ? 1 : static_cast<unsigned>(std::bit_width(value));
+    }
+
+    [[nodiscard]]
+    constexpr auto width() const noexcept -> unsigned {
+        return m_width;
+    }
+
+    //! @returns the largest value that can be stored, 2^width - 1.
+    [[nodiscard]]
+    constexpr auto max_value() const noexcept -> value_type {
+        return m_mask;
+    }
+
+    [[nodiscard]]
+    constexpr auto size() const noexcept -> size_type {
+        return m_size;
+    }
+
+    [[nodiscard]]
+    constexpr bool empty() const noexcept {
+        return m_size == 0;
+    }
+
+    [[nodiscard]]
+    constexpr auto capacity() const noexcept -> size_type {
+        return m_words.capacity() == 0 ? 0 : (m_words.capacity() - 1) * word_bits / m_width;
+    }
+
+    //! @returns the words that store the values, the first value is in the lowest bits of
+    //! the first word, followed by the padding word.
+    [[nodiscard]]
+    constexpr auto words() const noexcept -> ArrayView<const word_type> {
+        return {m_words.data(), m_words.size()};
+    }
+
+    [[nodiscard]]
+    constexpr auto operator[](size_type index) const noexcept -> value_type {
+        return get(index);
+    }
+
+    [[nodiscard]]
+    constexpr auto get(size_type index) const noexcept -> value_type {
+        assert(index < m_size);
+        const size_type bit    = index * m_width;
+        const size_type word   = bit / word_bits;
+        const size_type offset = bit % word_bits;
+        value_type value       = m_words[word] >> offset;
+        if(offset + m_width > word_bits)
+            value |= m_words[word + 1] << (word_bits - offset);
+        return value & m_mask;
+    }
+
+    constexpr void set(size_type index, value_type value) noexcept {
+        assert(index < m_size);
+        assert(value <= m_mask);
+        const size_type bit    = index * m_width;
+        const size_type word   = bit / word_bits;
+        const size_type offset = bit % word_bits;
+        m_words[word]          = (m_words[word] & ~(m_mask << offset)) | (value << offset);
+        if(offset + m_width > word_bits) {
+            const size_type high = word_bits - offset;
+            m_words[word + 1]    = (m_words[word + 1] & ~(m_mask >> high)) | (value >> high);
+        }
+    }
+
+    constexpr void push_back(value_type value) {
+        assert(value <= m_mask);
+        grow_words(m_size + 1);
+        ++m_size;
+        set(m_size - 1, value);
+    }
+
+    constexpr void pop_back() noexcept {
+        assert(m_size > 0);
+        resize(m_size - 1);
+    }
+
+    //! Changes the amount of values to n, new values are set to value.
+    constexpr void resize(size_type n, value_type value = 0) {
+        if(n > m_size) {
+            grow_words(n);
+            const size_type old_size = m_size;
+            m_size                   = n;
+            if(value != 0) {
+                for(size_type i = old_size; i < n; ++i)
+                    set(i, value);
+            }
+            return;
+        }
+        m_size = n;
+        while(m_words.size() > words_for(n))
+            m_words.pop_back();
+        clear_tail();
+    }
+
+    constexpr void reserve(size_type n) { m_words.reserve(words_for(n)); }
+
+    constexpr void clear() noexcept {
+        m_words.clear();
+        m_size = 0;
+    }
+
+    //! Decodes the out.size() values from first into out, which is the fastest way to scan
+    //! the array. Uses AVX2 byte shuffles and shifts for 8 values at a time when enabled
+    //! through xme::hal::enabled_simd, and an unaligned 8 byte load per value otherwise.
+    //! The width must be at most 32.
+    constexpr void unpack(size_type first, ArrayView<std::uint32_t> out) const noexcept {
+        assert(m_width <= 32);
+        unpack_values(first, out);
+    }
+
+    //! Decodes the out.size() values from first into out.
+    constexpr void unpack(size_type first, ArrayView<std::uint64_t> out) const noexcept {
+        unpack_values(first, out);
+    }
+
+    [[nodiscard]]
+    friend constexpr bool operator==(const PackedIntArray& lhs,
+                                     const PackedIntArray& rhs) noexcept {
+        return lhs.m_width == rhs.m_width && lhs.m_size == rhs.m_size
+            && std::ranges::equal(lhs.m_words, rhs.m_words);
+    }
+
+private:
+    [[nodiscard]]
+    static constexpr auto mask_for(unsigned width) noexcept -> value_type {
+        return width >= word_bits ? ~value_type(0) : (value_type(1) << width) - 1;
+    }
+
+    //! The words that hold n values and the padding word.
+    [[nodiscard]]
+    constexpr auto words_for(size_type n) const noexcept -> size_type {
+        return n == 0 ? 0 : (n * m_width + word_bits - 1) / word_bits + 1;
+    }
+
+    constexpr void grow_words(size_type n) {
+        const size_type words = words_for(n);
+        if(words > m_words.capacity())
+            m_words.reserve(std::max(words, 2 * m_words.capacity()));
+        while(m_words.size() < words)
+            m_words.push_back(0);
+    }
+
+    //! Clears the bits past the last value, so equal arrays have equal words.
+    constexpr void clear_tail() noexcept {
+        if(m_words.empty())
+            return;
+        const size_type bits = m_size * m_width;
+        m_words.back()       = 0;
+        if(bits % word_bits != 0)
+            m_words[bits / word_bits] &= (word_type(1) << (bits % word_bits)) - 1;
+    }
+
+    template<typename T>
+    constexpr void unpack_values(size_type first, ArrayView<T> out) const noexcept {
+        assert(first + out.size() <= m_size);
+        const size_type n = out.size();
+        size_type i       = 0;
+        if(!std::is_constant_evaluated() && std::endian::native == std::endian::little
+           && m_width <= 57 && n > 0) {
+            const auto* bytes = reinterpret_cast<const std::byte*>(m_words.data());
+#if XME_USE_SIMD_AVX2
+            if constexpr(std::is_same_v<T, std::uint32_t>)
+                i = unpack_avx2(first, out.data(), n, bytes);
+#endif
+            for(; i < n; ++i) {
+                const size_type bit = (first + i) * m_width;
+                out[i] = static_cast<T>((detail::load_le<word_type>(bytes + bit / 8) >> (bit % 8))
+                                        & m_mask);
+            }
+            return;
+        }
+        for(; i < n; ++i)
+            out[i] = static_cast<T>(get(first + i));
+    }
+
+#if XME_USE_SIMD_AVX2
+    //! Decodes blocks of 8 values, which start on a byte, until the loads would pass the
+    //! end of the words.
+    //! @returns the amount of decoded values
+    auto unpack_avx2(size_type first, std::uint32_t* out, size_type n,
+                     const std::byte* bytes) const noexcept -> size_type {
+        detail::UnpackPattern pattern;
+        if(!detail::make_unpack_pattern(m_width, pattern))
+            return 0;
+        // The first values until the index of a block boundary, one by one
+        size_type i = std::min<size_type>(n, (8 - first % 8) % 8);
+        for(size_type j = 0; j < i; ++j)
+            out[j] = static_cast<std::uint32_t>(get(first + j));
+
+        const size_type second_lane = 4 * m_width / 8;
+        const size_type end_bytes   = m_words.size() * sizeof(word_type);
+        const __m256i mask          = _mm256_set1_epi32(static_cast<int>(m_mask));
+        for(; i + 8 <= n; i += 8) {
+            const size_type block = (first + i) / 8 * m_width;
+            if(block + second_lane + 16 > end_bytes)
+                break;
+            const __m128i low  = _mm_loadu_si128(reinterpret_cast<const __m128i*>(bytes + block));
+            const __m128i high = _mm_loadu_si128(
+              reinterpret_cast<const __m128i*>(bytes + block + second_lane));
+            __m256i values = _mm256_inserti128_si256(_mm256_castsi128_si256(low), high, 1);
+            values         = _mm256_shuffle_epi8(values, pattern.shuffle);
+            values         = _mm256_and_si256(_mm256_srlv_epi32(values, pattern.shift), mask);
+            _mm256_storeu_si256(reinterpret_cast<__m256i*>(out + i), values);
+        }
+        return i;
+    }
+#endif
+
+    Array<word_type, Alloc> m_words;
+    size_type m_size  = 0;
+    unsigned m_width  = 64;
+    value_type m_mask = ~value_type(0);
+};
+
+//! FrameOfReference encodes signed integers as their distance to the smallest of them,
+//! packed at the width of the largest distance, so a column of close values, like
+//! timestamps or prices, needs only a few bits per value and keeps random access.
+//! @param Alloc must be an allocator of std::uint64_t that satisfies the Allocator concept
+template<CAllocator Alloc = std::allocator<std::uint64_t>>
+class FrameOfReference {
+public:
+    using allocator_type = Alloc;
+    using size_type      = std::size_t;
+    using value_type     = std::int64_t;
+
+    constexpr FrameOfReference() noexcept = default;
+
+    explicit constexpr FrameOfReference(ArrayView<const value_type> values,
+                                        const allocator_type& alloc = allocator_type()) {
+        if(!values.is_empty())
+            m_base = std::ranges::min(values);
+        std::uint64_t range = 0;
+        for(value_type value : values)
+            range = std::max(range, offset_of(value));
+        m_offsets = PackedIntArray<Alloc>(PackedIntArray<Alloc>::width_for(range), alloc);
+        m_offsets.reserve(values.size());
+        for(value_type value : values)
+            m_offsets.push_back(offset_of(value));
+    }
+
+    //! @returns the smallest value, which the offsets are relative to.
+    [[nodiscard]]
+    constexpr auto base() const noexcept -> value_type {
+        return m_base;
+    }
+
+    [[nodiscard]]
+    constexpr auto offsets() const noexcept -> const PackedIntArray<Alloc>& {
+        return m_offsets;
+    }
+
+    [[nodiscard]]
+    constexpr auto size() const noexcept -> size_type {
+        return m_offsets.size();
+    }
+
+    [[nodiscard]]
+    constexpr auto operator[](size_type index) const noexcept -> value_type {
+        return value_of(m_offsets[index]);
+    }
+
+    //! Decodes the out.size() values from first into out.
+    constexpr void decode(size_type first, ArrayView<value_type> out) const noexcept {
+        for(size_type i = 0; i < out.size(); i += chunk_size) {
+            std::uint64_t offsets[chunk_size];
+            const size_type count = std::min(chunk_size, out.size() - i);
+            m_offsets.unpack(first + i, ArrayView<std::uint64_t>(offsets, count));
+            for(size_type j = 0; j < count; ++j)
+                out[i + j] = value_of(offsets[j]);
+        }
+    }
+
+private:
+    static constexpr size_type chunk_size = 256;
+
+    [[nodiscard]]
+    constexpr auto offset_of(value_type value) const noexcept -> std::uint64_t {
+        return static_cast<std::uint64_t>(value) - static_cast<std::uint64_t>(m_base);
+    }
+
+    [[nodiscard]]
+    constexpr auto value_of(std::uint64_t offset) const noexcept -> value_type {
+        return static_cast<value_type>(static_cast<std::uint64_t>(m_base) + offset);
+    }
+
+    PackedIntArray<Alloc> m_offsets;
+    value_type m_base = 0;
+};
+
+//! DeltaEncoding encodes signed integers as the difference to the previous value, zigzag
+//! encoded so small negative differences stay small, packed at the width of the largest.
+//! Sorted or slowly changing columns, like ids or counters, then need a few bits per value,
+//! but values can only be decoded from the first one.
+//! @param Alloc must be an allocator of std::uint64_t that satisfies the Allocator concept
+template<CAllocator Alloc = std::allocator<std::uint64_t>>
+class DeltaEncoding {
+public:
+    using allocator_type = Alloc;
+    using size_type      = std::size_t;
+    using value_type     = std::int64_t;
+
+    constexpr DeltaEncoding() noexcept = default;
+
+    explicit constexpr DeltaEncoding(ArrayView<const value_type> values,
+                                     const allocator_type& alloc = allocator_type()) {
+        std::uint64_t largest = 0;
+        for(size_type i = 1; i < values.size(); ++i)
+            largest = std::max(largest, zigzag(values[i - 1], values[i]));
+        m_deltas = PackedIntArray<Alloc>(PackedIntArray<Alloc>::width_for(largest), alloc);
+        if(values.is_empty())
+            return;
+        m_first = values[0];
+        m_size  = values.size();
+        m_deltas.reserve(values.size() - 1);
+        for(size_type i = 1; i < values.size(); ++i)
+            m_deltas.push_back(zigzag(values[i - 1], values[i]));
+    }
+
+    //! @returns the first value, which the differences start from.
+    [[nodiscard]]
+    constexpr auto first() const noexcept -> value_type {
+        return m_first;
+    }
+
+    //! @returns the zigzag encoded differences between consecutive values.
+    [[nodiscard]]
+    constexpr auto deltas() const noexcept -> const PackedIntArray<Alloc>& {
+        return m_deltas;
+    }
+
+    [[nodiscard]]
+    constexpr auto size() const noexcept -> size_type {
+        return m_size;
+    }
+
+    //! Decodes the first out.size() values into out.
+    constexpr void decode(ArrayView<value_type> out) const noexcept {
+        assert(out.size() <= size());
+        if(out.is_empty())
+            return;
+        auto value = static_cast<std::uint64_t>(m_first);
+        out[0]     = m_first;
+        for(size_type i = 1; i < out.size(); i += chunk_size) {
+            std::uint64_t deltas[chunk_size];
+            const size_type count = std::min(chunk_size, out.size() - i);
+            m_deltas.unpack(i - 1, ArrayView<std::uint64_t>(deltas, count));
+            for(size_type j = 0; j < count; ++j) {
+                value += (deltas[j] >> 1) ^ (~(deltas[j] & 1) + 1);
+                out[i + j] = static_cast<value_type>(value);
+            }
+        }
+    }
+
+private:
+    static constexpr size_type chunk_size = 256;
+
+    [[nodiscard]]
+    static constexpr auto zigzag(value_type previous, value_type value) noexcept
+      -> std::uint64_t {
+        const std::uint64_t delta =
+          static_cast<std::uint64_t>(value) - static_cast<std::uint64_t>(previous);
+        return (delta << 1) ^ static_cast<std::uint64_t>(static_cast<std::int64_t>(delta) >> 63);
+    }
+
+    PackedIntArray<Alloc> m_deltas;
+    value_type m_first = 0;
+    size_type m_size   = 0;
+};
+}  // namespace xme
@@ -45,6 +45,31 @@ public:
         return static_cast<Pair&&>(*this).second;
     }
 
+    //! Converts to a Pair of other types, like a Pair of references to this one's elements,
+    //! so proxy references such as Pair<const K&, V&> have a common reference with Pair<K, V>.
+    template<typename T2, typename U2>
+        requires(!std::is_same_v<Pair<T2, U2>, Pair> && std::is_convertible_v<T&, T2>
+                 && std::is_convertible_v<U&, U2>)
+    constexpr operator Pair<T2, U2>() & {
+        return {static_cast<T2>(first), static_cast<U2>(second)};
+    }
+
+    template<typename T2, typename U2>
+        requires(!std::is_same_v<Pair<T2, U2>, Pair> && std::is_convertible_v<const T&, T2>
+                 && std::is_convertible_v<const U&, U2>)
+    constexpr operator Pair<T2, U2>() const& {
+        return {static_cast<T2>(first), static_cast<U2>(second)};
+    }
+
+    template<typename T2, typename U2>
+        requires(!std::is_same_v<Pair<T2, U2>, Pair>
+                 && std::is_convertible_v<decltype(std::declval<Pair&&>().first), T2>
+                 && std::is_convertible_v<decltype(std::declval<Pair&&>().second), U2>)
+    constexpr operator Pair<T2, U2>() && {
+        return {static_cast<T2>(static_cast<Pair&&>(*this).first),
+                static_cast<U2>(static_cast<Pair&&>(*this).second)};
+    }
+
     [[nodiscard]]
     XME_CONSTEXPR20 bool operator==(const Pair&) const noexcept = default;
 
@@ -112,4 +137,16 @@ template<typename T, typename U>
 struct tuple_element<1, xme::Pair<T, U>> {
     using type = U;
 };
+
+template<typename T1, typename U1, typename T2, typename U2, template<class> class TQual,
+         template<class> class UQual>
+struct basic_common_reference<xme::Pair<T1, U1>, xme::Pair<T2, U2>, TQual, UQual> {
+    using type = xme::Pair<std::common_reference_t<TQual<T1>, UQual<T2>>,
+                           std::common_reference_t<TQual<U1>, UQual<U2>>>;
+};
+
+template<typename T1, typename U1, typename T2, typename U2>
+struct common_type<xme::Pair<T1, U1>, xme::Pair<T2, U2>> {
+    using type = xme::Pair<std::common_type_t<T1, T2>, std::common_type_t<U1, U2>>;
+};
 }  // namespace std
@@ -0,0 +1,449 @@
+#pragma once
+#include "concepts.hpp"
+#include <algorithm>
+#include <atomic>
+#include <bit>
+#include <cassert>
+#include <memory>
+#include <xme/core/iterators/reverse_iterator.hpp>
+#include <xme/ranges/destroy.hpp>
+
+namespace xme {
+namespace detail {
+template<typename T>
+struct SegmentedArrayTable {
+    T** chunks                    = nullptr;
+    std::size_t capacity          = 0;
+    SegmentedArrayTable* previous = nullptr;  // kept alive for concurrent readers
+};
+
+template<typename T>
+inline constexpr std::size_t default_chunk_size =
+  std::bit_floor(std::max(std::size_t(4096) / sizeof(T), std::size_t(1)));
+}  // namespace detail
+
+//! SegmentedArray is a random access container that stores its elements in fixed size chunks.
+//! Growing never relocates the elements, so pointers and references are stable until the
+//! element is erased.
+//! Access is O(1) with a shift and a mask.
+//! A single writer may push_back while other threads read elements with index < size().
+//! @param T the type of the stored element
+//! @param ChunkSize amount of elements per chunk, must be a power of 2
+//! @param Alloc must be an allocator that satisfies the Allocator concept
+template<typename T, std::size_t ChunkSize = detail::default_chunk_size<T>,
+         CAllocator Alloc = std::allocator<T>>
+class SegmentedArray {
+private:
+    using alloc_traits  = std::allocator_traits<Alloc>;
+    using table         = detail::SegmentedArrayTable<T>;
+    using table_alloc   = typename alloc_traits::template rebind_alloc<table>;
+    using chunks_alloc  = typename alloc_traits::template rebind_alloc<T*>;
+    using table_traits  = std::allocator_traits<table_alloc>;
+    using chunks_traits = std::allocator_traits<chunks_alloc>;
+
+    static constexpr std::size_t chunk_shift = std::countr_zero(ChunkSize);
+    static constexpr std::size_t chunk_mask  = ChunkSize - 1;
+
+    template<bool Const>
+    class Iterator;
+
+public:
+    static_assert(std::has_single_bit(ChunkSize), "ChunkSize must be a power of 2");
+    static_assert(std::is_same_v<T, std::remove_cv_t<T>>,
+                  "xme::SegmentedArray must have a non-const and non-volatile T");
+    static_assert(std::is_same_v<T, typename Alloc::value_type>,
+                  "xme::SegmentedArray must have the same T as its allocator");
+
+    using allocator_type         = Alloc;
+    using size_type              = std::size_t;
+    using difference_type        = std::ptrdiff_t;
+    using value_type             = T;
+    using reference              = T&;
+    using const_reference        = const T&;
+    using pointer                = T*;
+    using const_pointer          = const T*;
+    using iterator               = Iterator<false>;
+    using const_iterator         = Iterator<true>;
+    using reverse_iterator       = xme::ReverseIterator<iterator>;
+    using const_reverse_iterator = xme::ReverseIterator<const_iterator>;
+
+    static constexpr size_type chunk_size = ChunkSize;
+
+    constexpr SegmentedArray() noexcept(std::is_nothrow_default_constructible_v<Alloc>) = default;
+
+    explicit constexpr SegmentedArray(const allocator_type& alloc) noexcept : m_allocator(alloc) {}
+
+    constexpr SegmentedArray(const SegmentedArray& other) :
+      SegmentedArray(other.begin(), other.end(), other.m_allocator) {}
+
+    constexpr SegmentedArray(SegmentedArray&& other) noexcept :
+      m_table(other.m_table.load(std::memory_order_relaxed)),
+      m_size(other.m_size.load(std::memory_order_relaxed)),
+      m_chunk_count(other.m_chunk_count),
+      m_allocator(std::move(other.m_allocator)) {
+        other.m_table.store(nullptr, std::memory_order_relaxed);
+        other.m_size.store(0, std::memory_order_relaxed);
+        other.m_chunk_count = 0;
+    }
+
+    constexpr SegmentedArray(std::initializer_list<T> list,
+                             const allocator_type& alloc = allocator_type()) :
+      SegmentedArray(list.begin(), list.end(), alloc) {}
+
+    template<std::input_iterator Iter, std::sentinel_for<Iter> Sent>
+    constexpr SegmentedArray(Iter first, Sent last,
+                             const allocator_type& alloc = allocator_type()) :
+      m_allocator(alloc) {
+        push_back(first, last);
+    }
+
+    template<std::ranges::input_range R>
+        requires(std::convertible_to<std::ranges::range_reference_t<R>, T>)
+                && (!std::is_same_v<SegmentedArray, std::decay_t<R>>)
+    explicit constexpr SegmentedArray(R&& range, const allocator_type& alloc = allocator_type()) :
+      SegmentedArray(std::ranges::begin(range), std::ranges::end(range), alloc) {}
+
+    constexpr ~SegmentedArray() noexcept {
+        clear();
+        release_storage();
+    }
+
+    constexpr auto operator=(const SegmentedArray& other) -> SegmentedArray& {
+        SegmentedArray(other).swap(*this);
+        return *this;
+    }
+
+    constexpr auto operator=(SegmentedArray&& other) noexcept -> SegmentedArray& {
+        SegmentedArray(std::move(other)).swap(*this);
+        return *this;
+    }
+
+    [[nodiscard]]
+    constexpr auto operator[](size_type index) noexcept -> reference {
+        assert(index < size());
+        return m_table.load(std::memory_order_acquire)
+          ->chunks[index >> chunk_shift][index & chunk_mask];
+    }
+
+    [[nodiscard]]
+    constexpr auto operator[](size_type index) const noexcept -> const_reference {
+        assert(index < size());
+        return m_table.load(std::memory_order_acquire)
+          ->chunks[index >> chunk_shift][index & chunk_mask];
+    }
+
+    [[nodiscard]]
+    constexpr auto begin() noexcept -> iterator {
+        return {this, 0};
+    }
+
+    [[nodiscard]]
+    constexpr auto end() noexcept -> iterator {
+        return {this, size()};
+    }
+
+    [[nodiscard]]
+    constexpr auto begin() const noexcept -> const_iterator {
+        return {this, 0};
+    }
+
+    [[nodiscard]]
+    constexpr auto end() const noexcept -> const_iterator {
+        return {this, size()};
+    }
+
+    [[nodiscard]]
+    constexpr auto cbegin() const noexcept -> const_iterator {
+        return begin();
+    }
+
+    [[nodiscard]]
+    constexpr auto cend() const noexcept -> const_iterator {
+        return end();
+    }
+
+    [[nodiscard]]
+    constexpr auto rbegin() noexcept -> reverse_iterator {
+        return end();
+    }
+
+    [[nodiscard]]
+    constexpr auto rend() noexcept -> reverse_iterator {
+        return begin();
+    }
+
+    [[nodiscard]]
+    constexpr auto rbegin() const noexcept -> const_reverse_iterator {
+        return end();
+    }
+
+    [[nodiscard]]
+    constexpr auto rend() const noexcept -> const_reverse_iterator {
+        return begin();
+    }
+
+    [[nodiscard]]
+    constexpr auto front() noexcept -> reference {
+        return (*this)[0];
+    }
+
+    [[nodiscard]]
+    constexpr auto front() const noexcept -> const_reference {
+        return (*this)[0];
+    }
+
+    [[nodiscard]]
+    constexpr auto back() noexcept -> reference {
+        return (*this)[size() - 1];
+    }
+
+    [[nodiscard]]
+    constexpr auto back() const noexcept -> const_reference {
+        return (*this)[size() - 1];
+    }
+
+    //! @returns the amount of published elements.
+    [[nodiscard]]
+    constexpr auto size() const noexcept -> size_type {
+        return m_size.load(std::memory_order_acquire);
+    }
+
+    //! @returns the amount of elements the container can hold without allocating a chunk.
+    [[nodiscard]]
+    constexpr auto capacity() const noexcept -> size_type {
+        return m_chunk_count * ChunkSize;
+    }
+
+    [[nodiscard]]
+    constexpr bool empty() const noexcept {
+        return size() == 0;
+    }
+
+    constexpr void swap(SegmentedArray& other) noexcept {
+        auto tmp_table = m_table.load(std::memory_order_relaxed);
+        auto tmp_size  = m_size.load(std::memory_order_relaxed);
+        m_table.store(other.m_table.load(std::memory_order_relaxed), std::memory_order_relaxed);
+        m_size.store(other.m_size.load(std::memory_order_relaxed), std::memory_order_relaxed);
+        other.m_table.store(tmp_table, std::memory_order_relaxed);
+        other.m_size.store(tmp_size, std::memory_order_relaxed);
+        std::ranges::swap(m_chunk_count, other.m_chunk_count);
+        if constexpr(alloc_traits::propagate_on_container_swap::value)
+            std::ranges::swap(m_allocator, other.m_allocator);
+        else
+            static_assert(alloc_traits::is_always_equal::value);
+    }
+
+    //! Destroys every element, keeping the allocated chunks.
+    //! Must not be called while other threads are reading.
+    constexpr void clear() noexcept {
+        const size_type count = m_size.load(std::memory_order_relaxed);
+        for(size_type i = 0; i < count; ++i)
+            ranges::destroy_at_a(std::addressof((*this)[i]), m_allocator);
+        m_size.store(0, std::memory_order_release);
+    }
+
+    //! Allocates chunks until the container can hold n elements.
+    constexpr void reserve(size_type n) {
+        while(capacity() < n)
+            add_chunk();
+    }
+
+    //! Pushes a `value` to the end of the array.
+    template<std::convertible_to<T> U>
+    constexpr void push_back(U&& value) {
+        emplace_back(std::forward<U>(value));
+    }
+
+    //! Pushes [first, last) to the end of the array.
+    template<std::input_iterator Iter, std::sentinel_for<Iter> Sent>
+    constexpr void push_back(Iter first, Sent last) {
+        for(; first != last; ++first)
+            emplace_back(*first);
+    }
+
+    //! Pushes a range [begin(range), end(range)) to the end of the array.
+    template<std::ranges::input_range R>
+        requires(std::convertible_to<std::ranges::range_reference_t<R>, T>)
+    constexpr void push_back(R&& range) {
+        push_back(std::ranges::begin(range), std::ranges::end(range));
+    }
+
+    //! Constructs an element at the end and publishes it to the readers.
+    //! @returns a reference to the newly inserted element.
+    template<typename... Args>
+    constexpr auto emplace_back(Args&&... args) -> reference {
+        const size_type index = m_size.load(std::memory_order_relaxed);
+        if(index == capacity())
+            add_chunk();
+
+        T* slot = m_table.load(std::memory_order_relaxed)->chunks[index >> chunk_shift]
+                  + (index & chunk_mask);
+        alloc_traits::construct(m_allocator, slot, std::forward<Args>(args)...);
+        m_size.store(index + 1, std::memory_order_release);
+        return *slot;
+    }
+
+    //! Destroys the last element, the chunk is kept for future pushes.
+    //! Must not be called while other threads are reading.
+    constexpr void pop_back() noexcept {
+        const size_type index = m_size.load(std::memory_order_relaxed);
+        assert(index > 0);
+        T* last = std::addressof((*this)[index - 1]);
+        m_size.store(index - 1, std::memory_order_release);
+        ranges::destroy_at_a(last, m_allocator);
+    }
+
+private:
+    constexpr void add_chunk() {
+        table* current = m_table.load(std::memory_order_relaxed);
+        if(current == nullptr || m_chunk_count == current->capacity)
+            current = grow_table(current);
+
+        current->chunks[m_chunk_count] = m_allocator.allocate(ChunkSize);
+        ++m_chunk_count;
+    }
+
+    //! Copies the chunk pointers into a bigger table.
+    //! The old table is kept alive so readers holding it stay valid.
+    constexpr auto grow_table(table* current) -> table* {
+        const size_type new_capacity = current ? current->capacity * 2 : 8;
+
+        table_alloc table_allocator(m_allocator);
+        chunks_alloc chunk_allocator(m_allocator);
+        table* new_table = table_traits::allocate(table_allocator, 1);
+        std::ranges::construct_at(new_table);
+        try {
+            new_table->chunks = chunks_traits::allocate(chunk_allocator, new_capacity);
+        }
+        catch(...) {
+            table_traits::deallocate(table_allocator, new_table, 1);
+            throw;
+        }
+        new_table->capacity = new_capacity;
+        new_table->previous = current;
+        if(current)
+            std::ranges::copy(current->chunks, current->chunks + m_chunk_count, new_table->chunks);
+        m_table.store(new_table, std::memory_order_release);
+        return new_table;
+    }
+
+    constexpr void release_storage() noexcept {
+        table* current = m_table.load(std::memory_order_relaxed);
+        if(current == nullptr)
+            return;
+
+        for(size_type i = 0; i < m_chunk_count; ++i)
+            m_allocator.deallocate(current->chunks[i], ChunkSize);
+
+        table_alloc table_allocator(m_allocator);
+        chunks_alloc chunk_allocator(m_allocator);
+        while(current) {
+            table* previous = current->previous;
+            chunks_traits::deallocate(chunk_allocator, current->chunks, current->capacity);
+            table_traits::deallocate(table_allocator, current, 1);
+            current = previous;
+        }
+        m_table.store(nullptr, std::memory_order_relaxed);
+        m_chunk_count = 0;
+    }
+
+private:
+    std::atomic<table*> m_table   = nullptr;
+    std::atomic<size_type> m_size = 0;
+    size_type m_chunk_count       = 0;
+    [[no_unique_address]]
+    Alloc m_allocator;
+};
+
+template<typename T, std::size_t ChunkSize, CAllocator Alloc>
+template<bool Const>
+class SegmentedArray<T, ChunkSize, Alloc>::Iterator {
+private:
+    using container = std::conditional_t<Const, const SegmentedArray, SegmentedArray>;
+
+public:
+    using difference_type   = std::ptrdiff_t;
+    using value_type        = T;
+    using reference         = std::conditional_t<Const, const T&, T&>;
+    using pointer           = std::conditional_t<Const, const T*, T*>;
+    using iterator_category = std::random_access_iterator_tag;
+
+    template<bool>
+    friend class Iterator;
+
+    constexpr Iterator() noexcept = default;
+
+    constexpr Iterator(container* array, size_type index) noexcept :
+      m_array(array), m_index(index) {}
+
+    constexpr Iterator(const Iterator<!Const>& it) noexcept
+        requires(Const)
+      : m_array(it.m_array), m_index(it.m_index) {}
+
+    constexpr auto operator->() const noexcept -> pointer { return std::addressof(**this); }
+
+    constexpr auto operator*() const noexcept -> reference { return (*m_array)[m_index]; }
+
+    constexpr auto operator++() noexcept -> Iterator& {
+        ++m_index;
+        return *this;
+    }
+
+    constexpr auto operator++(int) noexcept -> Iterator {
+        Iterator tmp{*this};
+        ++m_index;
+        return tmp;
+    }
+
+    constexpr auto operator--() noexcept -> Iterator& {
+        --m_index;
+        return *this;
+    }
+
+    constexpr auto operator--(int) noexcept -> Iterator {
+        Iterator tmp{*this};
+        --m_index;
+        return tmp;
+    }
+
+    constexpr auto operator+(difference_type n) const noexcept -> Iterator {
+        return {m_array, m_index + n};
+    }
+
+    friend constexpr auto operator+(difference_type n, const Iterator& it) noexcept -> Iterator {
+        return it + n;
+    }
+
+    constexpr auto operator-(difference_type n) const noexcept -> Iterator {
+        return {m_array, m_index - n};
+    }
+
+    constexpr auto operator-(const Iterator& it) const noexcept -> difference_type {
+        return difference_type(m_index) - difference_type(it.m_index);
+    }
+
+    constexpr auto operator+=(difference_type n) noexcept -> Iterator& {
+        m_index += n;
+        return *this;
+    }
+
+    constexpr auto operator-=(difference_type n) noexcept -> Iterator& {
+        m_index -= n;
+        return *this;
+    }
+
+    constexpr auto operator[](difference_type n) const noexcept -> reference {
+        return (*m_array)[m_index + n];
+    }
+
+    constexpr bool operator==(const Iterator& rhs) const noexcept { return m_index == rhs.m_index; }
+
+    constexpr auto operator<=>(const Iterator& rhs) const noexcept {
+        return m_index <=> rhs.m_index;
+    }
+
+private:
+    container* m_array = nullptr;
+    size_type m_index  = 0;
+};
+}  // namespace xme
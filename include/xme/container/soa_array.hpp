@@ -0,0 +1,462 @@
+#pragma once
+#include "../../../private/container/tuple_base.hpp"
+#include "array_view.hpp"
+#include "container_policy.hpp"
+#include "tuple.hpp"
+#include <algorithm>
+#include <cassert>
+#include <memory>
+#include <new>
+
+namespace xme {
+//! SoAArray is a dynamic structure of arrays.
+//! Every element type is stored in its own contiguous and aligned column, so loops that only
+//! touch one field only load that field.
+//! Elements are accessed through proxies that behave like xme::Tuple<Ts&...>.
+//! @param Ts the type of each column
+template<typename... Ts>
+class SoAArray {
+private:
+    using columns = detail::tuple_base<Ts*...>;
+    using indices = std::index_sequence_for<Ts...>;
+
+    template<std::size_t I>
+    using index_constant = std::integral_constant<std::size_t, I>;
+
+    template<bool Const>
+    class Iterator;
+
+public:
+    static_assert(sizeof...(Ts) > 0, "xme::SoAArray must have at least one column");
+    static_assert((std::is_same_v<Ts, std::remove_cvref_t<Ts>> && ...),
+                  "xme::SoAArray columns must be non-const, non-volatile and non-reference");
+
+    using size_type       = std::size_t;
+    using difference_type = std::ptrdiff_t;
+    using value_type      = Tuple<Ts...>;
+    using reference       = Tuple<Ts&...>;
+    using const_reference = Tuple<const Ts&...>;
+    using iterator        = Iterator<false>;
+    using const_iterator  = Iterator<true>;
+    using type_list       = detail::TypeList<Ts...>;
+
+    template<std::size_t I>
+    using column_type =
+      std::remove_pointer_t<decltype(columns::declval(std::integral_constant<std::size_t, I>{}))>;
+
+    //! Every column starts at a multiple of this value, so it can be loaded with aligned SIMD.
+    static constexpr std::size_t column_alignment = std::max({std::size_t(64), alignof(Ts)...});
+
+    constexpr SoAArray() noexcept = default;
+
+    constexpr SoAArray(const SoAArray& other) {
+        reserve(other.size());
+        for(size_type i = 0; i < other.size(); ++i)
+            push_back(other[i]);
+    }
+
+    constexpr SoAArray(SoAArray&& other) noexcept :
+      m_columns(std::exchange(other.m_columns, columns{})),
+      m_size(std::exchange(other.m_size, 0)),
+      m_capacity(std::exchange(other.m_capacity, 0)) {}
+
+    constexpr SoAArray(std::initializer_list<value_type> list) {
+        reserve(list.size());
+        for(auto&& value : list)
+            push_back(value);
+    }
+
+    constexpr ~SoAArray() noexcept {
+        clear();
+        deallocate_columns(m_columns, m_capacity);
+    }
+
+    constexpr auto operator=(const SoAArray& other) -> SoAArray& {
+        SoAArray(other).swap(*this);
+        return *this;
+    }
+
+    constexpr auto operator=(SoAArray&& other) noexcept -> SoAArray& {
+        SoAArray(std::move(other)).swap(*this);
+        return *this;
+    }
+
+    //! @returns a proxy with a reference to every field of the element.
+    [[nodiscard]]
+    constexpr auto operator[](size_type index) noexcept -> reference {
+        assert(index < size());
+        return make_reference(index, indices{});
+    }
+
+    //! @returns a proxy with a reference to every field of the element.
+    [[nodiscard]]
+    constexpr auto operator[](size_type index) const noexcept -> const_reference {
+        assert(index < size());
+        return make_reference(index, indices{});
+    }
+
+    //! @returns a pointer to the beggining of column I.
+    template<std::size_t I>
+    [[nodiscard]]
+    constexpr auto data() noexcept -> column_type<I>* {
+        return m_columns[index_constant<I>{}];
+    }
+
+    //! @returns a pointer to the beggining of column I.
+    template<std::size_t I>
+    [[nodiscard]]
+    constexpr auto data() const noexcept -> const column_type<I>* {
+        return m_columns[index_constant<I>{}];
+    }
+
+    //! @returns a view over every element of column I.
+    template<std::size_t I>
+    [[nodiscard]]
+    constexpr auto column() noexcept -> ArrayView<column_type<I>> {
+        return {data<I>(), size()};
+    }
+
+    //! @returns a view over every element of column I.
+    template<std::size_t I>
+    [[nodiscard]]
+    constexpr auto column() const noexcept -> ArrayView<const column_type<I>> {
+        return {data<I>(), size()};
+    }
+
+    [[nodiscard]]
+    constexpr auto begin() noexcept -> iterator {
+        return {this, 0};
+    }
+
+    [[nodiscard]]
+    constexpr auto end() noexcept -> iterator {
+        return {this, size()};
+    }
+
+    [[nodiscard]]
+    constexpr auto begin() const noexcept -> const_iterator {
+        return {this, 0};
+    }
+
+    [[nodiscard]]
+    constexpr auto end() const noexcept -> const_iterator {
+        return {this, size()};
+    }
+
+    [[nodiscard]]
+    constexpr auto cbegin() const noexcept -> const_iterator {
+        return begin();
+    }
+
+    [[nodiscard]]
+    constexpr auto cend() const noexcept -> const_iterator {
+        return end();
+    }
+
+    [[nodiscard]]
+    constexpr auto front() noexcept -> reference {
+        return (*this)[0];
+    }
+
+    [[nodiscard]]
+    constexpr auto front() const noexcept -> const_reference {
+        return (*this)[0];
+    }
+
+    [[nodiscard]]
+    constexpr auto back() noexcept -> reference {
+        return (*this)[size() - 1];
+    }
+
+    [[nodiscard]]
+    constexpr auto back() const noexcept -> const_reference {
+        return (*this)[size() - 1];
+    }
+
+    //! @returns the amount of elements currently in the array.
+    [[nodiscard]]
+    constexpr auto size() const noexcept -> size_type {
+        return m_size;
+    }
+
+    //! @returns the amount of elements the container can hold without a resize
+    [[nodiscard]]
+    constexpr auto capacity() const noexcept -> size_type {
+        return m_capacity;
+    }
+
+    [[nodiscard]]
+    constexpr bool empty() const noexcept {
+        return m_size == 0;
+    }
+
+    constexpr void swap(SoAArray& other) noexcept {
+        std::ranges::swap(m_columns, other.m_columns);
+        std::ranges::swap(m_size, other.m_size);
+        std::ranges::swap(m_capacity, other.m_capacity);
+    }
+
+    //! Erases every element, leaving the array empty while keeping its capacity.
+    constexpr void clear() noexcept {
+        for_each_column([this]<std::size_t I>(index_constant<I>) {
+            std::destroy_n(data<I>(), m_size);
+        });
+        m_size = 0;
+    }
+
+    //! Grows the capacity of every column,
+    //! If the argument is lower than the current capacity, nothing happens,
+    constexpr void reserve(size_type n) {
+        if(capacity() < n)
+            grow_storage(n);
+    }
+
+    //! Pushes a value to the end of the array, splitting its fields into the columns.
+    template<CTupleLike U>
+        requires(std::tuple_size_v<std::remove_cvref_t<U>> == sizeof...(Ts))
+    constexpr void push_back(U&& value) {
+        [&]<std::size_t... I>(std::index_sequence<I...>) {
+            emplace_back(get<I>(std::forward<U>(value))...);
+        }(indices{});
+    }
+
+    //! Constructs an element at the end, each argument initializes its own column.
+    //! @returns a proxy to the newly inserted element.
+    template<typename... Args>
+        requires(sizeof...(Args) == sizeof...(Ts))
+    constexpr auto emplace_back(Args&&... args) -> reference {
+        if(m_size == m_capacity) {
+            grow_storage(DoublingGrowth::next_capacity(m_capacity, m_size + 1, 0),
+                         std::forward<Args>(args)...);
+        }
+        else
+            construct_fields(m_columns, m_size, indices{}, std::forward<Args>(args)...);
+        ++m_size;
+        return back();
+    }
+
+    //! Destroys the last element in the array.
+    constexpr void pop_back() noexcept {
+        assert(size() > 0);
+        --m_size;
+        for_each_column([this]<std::size_t I>(index_constant<I>) {
+            std::destroy_at(data<I>() + m_size);
+        });
+    }
+
+private:
+    template<typename F>
+    constexpr void for_each_column(F&& fn) {
+        [&]<std::size_t... I>(std::index_sequence<I...>) {
+            (fn(index_constant<I>{}), ...);
+        }(indices{});
+    }
+
+    template<std::size_t... I>
+    constexpr auto make_reference(size_type index, std::index_sequence<I...>) noexcept
+      -> reference {
+        return reference{m_columns[index_constant<I>{}][index]...};
+    }
+
+    template<std::size_t... I>
+    constexpr auto make_reference(size_type index, std::index_sequence<I...>) const noexcept
+      -> const_reference {
+        return const_reference{m_columns[index_constant<I>{}][index]...};
+    }
+
+    //! Constructs every field of the element at index of cols, destroying the already
+    //! constructed ones if any throws.
+    template<std::size_t... I, typename... Args>
+    static constexpr void construct_fields(columns& cols, size_type index,
+                                           std::index_sequence<I...>, Args&&... args) {
+        std::size_t constructed = 0;
+        try {
+            ((std::construct_at(cols[index_constant<I>{}] + index, std::forward<Args>(args)),
+              ++constructed),
+             ...);
+        }
+        catch(...) {
+            ((I < constructed ? std::destroy_at(cols[index_constant<I>{}] + index) : void()), ...);
+            throw;
+        }
+    }
+
+    template<typename T>
+    static auto allocate_column(size_type n) -> T* {
+        return static_cast<T*>(
+          ::operator new(n * sizeof(T), std::align_val_t(column_alignment)));
+    }
+
+    template<typename T>
+    static void deallocate_column(T* column, size_type n) noexcept {
+        ::operator delete(column, n * sizeof(T), std::align_val_t(column_alignment));
+    }
+
+    static void deallocate_columns(columns& cols, size_type n) noexcept {
+        [&]<std::size_t... I>(std::index_sequence<I...>) {
+            (deallocate_column(cols[index_constant<I>{}], n), ...);
+        }(indices{});
+    }
+
+    //! Moves column I to dest when its move cannot throw, or when it cannot be copied,
+    //! otherwise copies it.
+    template<std::size_t I>
+    constexpr void relocate_column(column_type<I>* dest) {
+        using T = column_type<I>;
+        if constexpr(std::is_nothrow_move_constructible_v<T> || !std::is_copy_constructible_v<T>)
+            std::uninitialized_move_n(data<I>(), m_size, dest);
+        else
+            std::uninitialized_copy_n(data<I>(), m_size, dest);
+    }
+
+    //! Moves the elements to new columns of capacity n, and constructs an element after them
+    //! from args, if any, before the old columns are touched, so args may refer to an element.
+    //! When anything throws the new columns are freed and the array is left unchanged.
+    template<typename... Args>
+    constexpr void grow_storage(size_type n, Args&&... args) {
+        columns new_columns{};
+        try {
+            [&]<std::size_t... I>(std::index_sequence<I...>) {
+                ((new_columns[index_constant<I>{}] = allocate_column<column_type<I>>(n)), ...);
+            }(indices{});
+            if constexpr(sizeof...(Args) > 0)
+                construct_fields(new_columns, m_size, indices{}, std::forward<Args>(args)...);
+        }
+        catch(...) {
+            [&]<std::size_t... I>(std::index_sequence<I...>) {
+                ((new_columns[index_constant<I>{}]
+                    ? deallocate_column(new_columns[index_constant<I>{}], n)
+                    : void()),
+                 ...);
+            }(indices{});
+            throw;
+        }
+
+        // Columns whose move may throw go first, so the old columns are only moved from once
+        // nothing can throw anymore
+        bool relocated[sizeof...(Ts)]{};
+        try {
+            for(const bool nothrow : {false, true}) {
+                for_each_column([&]<std::size_t I>(index_constant<I>) {
+                    if(std::is_nothrow_move_constructible_v<column_type<I>> == nothrow) {
+                        relocate_column<I>(new_columns[index_constant<I>{}]);
+                        relocated[I] = true;
+                    }
+                });
+            }
+        }
+        catch(...) {
+            for_each_column([&]<std::size_t I>(index_constant<I>) {
+                column_type<I>* column = new_columns[index_constant<I>{}];
+                if(relocated[I])
+                    std::destroy_n(column, m_size);
+                if constexpr(sizeof...(Args) > 0)
+                    std::destroy_at(column + m_size);
+            });
+            deallocate_columns(new_columns, n);
+            throw;
+        }
+
+        for_each_column([this]<std::size_t I>(index_constant<I>) {
+            std::destroy_n(data<I>(), m_size);
+        });
+        deallocate_columns(m_columns, m_capacity);
+        m_columns  = new_columns;
+        m_capacity = n;
+    }
+
+private:
+    columns m_columns{};
+    size_type m_size     = 0;
+    size_type m_capacity = 0;
+};
+
+template<typename... Ts>
+template<bool Const>
+class SoAArray<Ts...>::Iterator {
+private:
+    using container = std::conditional_t<Const, const SoAArray, SoAArray>;
+
+public:
+    using difference_type   = std::ptrdiff_t;
+    using value_type        = Tuple<Ts...>;
+    using reference         = std::conditional_t<Const, Tuple<const Ts&...>, Tuple<Ts&...>>;
+    using iterator_category = std::random_access_iterator_tag;
+
+    template<bool>
+    friend class Iterator;
+
+    constexpr Iterator() noexcept = default;
+
+    constexpr Iterator(container* array, size_type index) noexcept :
+      m_array(array), m_index(index) {}
+
+    constexpr Iterator(const Iterator<!Const>& it) noexcept
+        requires(Const)
+      : m_array(it.m_array), m_index(it.m_index) {}
+
+    constexpr auto operator*() const noexcept -> reference { return (*m_array)[m_index]; }
+
+    constexpr auto operator++() noexcept -> Iterator& {
+        ++m_index;
+        return *this;
+    }
+
+    constexpr auto operator++(int) noexcept -> Iterator {
+        Iterator tmp{*this};
+        ++m_index;
+        return tmp;
+    }
+
+    constexpr auto operator--() noexcept -> Iterator& {
+        --m_index;
+        return *this;
+    }
+
+    constexpr auto operator--(int) noexcept -> Iterator {
+        Iterator tmp{*this};
+        --m_index;
+        return tmp;
+    }
+
+    constexpr auto operator+(difference_type n) const noexcept -> Iterator {
+        return {m_array, m_index + n};
+    }
+
+    friend constexpr auto operator+(difference_type n, const Iterator& it) noexcept -> Iterator {
+        return it + n;
+    }
+
+    constexpr auto operator-(difference_type n) const noexcept -> Iterator {
+        return {m_array, m_index - n};
+    }
+
+    constexpr auto operator-(const Iterator& it) const noexcept -> difference_type {
+        return difference_type(m_index) - difference_type(it.m_index);
+    }
+
+    constexpr auto operator+=(difference_type n) noexcept -> Iterator& {
+        m_index += n;
+        return *this;
+    }
+
+    constexpr auto operator-=(difference_type n) noexcept -> Iterator& {
+        m_index -= n;
+        return *this;
+    }
+
+    constexpr auto operator[](difference_type n) const noexcept -> reference {
+        return (*m_array)[m_index + n];
+    }
+
+    constexpr bool operator==(const Iterator& rhs) const noexcept { return m_index == rhs.m_index; }
+
+    constexpr auto operator<=>(const Iterator& rhs) const noexcept {
+        return m_index <=> rhs.m_index;
+    }
+
+private:
+    container* m_array = nullptr;
+    size_type m_index  = 0;
+};
+}  // namespace xme
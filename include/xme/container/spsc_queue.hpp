@@ -29,6 +29,13 @@ public:
         assert(std::has_single_bit(capacity) && "capacity must be a power of 2");
     }
 
+    //! Creates a queue of capacity elements allocated with alloc
+    constexpr SPSCQueue(std::size_t capacity, const Policy& alloc)
+        requires(CAllocator<Policy>)
+      : super(capacity, alloc) {
+        assert(std::has_single_bit(capacity) && "capacity must be a power of 2");
+    }
+
     [[nodiscard]]
     constexpr auto read_available() const noexcept -> std::size_t {
         return super::read_available();
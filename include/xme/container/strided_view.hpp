@@ -0,0 +1,261 @@
+#pragma once
+#include "array_view.hpp"
+#include <cassert>
+#include <compare>
+#include <cstddef>
+#include <iterator>
+
+namespace xme::detail {
+//! Random access iterator over every stride-th element from a base pointer.
+//! It keeps an index instead of advancing the pointer, so the end iterator of a
+//! view never points outside of the viewed buffer.
+template<typename T>
+struct StridedIterator {
+private:
+    using self = StridedIterator<T>;
+
+public:
+    using difference_type   = std::ptrdiff_t;
+    using value_type        = std::remove_cv_t<T>;
+    using pointer           = T*;
+    using reference         = T&;
+    using iterator_category = std::random_access_iterator_tag;
+
+    constexpr StridedIterator() noexcept = default;
+
+    constexpr StridedIterator(T* base, difference_type index, difference_type stride) noexcept :
+      m_base(base),
+      m_index(index),
+      m_stride(stride) {}
+
+    constexpr operator StridedIterator<const T>() const noexcept
+        requires(!std::is_const_v<T>)
+    {
+        return {m_base, m_index, m_stride};
+    }
+
+    constexpr auto operator*() const noexcept -> reference { return m_base[m_index * m_stride]; }
+
+    constexpr auto operator->() const noexcept -> pointer { return m_base + m_index * m_stride; }
+
+    constexpr auto operator[](difference_type n) const noexcept -> reference {
+        return m_base[(m_index + n) * m_stride];
+    }
+
+    constexpr auto operator++() noexcept -> self& {
+        ++m_index;
+        return *this;
+    }
+
+    constexpr auto operator++(int) noexcept -> self {
+        self tmp{*this};
+        ++m_index;
+        return tmp;
+    }
+
+    constexpr auto operator--() noexcept -> self& {
+        --m_index;
+        return *this;
+    }
+
+    constexpr auto operator--(int) noexcept -> self {
+        self tmp{*this};
+        --m_index;
+        return tmp;
+    }
+
+    constexpr auto operator+=(difference_type n) noexcept -> self& {
+        m_index += n;
+        return *this;
+    }
+
+    constexpr auto operator-=(difference_type n) noexcept -> self& {
+        m_index -= n;
+        return *this;
+    }
+
+    friend constexpr auto operator+(self it, difference_type n) noexcept -> self { return it += n; }
+
+    friend constexpr auto operator+(difference_type n, self it) noexcept -> self { return it += n; }
+
+    friend constexpr auto operator-(self it, difference_type n) noexcept -> self { return it -= n; }
+
+    friend constexpr auto operator-(const self& lhs, const self& rhs) noexcept -> difference_type {
+        return lhs.m_index - rhs.m_index;
+    }
+
+    constexpr bool operator==(const self& rhs) const noexcept { return m_index == rhs.m_index; }
+
+    constexpr auto operator<=>(const self& rhs) const noexcept -> std::strong_ordering {
+        return m_index <=> rhs.m_index;
+    }
+
+private:
+    T* m_base                = nullptr;
+    difference_type m_index  = 0;
+    difference_type m_stride = 1;
+};
+}  // namespace xme::detail
+
+namespace xme {
+//! StridedView is a view to every stride-th element of a buffer, like a column of a
+//! row major matrix, or a channel of interleaved pixels.
+//! The stride is in elements and may be negative to walk the buffer backwards.
+//! Uses 16 bytes when the size is not dynamic and 24 otherwise.
+//! @param T the type of element to view in a container
+//! @param Size Specifies the amount of viewed elements
+template<typename T, std::size_t Size = static_cast<std::size_t>(-1)>
+class StridedView {
+private:
+    static constexpr std::size_t dynamic_size = -1;
+
+public:
+    using size_type       = std::size_t;
+    using difference_type = std::ptrdiff_t;
+    using value_type      = T;
+    using pointer         = T*;
+    using const_pointer   = const T*;
+    using reference       = T&;
+    using const_reference = const T&;
+    using iterator        = detail::StridedIterator<T>;
+    using const_iterator  = detail::StridedIterator<const T>;
+
+    //! StridedView is only default constructible if size is not known
+    constexpr StridedView() noexcept
+        requires(Size == dynamic_size || Size == 0)
+    = default;
+
+    //! Creates a StridedView of size elements, starting at data and stride elements apart
+    constexpr StridedView(pointer data, size_type size, difference_type stride) noexcept :
+      m_view(data),
+      m_stride(stride),
+      m_size(size) {
+        if constexpr(Size != dynamic_size)
+            assert(size == Size);
+    }
+
+    //! Creates a StridedView of every element of an ArrayView
+    template<typename U, std::size_t S>
+        requires(std::is_convertible_v<U (*)[], T (*)[]>)
+                && (Size == dynamic_size || S == dynamic_size || Size == S)
+    constexpr StridedView(ArrayView<U, S> view) noexcept :
+      StridedView(view.data(), view.size(), 1) {}
+
+    //! returns a reference to an element in the view
+    [[nodiscard]]
+    constexpr auto operator[](size_type i) const noexcept -> reference {
+        assert(i < size());
+        return m_view[static_cast<difference_type>(i) * m_stride];
+    }
+
+    //! Returns a raw pointer to the first element of the view
+    [[nodiscard]]
+    constexpr auto data() const noexcept -> pointer {
+        return m_view;
+    }
+
+    //! Returns the distance in elements between two consecutive elements of the view
+    [[nodiscard]]
+    constexpr auto stride() const noexcept -> difference_type {
+        return m_stride;
+    }
+
+    //! Returns an iterator to the first element of the view
+    [[nodiscard]]
+    constexpr auto begin() const noexcept -> iterator {
+        return {m_view, 0, m_stride};
+    }
+
+    //! Returns an iterator to one past the last element of the view
+    [[nodiscard]]
+    constexpr auto end() const noexcept -> iterator {
+        return {m_view, static_cast<difference_type>(size()), m_stride};
+    }
+
+    //! Returns a const iterator to the first element of the view
+    [[nodiscard]]
+    constexpr auto cbegin() const noexcept -> const_iterator {
+        return begin();
+    }
+
+    //! Returns a const iterator to one past the last element of the view
+    [[nodiscard]]
+    constexpr auto cend() const noexcept -> const_iterator {
+        return end();
+    }
+
+    //! Returns a reference to the first element of the view
+    [[nodiscard]]
+    constexpr auto front() const noexcept -> reference {
+        return *m_view;
+    }
+
+    //! Returns a reference to the last element of the view
+    [[nodiscard]]
+    constexpr auto back() const noexcept -> reference {
+        return (*this)[size() - 1];
+    }
+
+    //! Returns the size of the view
+    [[nodiscard]]
+    constexpr auto size() const noexcept -> size_type {
+        return m_size.size();
+    }
+
+    //! Returns true is the view is empty
+    [[nodiscard]]
+    constexpr bool is_empty() const noexcept {
+        return m_size.size() == 0;
+    }
+
+    //! Creates a new StridedView containing a part of the view
+    template<std::size_t Offset, std::size_t Count>
+    [[nodiscard]]
+    constexpr auto subview() const noexcept -> StridedView<T, Count> {
+        if constexpr(Size == dynamic_size)
+            assert(Count + Offset <= size());
+        else
+            static_assert(Count + Offset <= Size);
+        return StridedView<T, Count>(element_at(Offset), Count, m_stride);
+    }
+
+    //! Creates a new StridedView containing a part of the view
+    [[nodiscard]]
+    constexpr auto subview(size_type offset, size_type count) const noexcept
+      -> StridedView<T, dynamic_size> {
+        assert(count + offset <= size());
+        return StridedView<T, dynamic_size>(element_at(offset), count, m_stride);
+    }
+
+    //! Creates a new StridedView containing every step-th element of the view
+    [[nodiscard]]
+    constexpr auto every(size_type step) const noexcept -> StridedView<T, dynamic_size> {
+        assert(step > 0);
+        return StridedView<T, dynamic_size>(m_view, (size() + step - 1) / step,
+                                            m_stride * static_cast<difference_type>(step));
+    }
+
+private:
+    //! Pointer to the element at i, which may be one past the last element.
+    [[nodiscard]]
+    constexpr auto element_at(size_type i) const noexcept -> pointer {
+        return i == size() ? m_view : m_view + static_cast<difference_type>(i) * m_stride;
+    }
+
+    T* m_view                = nullptr;
+    difference_type m_stride = 1;
+    [[no_unique_address]]
+    detail::Extent<Size> m_size;
+};
+
+template<typename T, std::size_t S>
+StridedView(ArrayView<T, S>) -> StridedView<T, S>;
+}  // namespace xme
+
+namespace std::ranges {
+template<typename T, std::size_t S>
+constexpr bool enable_borrowed_range<xme::StridedView<T, S>> = true;
+
+template<typename T, std::size_t S>
+constexpr bool enable_view<xme::StridedView<T, S>> = true;
+}  // namespace std::ranges
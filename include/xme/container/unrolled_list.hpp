@@ -0,0 +1,524 @@
+#pragma once
+#include "concepts.hpp"
+#include <algorithm>
+#include <cassert>
+#include <iterator>
+#include <memory>
+#include <new>
+#include <utility>
+
+namespace xme {
+namespace detail {
+struct UnrolledListNodeBase {
+    UnrolledListNodeBase* next = nullptr;
+    std::size_t count          = 0;
+};
+
+template<typename T, std::size_t Capacity>
+struct UnrolledListNode : UnrolledListNodeBase {
+    //! Leaves the storage uninitialized.
+    UnrolledListNode() noexcept {}
+
+    [[nodiscard]]
+    auto data() noexcept -> T* {
+        return std::launder(reinterpret_cast<T*>(storage));
+    }
+
+    [[nodiscard]]
+    auto data() const noexcept -> const T* {
+        return std::launder(reinterpret_cast<const T*>(storage));
+    }
+
+    alignas(T) unsigned char storage[sizeof(T) * Capacity];
+};
+}  // namespace detail
+
+//! UnrolledList is a singly linked list whose nodes hold up to NodeCapacity elements,
+//! so traversal chases one pointer per node instead of one per element,
+//! and the elements of a node are contiguous in memory.
+//! Access is O(N), unless it is the front which is O(1).
+//! insert_after and erase_after are O(NodeCapacity).
+//! A full node is split in half on insertion, and a node that falls under half full
+//! on erasure is merged with the next one when they fit in a single node.
+//! insert_after and erase_after invalidate the iterators to the elements of the nodes
+//! they modify.
+//! @param T the type of the stored element
+//! @param NodeCapacity the maximum amount of elements per node, must be at least 2
+//! @param Alloc must be an allocator that satisfies the Allocator concept
+template<typename T, std::size_t NodeCapacity = std::max<std::size_t>(64 / sizeof(T), 4),
+         CAllocator Alloc = std::allocator<T>>
+class UnrolledList {
+private:
+    using node_base = detail::UnrolledListNodeBase;
+    using node      = detail::UnrolledListNode<T, NodeCapacity>;
+
+    template<bool Const>
+    class Iterator;
+
+public:
+    static_assert(NodeCapacity >= 2, "xme::UnrolledList must have a NodeCapacity of at least 2");
+    static_assert(std::is_same_v<T, std::remove_cv_t<T>>,
+                  "xme::UnrolledList must have a non-const and non-volatile T");
+    static_assert(std::is_same_v<T, typename Alloc::value_type>,
+                  "xme::UnrolledList must have the same T as its allocator");
+
+    using allocator_type = typename std::allocator_traits<Alloc>::template rebind_alloc<node>;
+
+private:
+    using alloc_traits = std::allocator_traits<allocator_type>;
+
+public:
+    using size_type       = std::size_t;
+    using difference_type = std::ptrdiff_t;
+    using value_type      = T;
+    using pointer         = T*;
+    using const_pointer   = const T*;
+    using reference       = T&;
+    using const_reference = const T&;
+    using iterator        = Iterator<false>;
+    using const_iterator  = Iterator<true>;
+
+    UnrolledList() noexcept(std::is_nothrow_default_constructible_v<allocator_type>) = default;
+
+    //! Constructs N elements with value
+    UnrolledList(size_type n, const T& value) {
+        node_base* tail = &m_head;
+        try {
+            for(; n > 0; --n)
+                tail = append(tail, value);
+        }
+        catch(...) {
+            clear();
+            throw;
+        }
+    }
+
+    //! Constructs an UnrolledList from a [first, end) range
+    template<std::input_iterator Iter, std::sentinel_for<Iter> Sent>
+    UnrolledList(Iter first, Sent last) {
+        append_range(first, last);
+    }
+
+    //! Constructs an UnrolledList with the initializer_list syntax
+    explicit UnrolledList(std::initializer_list<T> list) :
+      UnrolledList(list.begin(), list.end()) {}
+
+    //! Constructs an UnrolledList from [begin(range), end(range)) range
+    template<std::ranges::input_range R>
+        requires(std::convertible_to<std::ranges::range_reference_t<R>, T>)
+    explicit UnrolledList(R&& range) :
+      UnrolledList(std::ranges::begin(range), std::ranges::end(range)) {}
+
+    UnrolledList(const UnrolledList& other) :
+      m_allocator(alloc_traits::select_on_container_copy_construction(other.m_allocator)) {
+        append_range(other.begin(), other.end());
+    }
+
+    UnrolledList(UnrolledList&& other) noexcept :
+      m_allocator(other.m_allocator), m_size(std::exchange(other.m_size, 0)) {
+        m_head.next = std::exchange(other.m_head.next, nullptr);
+    }
+
+    ~UnrolledList() noexcept { clear(); }
+
+    auto operator=(const UnrolledList& other) -> UnrolledList& {
+        if(this == &other)
+            return *this;
+        clear();
+        append_range(other.begin(), other.end());
+        return *this;
+    }
+
+    auto operator=(UnrolledList&& other) noexcept -> UnrolledList& {
+        clear();
+        std::ranges::swap(m_head.next, other.m_head.next);
+        std::ranges::swap(m_size, other.m_size);
+        if constexpr(alloc_traits::propagate_on_container_move_assignment::value)
+            m_allocator = other.m_allocator;
+        return *this;
+    }
+
+    //! Returns a iterator to the head
+    auto before_begin() noexcept -> iterator { return {&m_head, size_type(-1)}; }
+    //! Returns a iterator to the head
+    auto before_begin() const noexcept -> const_iterator { return {&m_head, size_type(-1)}; }
+
+    //! Returns a iterator to the first element
+    auto begin() noexcept -> iterator { return {m_head.next, 0}; }
+    //! Returns a iterator to the first element
+    auto begin() const noexcept -> const_iterator { return {m_head.next, 0}; }
+
+    //! Returns a iterator representing the end of the UnrolledList
+    auto end() noexcept -> iterator { return {}; }
+    //! Returns a iterator representing the end of the UnrolledList
+    auto end() const noexcept -> const_iterator { return {}; }
+
+    //! Returns a const iterator to the first element
+    auto cbegin() const noexcept -> const_iterator { return begin(); }
+    //! Returns a const iterator representing the end of the UnrolledList
+    auto cend() const noexcept -> const_iterator { return end(); }
+
+    //! Returns a reference to the first element
+    auto front() noexcept -> reference { return *begin(); }
+    //! Returns a reference to the first element
+    auto front() const noexcept -> const_reference { return *begin(); }
+
+    [[nodiscard]]
+    auto size() const noexcept -> size_type {
+        return m_size;
+    }
+
+    //! Returns true if there are no elements in the UnrolledList
+    [[nodiscard]]
+    bool is_empty() const noexcept {
+        return m_size == 0;
+    }
+
+    //! Returns the maximum amount of elements per node
+    [[nodiscard]]
+    static constexpr auto node_capacity() noexcept -> size_type {
+        return NodeCapacity;
+    }
+
+    //! Erases every element in the UnrolledList
+    void clear() noexcept {
+        node_base* curr = m_head.next;
+        while(curr) {
+            node_base* next = curr->next;
+            destroy_node(static_cast<node*>(curr));
+            curr = next;
+        }
+        m_head.next = nullptr;
+        m_size      = 0;
+    }
+
+    //! Inserts an element at the front by copying value
+    void push_front(const T& value) { emplace_after(before_begin(), value); }
+    //! Inserts an element at the front by moving value
+    void push_front(T&& value) { emplace_after(before_begin(), std::move(value)); }
+
+    //! Erases the element at the front
+    void pop_front() noexcept { erase_after(before_begin()); }
+
+    //! Constructs an element at the front by forwarding args.
+    //! @returns a reference to the newly inserted element.
+    template<typename... Args>
+    auto emplace_front(Args&&... args) -> reference {
+        return *emplace_after(before_begin(), std::forward<Args>(args)...);
+    }
+
+    //! Inserts an element after pos.
+    //! @returns an iterator to the new element.
+    template<std::convertible_to<T> U>
+    auto insert_after(const_iterator pos, U&& value) -> iterator {
+        return emplace_after(pos, std::forward<U>(value));
+    }
+
+    //! Inserts a [first, last) range of elements after pos.
+    //! @returns an iterator to the last inserted element.
+    template<std::input_iterator Iter, std::sentinel_for<Iter> Sent>
+    auto insert_after(const_iterator pos, Iter first, Sent last) -> iterator {
+        iterator it = pos.to_mutable();
+        for(; first != last; ++first)
+            it = emplace_after(it, *first);
+        return it;
+    }
+
+    //! Inserts a [begin(range), end(range)) range of elements after pos
+    //! @returns an iterator to the last inserted element.
+    template<std::ranges::input_range R>
+        requires(std::is_convertible_v<std::ranges::range_reference_t<R>, T>)
+    auto insert_after(const_iterator pos, R&& range) -> iterator {
+        return insert_after(pos, std::ranges::begin(range), std::ranges::end(range));
+    }
+
+    //! Constructs an element after pos by forwarding args.
+    //! A full node is split in half, unless the element goes after its last element,
+    //! in which case it starts a new node.
+    //! @returns an iterator to the new element.
+    template<typename... Args>
+    auto emplace_after(const_iterator pos, Args&&... args) -> iterator {
+        node_base* target = pos.m_node;
+        size_type index   = pos.m_index + 1;
+        if(target == &m_head) {
+            index = 0;
+            if(m_head.next == nullptr || m_head.next->count == NodeCapacity)
+                target = link_new_node(&m_head);
+            else
+                target = m_head.next;
+        }
+        else if(target->count == NodeCapacity) {
+            if(index == NodeCapacity) {
+                target = link_new_node(target);
+                index  = 0;
+            }
+            else {
+                // args may refer to an element the split moves, so the value is made first
+                return insert_split(target, index, T(std::forward<Args>(args)...));
+            }
+        }
+        construct_in_node(target, index, std::forward<Args>(args)...);
+        ++m_size;
+        return {target, index};
+    }
+
+    //! Erases the element after pos.
+    //! @returns an iterator to the element after the erased one.
+    auto erase_after(const_iterator pos) noexcept -> iterator {
+        const_iterator next = std::next(pos);
+        assert(next != end());
+        auto* target          = static_cast<node*>(next.m_node);
+        const size_type index = next.m_index;
+
+        T* values = target->data();
+        std::move(values + index + 1, values + target->count, values + index);
+        std::destroy_at(values + target->count - 1);
+        --target->count;
+        --m_size;
+
+        if(target->count == 0) {
+            // The node held a single element, so pos is at its predecessor.
+            pos.m_node->next = target->next;
+            node_base* after = target->next;
+            destroy_node(target);
+            return {after, 0};
+        }
+        if(target->count < NodeCapacity / 2)
+            merge_next(target);
+        if(index == target->count)
+            return {target->next, 0};
+        return {target, index};
+    }
+
+    //! Calls f with every element in order.
+    //! Loops over the contiguous elements of each node, which is faster than the iterators.
+    template<typename F>
+    void for_each(F f) {
+        for(node_base* curr = m_head.next; curr; curr = curr->next) {
+            T* values = static_cast<node*>(curr)->data();
+            for(size_type i = 0; i < curr->count; ++i)
+                f(values[i]);
+        }
+    }
+
+    //! Calls f with every element in order.
+    //! Loops over the contiguous elements of each node, which is faster than the iterators.
+    template<typename F>
+    void for_each(F f) const {
+        for(const node_base* curr = m_head.next; curr; curr = curr->next) {
+            const T* values = static_cast<const node*>(curr)->data();
+            for(size_type i = 0; i < curr->count; ++i)
+                f(values[i]);
+        }
+    }
+
+    //! Reverses the list, making the last element the first
+    void reverse() noexcept {
+        node_base* reversed = nullptr;
+        node_base* curr     = m_head.next;
+        while(curr) {
+            node_base* next = curr->next;
+            T* values       = static_cast<node*>(curr)->data();
+            std::reverse(values, values + curr->count);
+            curr->next = reversed;
+            reversed   = curr;
+            curr       = next;
+        }
+        m_head.next = reversed;
+    }
+
+private:
+    [[nodiscard]]
+    auto create_node() -> node* {
+        node* new_node = alloc_traits::allocate(m_allocator, 1);
+        ::new(static_cast<void*>(new_node)) node;
+        return new_node;
+    }
+
+    void destroy_node(node* n) noexcept {
+        std::destroy_n(n->data(), n->count);
+        n->~node();
+        alloc_traits::deallocate(m_allocator, n, 1);
+    }
+
+    //! Links an empty node after prev.
+    auto link_new_node(node_base* prev) -> node_base* {
+        node* new_node = create_node();
+        new_node->next = prev->next;
+        prev->next     = new_node;
+        return new_node;
+    }
+
+    //! Appends value to tail, which must be the last node, or to a new node if it is full.
+    //! @returns the new last node
+    template<typename U>
+    auto append(node_base* tail, U&& value) -> node_base* {
+        if(tail == &m_head || tail->count == NodeCapacity)
+            tail = link_new_node(tail);
+        construct_in_node(tail, tail->count, std::forward<U>(value));
+        ++m_size;
+        return tail;
+    }
+
+    //! Appends a [first, last) range to an empty list, filling every node.
+    template<std::input_iterator Iter, std::sentinel_for<Iter> Sent>
+    void append_range(Iter first, Sent last) {
+        node_base* tail = &m_head;
+        try {
+            for(; first != last; ++first)
+                tail = append(tail, *first);
+        }
+        catch(...) {
+            clear();
+            throw;
+        }
+    }
+
+    //! Constructs an element in n, unlinking n if it is a new node and the constructor throws.
+    template<typename... Args>
+    void construct_in_node(node_base* n, size_type index, Args&&... args) {
+        try {
+            insert_in_node(static_cast<node*>(n), index, std::forward<Args>(args)...);
+        }
+        catch(...) {
+            if(n->count == 0)
+                unlink_empty_node(n);
+            throw;
+        }
+    }
+
+    void unlink_empty_node(node_base* n) noexcept {
+        node_base* prev = &m_head;
+        while(prev->next != n)
+            prev = prev->next;
+        prev->next = n->next;
+        destroy_node(static_cast<node*>(n));
+    }
+
+    template<typename... Args>
+    void insert_in_node(node* n, size_type index, Args&&... args) {
+        T* values = n->data();
+        if(index == n->count) {
+            std::construct_at(values + index, std::forward<Args>(args)...);
+        }
+        else {
+            T value(std::forward<Args>(args)...);
+            std::construct_at(values + n->count, std::move(values[n->count - 1]));
+            std::move_backward(values + index, values + n->count - 1, values + n->count);
+            values[index] = std::move(value);
+        }
+        ++n->count;
+    }
+
+    //! Splits the full node and inserts value at index, which is not past its end.
+    //! @returns an iterator to the new element.
+    auto insert_split(node_base* full, size_type index, T&& value) -> iterator {
+        node_base* target = full;
+        node_base* upper  = split(full);
+        if(index > target->count) {
+            index -= target->count;
+            target = upper;
+        }
+        construct_in_node(target, index, std::move(value));
+        ++m_size;
+        return {target, index};
+    }
+
+    //! Moves the upper half of a full node to a new node after it.
+    //! @returns the new node
+    auto split(node_base* full) -> node_base* {
+        auto* lower         = static_cast<node*>(full);
+        auto* upper         = static_cast<node*>(link_new_node(lower));
+        const size_type mid = NodeCapacity / 2;
+        relocate(lower->data() + mid, NodeCapacity - mid, upper->data());
+        lower->count = mid;
+        upper->count = NodeCapacity - mid;
+        return upper;
+    }
+
+    //! Moves the elements of the node after n to n, if they fit.
+    void merge_next(node* n) noexcept {
+        auto* next = static_cast<node*>(n->next);
+        if(next == nullptr || n->count + next->count > NodeCapacity)
+            return;
+        relocate(next->data(), next->count, n->data() + n->count);
+        n->count += next->count;
+        next->count = 0;
+        n->next     = next->next;
+        destroy_node(next);
+    }
+
+    static void relocate(T* first, size_type count, T* dest) noexcept {
+        static_assert(std::is_nothrow_move_constructible_v<T>,
+                      "xme::UnrolledList must have a nothrow move constructible T");
+        std::uninitialized_move_n(first, count, dest);
+        std::destroy_n(first, count);
+    }
+
+    node_base m_head;
+    [[no_unique_address]]
+    allocator_type m_allocator;
+    size_type m_size = 0;
+};
+
+//! Forward iterator over the elements of every node.
+template<typename T, std::size_t NodeCapacity, CAllocator Alloc>
+template<bool Const>
+class UnrolledList<T, NodeCapacity, Alloc>::Iterator {
+private:
+    friend class UnrolledList;
+
+public:
+    using difference_type   = std::ptrdiff_t;
+    using value_type        = T;
+    using reference         = std::conditional_t<Const, const T&, T&>;
+    using pointer           = std::conditional_t<Const, const T*, T*>;
+    using iterator_category = std::forward_iterator_tag;
+
+    template<bool>
+    friend class Iterator;
+
+    Iterator() noexcept = default;
+
+    Iterator(const node_base* n, size_type index) noexcept :
+      m_node(const_cast<node_base*>(n)), m_index(index) {}
+
+    Iterator(const Iterator<!Const>& it) noexcept
+        requires(Const)
+      : m_node(it.m_node), m_index(it.m_index) {}
+
+    auto operator*() const noexcept -> reference {
+        return static_cast<node*>(m_node)->data()[m_index];
+    }
+
+    auto operator->() const noexcept -> pointer {
+        return static_cast<node*>(m_node)->data() + m_index;
+    }
+
+    //! The head of the list has a count of 0, so before_begin moves to the first node.
+    auto operator++() noexcept -> Iterator& {
+        if(++m_index == m_node->count) {
+            m_node  = m_node->next;
+            m_index = 0;
+        }
+        return *this;
+    }
+
+    auto operator++(int) noexcept -> Iterator {
+        Iterator tmp{*this};
+        ++*this;
+        return tmp;
+    }
+
+    bool operator==(const Iterator& rhs) const noexcept = default;
+
+private:
+    [[nodiscard]]
+    auto to_mutable() const noexcept -> Iterator<false> {
+        return {m_node, m_index};
+    }
+
+    node_base* m_node = nullptr;
+    size_type m_index = 0;
+};
+}  // namespace xme
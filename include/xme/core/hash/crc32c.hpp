@@ -0,0 +1,158 @@
+#pragma once
+#include "../../../../private/core/byte_load.hpp"
+#include <array>
+#include <cstddef>
+#include <cstdint>
+#include <type_traits>
+#include <xme/container/array_view.hpp>
+#include <xme/hal/simd_detection.hpp>
+
+#if XME_USE_SIMD_SSE42 && (defined(__x86_64__) || defined(_M_X64))
+#    include <nmmintrin.h>
+#    define XME_CRC32C_HARDWARE true
+#else
+#    define XME_CRC32C_HARDWARE false
+#endif
+
+namespace xme::detail {
+//! The Castagnoli polynomial, bit reflected.
+inline constexpr std::uint32_t crc32c_polynomial = 0x82f6'3b78;
+
+using crc32c_table = std::array<std::array<std::uint32_t, 256>, 8>;
+
+//! table[k][v] is the crc of the byte v followed by k zero bytes,
+//! so 8 lookups advance the crc by 8 bytes.
+consteval auto make_crc32c_table() noexcept -> crc32c_table {
+    crc32c_table table{};
+    for(std::uint32_t v = 0; v < 256; ++v) {
+        std::uint32_t crc = v;
+        for(int bit = 0; bit < 8; ++bit)
+            crc = (crc & 1) ? (crc >> 1) ^ crc32c_polynomial : crc >> 1;
+        table[0][v] = crc;
+    }
+    for(std::size_t k = 1; k < 8; ++k) {
+        for(std::size_t v = 0; v < 256; ++v)
+            table[k][v] = (table[k - 1][v] >> 8) ^ table[0][table[k - 1][v] & 0xff];
+    }
+    return table;
+}
+
+inline constexpr crc32c_table crc32c_slices = make_crc32c_table();
+
+//! Slice-by-8 crc of n bytes, without the initial and final inversions.
+[[nodiscard]]
+constexpr auto crc32c_software(std::uint32_t crc, const std::byte* data, std::size_t n) noexcept
+  -> std::uint32_t {
+    const crc32c_table& t = crc32c_slices;
+    for(; n >= 8; n -= 8, data += 8) {
+        const std::uint64_t word = load_le<std::uint64_t>(data) ^ crc;
+        crc = t[7][word & 0xff] ^ t[6][(word >> 8) & 0xff] ^ t[5][(word >> 16) & 0xff]
+            ^ t[4][(word >> 24) & 0xff] ^ t[3][(word >> 32) & 0xff] ^ t[2][(word >> 40) & 0xff]
+            ^ t[1][(word >> 48) & 0xff] ^ t[0][word >> 56];
+    }
+    for(; n > 0; --n, ++data)
+        crc = (crc >> 8) ^ t[0][(crc ^ static_cast<std::uint32_t>(*data)) & 0xff];
+    return crc;
+}
+
+#if XME_CRC32C_HARDWARE
+//! Product of a and b modulo the polynomial, in the reflected order where x^0 is the high bit.
+//! a must not be zero.
+consteval auto crc32c_multiply(std::uint32_t a, std::uint32_t b) noexcept -> std::uint32_t {
+    std::uint32_t product = 0;
+    for(std::uint32_t m = 1u << 31;; m >>= 1) {
+        if(a & m) {
+            product ^= b;
+            if((a & (m - 1)) == 0)
+                return product;
+        }
+        b = (b & 1) ? (b >> 1) ^ crc32c_polynomial : b >> 1;
+    }
+}
+
+//! table[k][v] is the crc register (v << 8k) advanced over Bytes zero bytes, which is
+//! the product with x^(8 * Bytes). The register is linear, so 4 lookups shift any value.
+template<std::size_t Bytes>
+consteval auto make_crc32c_shift_table() noexcept -> std::array<std::array<std::uint32_t, 256>, 4> {
+    std::uint32_t power  = 1u << 31;  // x^0
+    std::uint32_t square = 1u << 30;  // x^1, squared up to x^(2^k)
+    for(std::size_t bits = 8 * Bytes; bits != 0; bits >>= 1) {
+        if(bits & 1)
+            power = crc32c_multiply(square, power);
+        square = crc32c_multiply(square, square);
+    }
+    std::array<std::array<std::uint32_t, 256>, 4> table{};
+    for(std::uint32_t k = 0; k < 4; ++k) {
+        for(std::uint32_t v = 0; v < 256; ++v)
+            table[k][v] = crc32c_multiply(power, v << (8 * k));
+    }
+    return table;
+}
+
+template<std::size_t Bytes>
+inline constexpr auto crc32c_shift_table = make_crc32c_shift_table<Bytes>();
+
+template<std::size_t Bytes>
+[[nodiscard]]
+inline auto crc32c_shift(std::uint32_t crc) noexcept -> std::uint32_t {
+    const auto& t = crc32c_shift_table<Bytes>;
+    return t[0][crc & 0xff] ^ t[1][(crc >> 8) & 0xff] ^ t[2][(crc >> 16) & 0xff]
+         ^ t[3][crc >> 24];
+}
+
+//! Runs the crc32 instruction over three blocks of Block bytes at once, which hides
+//! its 3 cycle latency, then shifts the first two streams over the blocks after them.
+template<std::size_t Block>
+inline auto crc32c_interleaved(std::uint64_t crc, const std::byte*& data, std::size_t& n) noexcept
+  -> std::uint64_t {
+    for(; n >= 3 * Block; n -= 3 * Block, data += 3 * Block) {
+        std::uint64_t crc1 = 0;
+        std::uint64_t crc2 = 0;
+        for(std::size_t i = 0; i < Block; i += 8) {
+            crc  = _mm_crc32_u64(crc, load_le<std::uint64_t>(data + i));
+            crc1 = _mm_crc32_u64(crc1, load_le<std::uint64_t>(data + Block + i));
+            crc2 = _mm_crc32_u64(crc2, load_le<std::uint64_t>(data + 2 * Block + i));
+        }
+        crc = crc32c_shift<Block>(static_cast<std::uint32_t>(crc)) ^ crc1;
+        crc = crc32c_shift<Block>(static_cast<std::uint32_t>(crc)) ^ crc2;
+    }
+    return crc;
+}
+
+//! SSE4.2 crc of n bytes, without the initial and final inversions.
+[[nodiscard]]
+inline auto crc32c_hardware(std::uint32_t crc32, const std::byte* data, std::size_t n) noexcept
+  -> std::uint32_t {
+    for(; n > 0 && (reinterpret_cast<std::uintptr_t>(data) & 7) != 0; --n, ++data)
+        crc32 = _mm_crc32_u8(crc32, static_cast<std::uint8_t>(*data));
+    std::uint64_t crc = crc32;
+    crc               = crc32c_interleaved<8192>(crc, data, n);
+    crc               = crc32c_interleaved<256>(crc, data, n);
+    for(; n >= 8; n -= 8, data += 8)
+        crc = _mm_crc32_u64(crc, load_le<std::uint64_t>(data));
+    crc32 = static_cast<std::uint32_t>(crc);
+    for(; n > 0; --n, ++data)
+        crc32 = _mm_crc32_u8(crc32, static_cast<std::uint8_t>(*data));
+    return crc32;
+}
+#endif
+}  // namespace xme::detail
+
+namespace xme {
+//! Computes the CRC-32C (Castagnoli) checksum of data, as used by iSCSI, ext4 and SCTP.
+//! Uses the SSE4.2 crc32 instruction when enabled through xme::hal::enabled_simd,
+//! and 8 table lookups per 8 bytes otherwise.
+//! @param crc the checksum of the preceding bytes, to checksum a record in parts
+//! @returns the checksum of the preceding bytes followed by data
+[[nodiscard]]
+constexpr auto crc32c(ArrayView<const std::byte> data, std::uint32_t crc = 0) noexcept
+  -> std::uint32_t {
+#if XME_CRC32C_HARDWARE
+    if(!std::is_constant_evaluated())
+        return ~detail::crc32c_hardware(~crc, data.data(), data.size());
+#endif
+    return ~detail::crc32c_software(~crc, data.data(), data.size());
+}
+}  // namespace xme
+
+#undef XME_CRC32C_HARDWARE
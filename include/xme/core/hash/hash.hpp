@@ -0,0 +1,249 @@
+#pragma once
+#include "../../../../private/core/byte_load.hpp"
+#include <bit>
+#include <concepts>
+#include <cstddef>
+#include <cstdint>
+#include <ranges>
+#include <string>
+#include <string_view>
+#include <type_traits>
+#include <utility>
+#include <xme/container/array_view.hpp>
+#include <xme/container/concepts.hpp>
+#include <xme/core/concepts/arithmetic.hpp>
+
+namespace xme::math {
+template<CArithmetic T, std::size_t Size>
+struct Vector;
+}  // namespace xme::math
+
+namespace xme {
+template<typename T>
+struct Hash;
+
+//! A type that Hash, or a specialization of it, can hash
+template<typename T>
+concept CHashable = requires(const Hash<T>& hash, const T& value) {
+    { hash(value) } -> std::convertible_to<std::size_t>;
+};
+}  // namespace xme
+
+namespace xme::detail {
+inline constexpr std::uint64_t hash_secret[4] = {0x2d35'8dcc'aa6c'78a5ull,
+                                                 0x8bb8'4b93'962e'acc9ull,
+                                                 0x4b33'a62e'd433'd4a3ull,
+                                                 0x4d5a'2da5'1de1'aa47ull};
+
+//! Replaces a and b with the low and high halves of their 128 bit product.
+constexpr void multiply(std::uint64_t& a, std::uint64_t& b) noexcept {
+#if defined(__SIZEOF_INT128__)
+    __extension__ typedef unsigned __int128 uint128;
+    const uint128 product = static_cast<uint128>(a) * b;
+    a                     = static_cast<std::uint64_t>(product);
+    b                     = static_cast<std::uint64_t>(product >> 64);
+#else
+    const std::uint64_t low_low   = (a & 0xffff'ffff) * (b & 0xffff'ffff);
+    const std::uint64_t high_low  = (a >> 32) * (b & 0xffff'ffff);
+    const std::uint64_t low_high  = (a & 0xffff'ffff) * (b >> 32);
+    const std::uint64_t high_high = (a >> 32) * (b >> 32);
+    const std::uint64_t cross     = (low_low >> 32) + (high_low & 0xffff'ffff) + low_high;
+    a                             = (cross << 32) | (low_low & 0xffff'ffff);
+    b                             = high_high + (high_low >> 32) + (cross >> 32);
+#endif
+}
+
+//! Xor of the low and high halves of the 128 bit product of a and b.
+[[nodiscard]]
+constexpr auto multiply_fold(std::uint64_t a, std::uint64_t b) noexcept -> std::uint64_t {
+    multiply(a, b);
+    return a ^ b;
+}
+
+//! The wyhash (final 4) function, which reads 48 bytes per iteration in three independent
+//! multiply chains. Inputs are read as little endian, so hashes match on every target.
+[[nodiscard]]
+constexpr auto hash_bytes(const std::byte* p, std::size_t n, std::uint64_t seed) noexcept
+  -> std::uint64_t {
+    const auto& s = hash_secret;
+    seed ^= multiply_fold(seed ^ s[0], s[1]);
+    std::uint64_t a = 0;
+    std::uint64_t b = 0;
+    if(n <= 16) {
+        if(n >= 4) {
+            const std::size_t middle = (n >> 3) << 2;
+            a = (std::uint64_t{load_le<std::uint32_t>(p)} << 32)
+              | load_le<std::uint32_t>(p + middle);
+            b = (std::uint64_t{load_le<std::uint32_t>(p + n - 4)} << 32)
+              | load_le<std::uint32_t>(p + n - 4 - middle);
+        } else if(n > 0) {
+            a = (std::uint64_t(p[0]) << 16) | (std::uint64_t(p[n >> 1]) << 8)
+              | std::uint64_t(p[n - 1]);
+        }
+    } else {
+        std::size_t i = n;
+        if(i >= 48) {
+            std::uint64_t seed1 = seed;
+            std::uint64_t seed2 = seed;
+            do {
+                seed  = multiply_fold(load_le<std::uint64_t>(p) ^ s[1],
+                                      load_le<std::uint64_t>(p + 8) ^ seed);
+                seed1 = multiply_fold(load_le<std::uint64_t>(p + 16) ^ s[2],
+                                      load_le<std::uint64_t>(p + 24) ^ seed1);
+                seed2 = multiply_fold(load_le<std::uint64_t>(p + 32) ^ s[3],
+                                      load_le<std::uint64_t>(p + 40) ^ seed2);
+                p += 48;
+                i -= 48;
+            } while(i >= 48);
+            seed ^= seed1 ^ seed2;
+        }
+        for(; i > 16; i -= 16, p += 16) {
+            seed = multiply_fold(load_le<std::uint64_t>(p) ^ s[1],
+                                 load_le<std::uint64_t>(p + 8) ^ seed);
+        }
+        a = load_le<std::uint64_t>(p + i - 16);
+        b = load_le<std::uint64_t>(p + i - 8);
+    }
+    a ^= s[1];
+    b ^= seed;
+    multiply(a, b);
+    return multiply_fold(a ^ s[0] ^ n, b ^ s[1]);
+}
+
+//! Combines the hash of the next element of a composite into h.
+[[nodiscard]]
+constexpr auto hash_combine(std::uint64_t h, std::uint64_t element) noexcept -> std::uint64_t {
+    return multiply_fold(h ^ hash_secret[0], element ^ hash_secret[1]);
+}
+
+template<typename T>
+[[nodiscard]]
+constexpr auto hash_element(const T& value) noexcept -> std::uint64_t {
+    return static_cast<std::uint64_t>(Hash<T>{}(value));
+}
+
+template<typename T>
+constexpr bool is_math_vector = false;
+template<typename T, std::size_t Size>
+constexpr bool is_math_vector<math::Vector<T, Size>> = true;
+
+//! Scalars whose equal values have equal bytes, so ranges of them are hashed as bytes
+template<typename T>
+concept hashed_as_bytes = std::is_integral_v<T> || std::is_enum_v<T> || std::is_pointer_v<T>;
+
+template<typename R>
+concept byte_hashable_range = std::ranges::contiguous_range<const R>
+                           && std::ranges::sized_range<const R>
+                           && hashed_as_bytes<std::ranges::range_value_t<const R>>;
+
+template<typename T, std::size_t... I>
+consteval bool tuple_elements_hashable(std::index_sequence<I...>) noexcept {
+    return (CHashable<std::remove_cvref_t<std::tuple_element_t<I, T>>> && ...);
+}
+
+template<typename T>
+concept default_hashable =
+  std::is_arithmetic_v<T> || std::is_enum_v<T> || std::is_pointer_v<T>
+  || std::is_null_pointer_v<T> || byte_hashable_range<T>
+  || (CTupleLike<T>
+      && tuple_elements_hashable<T>(std::make_index_sequence<std::tuple_size_v<T>>{}))
+  || (is_math_vector<T> && CHashable<std::remove_cvref_t<decltype(std::declval<T>()[0])>>)
+  || (std::ranges::input_range<const T> && CHashable<std::ranges::range_value_t<const T>>);
+
+template<typename T>
+[[nodiscard]]
+auto hash_range_bytes(const T& range) noexcept -> std::uint64_t {
+    const auto size = static_cast<std::size_t>(std::ranges::size(range));
+    const auto* p   = reinterpret_cast<const std::byte*>(std::ranges::data(range));
+    return hash_bytes(p, size * sizeof(std::ranges::range_value_t<const T>), 0);
+}
+
+template<default_hashable T>
+[[nodiscard]]
+constexpr auto hash_value(const T& value) noexcept -> std::uint64_t {
+    if constexpr(std::is_integral_v<T>)
+        return hash_combine(0, static_cast<std::uint64_t>(value));
+    else if constexpr(std::is_enum_v<T>)
+        return hash_value(static_cast<std::underlying_type_t<T>>(value));
+    else if constexpr(std::is_null_pointer_v<T>)
+        return hash_combine(0, 0);
+    else if constexpr(std::is_pointer_v<T>)
+        return hash_combine(0, reinterpret_cast<std::uintptr_t>(value));
+    else if constexpr(std::is_floating_point_v<T>) {
+        // 0.0 and -0.0 compare equal, so they must hash alike
+        if(value == T(0))
+            return hash_combine(0, 0);
+        if constexpr(sizeof(T) == sizeof(std::uint64_t))
+            return hash_combine(0, std::bit_cast<std::uint64_t>(value));
+        else if constexpr(sizeof(T) == sizeof(std::uint32_t))
+            return hash_combine(0, std::bit_cast<std::uint32_t>(value));
+        else
+            return hash_value(static_cast<double>(value));
+    } else if constexpr(byte_hashable_range<T>) {
+        return hash_range_bytes(value);
+    } else if constexpr(CTupleLike<T>) {
+        return [&]<std::size_t... I>(std::index_sequence<I...>) {
+            std::uint64_t h = std::tuple_size_v<T>;
+            ((h = hash_combine(
+                h, hash_element<std::remove_cvref_t<std::tuple_element_t<I, T>>>(get<I>(value)))),
+             ...);
+            return h;
+        }(std::make_index_sequence<std::tuple_size_v<T>>{});
+    } else if constexpr(is_math_vector<T>) {
+        std::uint64_t h = T::size;
+        for(std::size_t i = 0; i < T::size; ++i)
+            h = hash_combine(h, hash_element(value[i]));
+        return h;
+    } else {
+        std::uint64_t h    = 0;
+        std::uint64_t size = 0;
+        for(const auto& element : value) {
+            h = hash_combine(h, hash_element<std::ranges::range_value_t<const T>>(element));
+            ++size;
+        }
+        return hash_combine(h, size);
+    }
+}
+}  // namespace xme::detail
+
+namespace xme {
+//! Hash is a fast 64 bit hash function object, usable as the Hash of HashMap and HashSet.
+//! It hashes integers with a single multiplication, strings and other contiguous ranges of
+//! integers as one buffer, and Tuple, Pair, math vectors and any other range element wise.
+//! Specialize Hash for your own types, the specialization is then used for the elements
+//! of the types above too.
+//! The hashes are not cryptographic and not meant to be persisted.
+template<typename T>
+struct Hash {
+    [[nodiscard]]
+    constexpr auto operator()(const T& value) const noexcept -> std::size_t
+        requires detail::default_hashable<T>
+    {
+        return static_cast<std::size_t>(detail::hash_value(value));
+    }
+};
+
+//! Strings are hashed as their characters, so a std::string can be looked up with a
+//! std::string_view in a HashMap whose KeyEqual is transparent too.
+template<typename C, typename Traits, typename Alloc>
+struct Hash<std::basic_string<C, Traits, Alloc>> {
+    using is_transparent = void;
+
+    [[nodiscard]]
+    auto operator()(std::basic_string_view<C, Traits> value) const noexcept -> std::size_t {
+        return static_cast<std::size_t>(detail::hash_range_bytes(value));
+    }
+};
+
+template<typename C, typename Traits>
+struct Hash<std::basic_string_view<C, Traits>> : Hash<std::basic_string<C, Traits>> {};
+
+//! Hashes the bytes of data with wyhash, at several GB/s for long inputs.
+//! @param seed selects one of many hash functions, to keep inputs from targeting one
+//! @returns a 64 bit hash of data
+[[nodiscard]]
+inline auto hash_bytes(ArrayView<const std::byte> data, std::uint64_t seed = 0) noexcept
+  -> std::uint64_t {
+    return detail::hash_bytes(data.data(), data.size(), seed);
+}
+}  // namespace xme
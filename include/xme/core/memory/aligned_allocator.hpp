@@ -0,0 +1,78 @@
+#pragma once
+#include <algorithm>
+#include <bit>
+#include <cstddef>
+#include <limits>
+#include <new>
+#include <type_traits>
+#include <xme/core/memory/allocate_at_least.hpp>
+
+namespace xme {
+//! AlignedAllocator allocates arrays starting at a multiple of Align, like a cache line
+//! to avoid false sharing, or 64 bytes for aligned AVX-512 loads.
+//! Sizes are rounded up to a multiple of Align, and allocate_at_least gives the slack
+//! to the container, so SIMD loops can load whole vectors up to the end of the capacity.
+//! @param T the type of the allocated object
+//! @param Align must be a power of 2, at least alignof(T)
+template<typename T, std::size_t Align = 64>
+class AlignedAllocator {
+public:
+    static_assert(std::has_single_bit(Align), "Align must be a power of 2");
+    static_assert(Align >= alignof(T), "Align must be at least alignof(T)");
+
+    using value_type      = T;
+    using size_type       = std::size_t;
+    using difference_type = std::ptrdiff_t;
+
+    using propagate_on_container_copy_assignment = std::true_type;
+    using propagate_on_container_move_assignment = std::true_type;
+    using propagate_on_container_swap            = std::true_type;
+    using is_always_equal                        = std::true_type;
+
+    static constexpr std::size_t alignment = Align;
+
+    template<typename U>
+    struct rebind {
+        using other = AlignedAllocator<U, std::max(Align, alignof(U))>;
+    };
+
+    constexpr AlignedAllocator() noexcept = default;
+
+    template<typename U, std::size_t A>
+    constexpr AlignedAllocator(const AlignedAllocator<U, A>&) noexcept {}
+
+    [[nodiscard]]
+    auto allocate(std::size_t n) -> T* {
+        return static_cast<T*>(::operator new(bytes_of(n), std::align_val_t(Align)));
+    }
+
+    //! Allocates n objects, rounded up to fill a multiple of Align bytes.
+    [[nodiscard]]
+    auto allocate_at_least(std::size_t n) -> AllocationResult<T*> {
+        const std::size_t bytes = bytes_of(n);
+        return {static_cast<T*>(::operator new(bytes, std::align_val_t(Align))),
+                bytes / sizeof(T)};
+    }
+
+    void deallocate(T* p, std::size_t n) noexcept {
+        ::operator delete(p, round_up(n * sizeof(T)), std::align_val_t(Align));
+    }
+
+    friend constexpr bool operator==(const AlignedAllocator&, const AlignedAllocator&) noexcept {
+        return true;
+    }
+
+private:
+    [[nodiscard]]
+    static constexpr auto round_up(std::size_t bytes) noexcept -> std::size_t {
+        return (bytes + Align - 1) & ~(Align - 1);
+    }
+
+    [[nodiscard]]
+    static constexpr auto bytes_of(std::size_t n) -> std::size_t {
+        if(n > (std::numeric_limits<std::size_t>::max() - Align) / sizeof(T))
+            throw std::bad_array_new_length();
+        return round_up(n * sizeof(T));
+    }
+};
+}  // namespace xme
@@ -0,0 +1,44 @@
+#pragma once
+#include <cstddef>
+#include <memory>
+
+namespace xme {
+//! Result of xme::allocate_at_least, holds the pointer and the amount of elements
+//! that were really allocated.
+template<typename Pointer, typename SizeType = std::size_t>
+struct AllocationResult {
+    Pointer ptr;
+    SizeType count;
+};
+
+namespace detail {
+template<typename Alloc>
+concept CHasAllocateAtLeast = requires(Alloc& alloc, std::size_t n) {
+    { alloc.allocate_at_least(n) };
+};
+}  // namespace detail
+
+//! Allocates memory for at least n elements.
+//! Uses Alloc::allocate_at_least when available, so the caller can use the slack given by
+//! the allocator, otherwise falls back to allocate(n).
+//! The returned count must be passed to deallocate.
+template<typename Alloc>
+[[nodiscard]]
+constexpr auto allocate_at_least(Alloc& alloc, std::size_t n)
+  -> AllocationResult<typename std::allocator_traits<Alloc>::pointer,
+                      typename std::allocator_traits<Alloc>::size_type> {
+    if constexpr(detail::CHasAllocateAtLeast<Alloc>) {
+        auto [ptr, count] = alloc.allocate_at_least(n);
+        return {ptr, count};
+    }
+#if defined(__cpp_lib_allocate_at_least)
+    else if constexpr(requires { std::allocator_traits<Alloc>::allocate_at_least(alloc, n); }) {
+        auto [ptr, count] = std::allocator_traits<Alloc>::allocate_at_least(alloc, n);
+        return {ptr, count};
+    }
+#endif
+    else {
+        return {alloc.allocate(n), n};
+    }
+}
+}  // namespace xme
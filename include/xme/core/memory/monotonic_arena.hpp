@@ -0,0 +1,183 @@
+#pragma once
+#include <algorithm>
+#include <cstddef>
+#include <cstdint>
+#include <limits>
+#include <memory>
+#include <new>
+#include <type_traits>
+#include <utility>
+
+namespace xme {
+//! MonotonicArena hands out memory by bumping a pointer through a chain of blocks, and only
+//! releases it all at once, through reset or its destructor. Scratch data that dies together,
+//! like the objects of a request, is then allocated in a few instructions and freed for free.
+//! The first block can be a buffer given by the user, like an array on the stack,
+//! the next blocks come from the global allocator and double in size up to max_block_size.
+//! Not thread safe, and neither copyable nor movable since allocators point to it.
+class MonotonicArena {
+private:
+    struct Block {
+        Block* next;
+        std::size_t bytes;
+    };
+
+public:
+    static constexpr std::size_t default_block_size = 4096;
+    static constexpr std::size_t max_block_size     = std::size_t(1) << 20;
+
+    MonotonicArena() noexcept = default;
+
+    //! Creates an arena whose first block from the global allocator has block_size bytes.
+    explicit MonotonicArena(std::size_t block_size) noexcept :
+      m_next_block_size(std::max(block_size, sizeof(Block) + 1)) {}
+
+    //! Creates an arena that allocates from buffer first, which must outlive the arena.
+    MonotonicArena(void* buffer, std::size_t size,
+                   std::size_t block_size = default_block_size) noexcept :
+      m_cursor(static_cast<std::byte*>(buffer)),
+      m_end(m_cursor + size),
+      m_buffer(m_cursor),
+      m_buffer_end(m_end),
+      m_next_block_size(std::max(block_size, sizeof(Block) + 1)) {}
+
+    MonotonicArena(const MonotonicArena&) = delete;
+
+    auto operator=(const MonotonicArena&) -> MonotonicArena& = delete;
+
+    ~MonotonicArena() noexcept {
+        release(m_blocks);
+        release(m_spare);
+    }
+
+    //! Allocates bytes aligned to align, which must be a power of 2.
+    [[nodiscard]]
+    auto allocate(std::size_t bytes, std::size_t align = alignof(std::max_align_t)) -> void* {
+        const auto cursor         = reinterpret_cast<std::uintptr_t>(m_cursor);
+        const std::size_t padding = ((cursor + align - 1) & ~(align - 1)) - cursor;
+        if(padding <= remaining() && bytes <= remaining() - padding) [[likely]] {
+            std::byte* p = m_cursor + padding;
+            m_cursor     = p + bytes;
+            return p;
+        }
+        return allocate_from_new_block(bytes, align);
+    }
+
+    //! Does nothing, memory is only released by reset and the destructor.
+    void deallocate(void*, std::size_t, std::size_t = alignof(std::max_align_t)) noexcept {}
+
+    //! Releases every allocation at once. The largest block is kept for the next
+    //! allocations and the others are returned to the global allocator.
+    void reset() noexcept {
+        Block* largest = m_spare;
+        for(Block* block = m_blocks; block != nullptr;) {
+            Block* next = block->next;
+            if(largest == nullptr || block->bytes > largest->bytes) {
+                release_block(largest);
+                largest       = block;
+                largest->next = nullptr;
+            } else {
+                release_block(block);
+            }
+            block = next;
+        }
+        m_spare  = largest;
+        m_blocks = nullptr;
+        m_cursor = m_buffer;
+        m_end    = m_buffer_end;
+    }
+
+    //! @returns the bytes left in the current block
+    [[nodiscard]]
+    auto remaining() const noexcept -> std::size_t {
+        return static_cast<std::size_t>(m_end - m_cursor);
+    }
+
+private:
+    static void release_block(Block* block) noexcept {
+        if(block)
+            ::operator delete(block, block->bytes);
+    }
+
+    static void release(Block* blocks) noexcept {
+        while(blocks) {
+            Block* next = blocks->next;
+            release_block(blocks);
+            blocks = next;
+        }
+    }
+
+    auto allocate_from_new_block(std::size_t bytes, std::size_t align) -> void* {
+        constexpr std::size_t header = sizeof(Block);
+        if(bytes > std::numeric_limits<std::size_t>::max() - header - align)
+            throw std::bad_alloc();
+        const std::size_t needed = header + bytes + align - 1;
+        Block* block             = nullptr;
+        if(m_spare && m_spare->bytes >= needed) {
+            block = std::exchange(m_spare, nullptr);
+        } else {
+            const std::size_t size = std::max(needed, m_next_block_size);
+            block                  = static_cast<Block*>(::operator new(size));
+            block->bytes           = size;
+            m_next_block_size      = std::min(2 * m_next_block_size, max_block_size);
+        }
+        block->next = m_blocks;
+        m_blocks    = block;
+        m_cursor    = reinterpret_cast<std::byte*>(block) + header;
+        m_end       = reinterpret_cast<std::byte*>(block) + block->bytes;
+        return allocate(bytes, align);
+    }
+
+    std::byte* m_cursor           = nullptr;
+    std::byte* m_end              = nullptr;
+    std::byte* m_buffer           = nullptr;  // the user buffer, allocated from first
+    std::byte* m_buffer_end       = nullptr;
+    Block* m_blocks               = nullptr;  // in use, the current one first
+    Block* m_spare                = nullptr;  // kept by reset
+    std::size_t m_next_block_size = default_block_size;
+};
+
+//! ArenaAllocator allocates from a MonotonicArena, so containers like Array, LinkedList and
+//! SPSCQueue can put their scratch data in it. Allocation is a pointer bump and
+//! deallocation does nothing, the memory is released with the arena.
+//! Copies and rebound copies allocate from the same arena, which must outlive them.
+//! @param T the type of the allocated object
+template<typename T>
+class ArenaAllocator {
+public:
+    using value_type      = T;
+    using size_type       = std::size_t;
+    using difference_type = std::ptrdiff_t;
+
+    using propagate_on_container_copy_assignment = std::true_type;
+    using propagate_on_container_move_assignment = std::true_type;
+    using propagate_on_container_swap            = std::true_type;
+    using is_always_equal                        = std::false_type;
+
+    ArenaAllocator(MonotonicArena& arena) noexcept : m_arena(&arena) {}
+
+    template<typename U>
+    ArenaAllocator(const ArenaAllocator<U>& other) noexcept : m_arena(&other.arena()) {}
+
+    [[nodiscard]]
+    auto allocate(std::size_t n) -> T* {
+        if(n > std::numeric_limits<std::size_t>::max() / sizeof(T))
+            throw std::bad_array_new_length();
+        return static_cast<T*>(m_arena->allocate(n * sizeof(T), alignof(T)));
+    }
+
+    void deallocate(T*, std::size_t) noexcept {}
+
+    [[nodiscard]]
+    auto arena() const noexcept -> MonotonicArena& {
+        return *m_arena;
+    }
+
+    friend bool operator==(const ArenaAllocator& lhs, const ArenaAllocator& rhs) noexcept {
+        return lhs.m_arena == rhs.m_arena;
+    }
+
+private:
+    MonotonicArena* m_arena;
+};
+}  // namespace xme
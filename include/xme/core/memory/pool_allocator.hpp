@@ -0,0 +1,226 @@
+#pragma once
+#include <algorithm>
+#include <cstddef>
+#include <memory>
+#include <new>
+#include <utility>
+#include <vector>
+
+namespace xme {
+namespace detail {
+//! Hands out fixed size nodes carved from large blocks.
+//! Freed nodes are kept in an intrusive free list and reused before carving new ones.
+class NodePool {
+private:
+    struct FreeNode {
+        FreeNode* next;
+    };
+
+    struct Block {
+        Block* next;
+        std::size_t bytes;
+    };
+
+public:
+    NodePool(std::size_t node_size, std::size_t node_align, std::size_t nodes_per_block) noexcept :
+      m_node_align(std::max(node_align, alignof(FreeNode))),
+      m_node_size(round_up(std::max(node_size, sizeof(FreeNode)), m_node_align)),
+      m_nodes_per_block(nodes_per_block) {}
+
+    NodePool(const NodePool&) = delete;
+
+    auto operator=(const NodePool&) -> NodePool& = delete;
+
+    ~NodePool() {
+        while(m_blocks) {
+            Block* next = m_blocks->next;
+            ::operator delete(m_blocks, m_blocks->bytes, std::align_val_t(block_align()));
+            m_blocks = next;
+        }
+    }
+
+    [[nodiscard]]
+    auto allocate() -> void* {
+        if(m_reserved > 0) {
+            --m_reserved;
+        }
+        else if(m_free) {
+            FreeNode* node = m_free;
+            m_free         = node->next;
+            return node;
+        }
+        if(m_cursor == m_end)
+            add_block(m_nodes_per_block);
+        void* node = m_cursor;
+        m_cursor += m_node_size;
+        return node;
+    }
+
+    void deallocate(void* p) noexcept {
+        FreeNode* node = ::new(p) FreeNode{m_free};
+        m_free         = node;
+    }
+
+    //! Makes sure the next n nodes are carved contiguously from the same block,
+    //! instead of reusing freed nodes.
+    void reserve(std::size_t n) {
+        m_reserved = n;
+        if(std::size_t(m_end - m_cursor) / m_node_size >= n)
+            return;
+        // The rest of the current block is kept in the free list.
+        for(; m_cursor != m_end; m_cursor += m_node_size)
+            deallocate(m_cursor);
+        add_block(std::max(n, m_nodes_per_block));
+    }
+
+private:
+    static constexpr auto round_up(std::size_t n, std::size_t align) noexcept -> std::size_t {
+        return (n + align - 1) / align * align;
+    }
+
+    [[nodiscard]]
+    auto block_align() const noexcept -> std::size_t {
+        return std::max(m_node_align, alignof(Block));
+    }
+
+    void add_block(std::size_t nodes) {
+        const std::size_t header = round_up(sizeof(Block), m_node_align);
+        const std::size_t bytes  = header + nodes * m_node_size;
+        auto* block  = static_cast<Block*>(::operator new(bytes, std::align_val_t(block_align())));
+        block->next  = m_blocks;
+        block->bytes = bytes;
+        m_blocks     = block;
+        m_cursor     = reinterpret_cast<std::byte*>(block) + header;
+        m_end        = m_cursor + nodes * m_node_size;
+    }
+
+    std::size_t m_node_align;
+    std::size_t m_node_size;
+    std::size_t m_nodes_per_block;
+    std::size_t m_reserved = 0;  // nodes that must be carved instead of taken from m_free
+    FreeNode* m_free       = nullptr;
+    Block* m_blocks        = nullptr;
+    std::byte* m_cursor    = nullptr;
+    std::byte* m_end       = nullptr;
+};
+
+//! The pools shared by an allocator and every allocator rebound from it, one per node size
+//! and alignment, so a node can be freed through any of them.
+class NodePoolSet {
+public:
+    //! @returns the pool of nodes of size and align, or nullptr if none
+    [[nodiscard]]
+    auto find(std::size_t size, std::size_t align) const noexcept -> NodePool* {
+        for(const Entry& entry : m_pools) {
+            if(entry.size == size && entry.align == align)
+                return entry.pool.get();
+        }
+        return nullptr;
+    }
+
+    //! @returns the pool of nodes of size and align, created with nodes_per_block if none
+    [[nodiscard]]
+    auto get(std::size_t size, std::size_t align, std::size_t nodes_per_block) -> NodePool& {
+        if(NodePool* pool = find(size, align))
+            return *pool;
+        auto pool = std::make_unique<NodePool>(size, align, nodes_per_block);
+        return *m_pools.emplace_back(Entry{size, align, std::move(pool)}).pool;
+    }
+
+private:
+    struct Entry {
+        std::size_t size;
+        std::size_t align;
+        std::unique_ptr<NodePool> pool;
+    };
+
+    std::vector<Entry> m_pools;
+};
+}  // namespace detail
+
+//! PoolAllocator allocates single objects from large contiguous blocks,
+//! which makes allocation and deallocation O(1) without calling the global allocator,
+//! and keeps objects allocated one after another close in memory.
+//! Allocations of more than 1 object go directly to the global allocator.
+//! Copies and rebound allocators share the same pools, which are released when the last of
+//! them is destroyed, so memory is only returned when the pools are destroyed. A rebound
+//! allocator uses the pool of its node size, and keeps NodesPerBlock. Only the default
+//! constructor allocates, so copies, moves and rebinds never throw.
+//! Not thread safe.
+//! @param T the type of the allocated object
+//! @param NodesPerBlock amount of objects carved from each block
+template<typename T, std::size_t NodesPerBlock = std::max<std::size_t>(4096 / sizeof(T), 16)>
+class PoolAllocator {
+public:
+    using value_type      = T;
+    using size_type       = std::size_t;
+    using difference_type = std::ptrdiff_t;
+
+    using propagate_on_container_copy_assignment = std::true_type;
+    using propagate_on_container_move_assignment = std::true_type;
+    using propagate_on_container_swap            = std::true_type;
+
+    template<typename U>
+    struct rebind {
+        using other = PoolAllocator<U, NodesPerBlock>;
+    };
+
+    PoolAllocator() : m_pools(std::make_shared<detail::NodePoolSet>()) {}
+
+    PoolAllocator(const PoolAllocator&) noexcept = default;
+
+    //! Copies, since a moved from allocator must stay unchanged and equal.
+    PoolAllocator(PoolAllocator&& other) noexcept : PoolAllocator(std::as_const(other)) {}
+
+    template<typename U, std::size_t N>
+    PoolAllocator(const PoolAllocator<U, N>& other) noexcept : m_pools(other.m_pools) {}
+
+    auto operator=(const PoolAllocator&) noexcept -> PoolAllocator& = default;
+
+    //! Copies, since a moved from allocator must stay unchanged and equal.
+    auto operator=(PoolAllocator&& other) noexcept -> PoolAllocator& {
+        return *this = std::as_const(other);
+    }
+
+    [[nodiscard]]
+    auto allocate(std::size_t n) -> T* {
+        if(n == 1)
+            return static_cast<T*>(pool().allocate());
+        return static_cast<T*>(::operator new(n * sizeof(T), std::align_val_t(alignof(T))));
+    }
+
+    void deallocate(T* p, std::size_t n) noexcept {
+        if(n == 1) {
+            // A node was allocated, so its pool exists
+            if(m_pool == nullptr)
+                m_pool = m_pools->find(sizeof(T), alignof(T));
+            m_pool->deallocate(p);
+        }
+        else
+            ::operator delete(p, n * sizeof(T), std::align_val_t(alignof(T)));
+    }
+
+    //! Makes sure the next n single object allocations are contiguous in memory.
+    void reserve(std::size_t n) { pool().reserve(n); }
+
+    template<typename U, std::size_t N>
+    auto operator==(const PoolAllocator<U, N>& other) const noexcept -> bool {
+        return m_pools == other.m_pools;
+    }
+
+private:
+    template<typename U, std::size_t N>
+    friend class PoolAllocator;
+
+    //! The pool of T is found or created on first use, so rebinding never allocates.
+    [[nodiscard]]
+    auto pool() -> detail::NodePool& {
+        if(m_pool == nullptr) [[unlikely]]
+            m_pool = &m_pools->get(sizeof(T), alignof(T), NodesPerBlock);
+        return *m_pool;
+    }
+
+    std::shared_ptr<detail::NodePoolSet> m_pools;
+    detail::NodePool* m_pool = nullptr;
+};
+}  // namespace xme
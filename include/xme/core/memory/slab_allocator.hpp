@@ -0,0 +1,90 @@
+#pragma once
+#include "../../../../private/core/slab_heap.hpp"
+#include <cstddef>
+#include <limits>
+#include <new>
+#include <type_traits>
+#include <xme/core/memory/allocate_at_least.hpp>
+
+namespace xme {
+//! SlabAllocator allocates from a process wide heap of size classes, with a cache of free
+//! objects per thread, so the many equal sized allocations of node based containers take a
+//! few instructions and no lock.
+//! It is thread safe and memory may be deallocated by another thread than the one that
+//! allocated it, like nodes sent from a producer to a consumer through an SPSCQueue,
+//! which costs one compare exchange per batch of up to 64 objects.
+//! Allocations larger than 4 KiB or aligned to more than alignof(std::max_align_t) go to
+//! the global allocator.
+//! Memory is kept for reuse by the heap and not returned to the system.
+//! @param T the type of the allocated object
+template<typename T>
+class SlabAllocator {
+public:
+    using value_type      = T;
+    using size_type       = std::size_t;
+    using difference_type = std::ptrdiff_t;
+
+    using propagate_on_container_copy_assignment = std::true_type;
+    using propagate_on_container_move_assignment = std::true_type;
+    using propagate_on_container_swap            = std::true_type;
+    using is_always_equal                        = std::true_type;
+
+    constexpr SlabAllocator() noexcept = default;
+
+    template<typename U>
+    constexpr SlabAllocator(const SlabAllocator<U>&) noexcept {}
+
+    [[nodiscard]]
+    auto allocate(std::size_t n) -> T* {
+        return static_cast<T*>(allocate_bytes(bytes_of(n)));
+    }
+
+    //! Allocates n objects, rounded up to fill their size class.
+    [[nodiscard]]
+    auto allocate_at_least(std::size_t n) -> AllocationResult<T*> {
+        const std::size_t bytes = bytes_of(n);
+        if(!uses_slab(bytes))
+            return {static_cast<T*>(allocate_bytes(bytes)), n};
+        const std::size_t index = detail::slab_class(bytes);
+        return {static_cast<T*>(detail::SlabHeap::allocate(index)),
+                detail::slab_class_size(index) / sizeof(T)};
+    }
+
+    void deallocate(T* p, std::size_t n) noexcept {
+        const std::size_t bytes = n * sizeof(T);
+        if(uses_slab(bytes))
+            detail::SlabHeap::deallocate(p, detail::slab_class(bytes));
+        else if constexpr(alignof(T) > __STDCPP_DEFAULT_NEW_ALIGNMENT__)
+            ::operator delete(p, bytes, std::align_val_t(alignof(T)));
+        else
+            ::operator delete(p, bytes);
+    }
+
+    friend constexpr bool operator==(const SlabAllocator&, const SlabAllocator&) noexcept {
+        return true;
+    }
+
+private:
+    [[nodiscard]]
+    static constexpr auto uses_slab(std::size_t bytes) noexcept -> bool {
+        return alignof(T) <= alignof(std::max_align_t) && bytes <= detail::slab_max_size;
+    }
+
+    [[nodiscard]]
+    static constexpr auto bytes_of(std::size_t n) -> std::size_t {
+        if(n > std::numeric_limits<std::size_t>::max() / sizeof(T))
+            throw std::bad_array_new_length();
+        return n * sizeof(T);
+    }
+
+    [[nodiscard]]
+    static auto allocate_bytes(std::size_t bytes) -> void* {
+        if(uses_slab(bytes))
+            return detail::SlabHeap::allocate(detail::slab_class(bytes));
+        if constexpr(alignof(T) > __STDCPP_DEFAULT_NEW_ALIGNMENT__)
+            return ::operator new(bytes, std::align_val_t(alignof(T)));
+        else
+            return ::operator new(bytes);
+    }
+};
+}  // namespace xme
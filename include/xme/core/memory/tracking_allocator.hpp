@@ -0,0 +1,92 @@
+#pragma once
+#include "../../../../private/core/tracking_domain.hpp"
+#include <cstddef>
+#include <memory>
+#include <type_traits>
+#include <xme/container/concepts.hpp>
+#include <xme/core/memory/allocate_at_least.hpp>
+
+namespace xme {
+//! TrackingAllocator forwards to Alloc and counts the allocations, bytes, live and peak
+//! bytes and sizes of every TrackingAllocator with the same Tag, so the memory use of a
+//! subsystem can be attributed to it, like TrackingAllocator<std::allocator<T>, struct Net>.
+//! Counters are per thread and only written by their thread, so tracking costs a few
+//! instructions per call and no locked instruction. allocation_stats<Tag> sums them.
+//! @param Alloc the allocator that allocates the memory
+//! @param Tag a type naming the subsystem, usually an empty struct
+template<CAllocator Alloc, typename Tag = void>
+class TrackingAllocator {
+private:
+    using alloc_traits = std::allocator_traits<Alloc>;
+    using domain       = detail::TrackingDomain<Tag>;
+
+public:
+    using value_type      = typename Alloc::value_type;
+    using size_type       = typename Alloc::size_type;
+    using difference_type = typename Alloc::difference_type;
+
+    using propagate_on_container_copy_assignment =
+      typename alloc_traits::propagate_on_container_copy_assignment;
+    using propagate_on_container_move_assignment =
+      typename alloc_traits::propagate_on_container_move_assignment;
+    using propagate_on_container_swap = typename alloc_traits::propagate_on_container_swap;
+    using is_always_equal             = typename alloc_traits::is_always_equal;
+
+    template<typename U>
+    struct rebind {
+        using other = TrackingAllocator<typename alloc_traits::template rebind_alloc<U>, Tag>;
+    };
+
+    constexpr TrackingAllocator() noexcept(noexcept(Alloc()))
+        requires std::is_default_constructible_v<Alloc>
+    = default;
+
+    constexpr explicit TrackingAllocator(const Alloc& alloc) noexcept : m_alloc(alloc) {}
+
+    template<typename Other>
+    constexpr TrackingAllocator(const TrackingAllocator<Other, Tag>& other) noexcept :
+      m_alloc(other.inner()) {}
+
+    [[nodiscard]]
+    auto allocate(std::size_t n) -> value_type* {
+        value_type* p = m_alloc.allocate(n);
+        domain::on_allocate(n * sizeof(value_type));
+        return p;
+    }
+
+    //! Forwards to Alloc::allocate_at_least when Alloc has it, and counts the real size.
+    [[nodiscard]]
+    auto allocate_at_least(std::size_t n) -> AllocationResult<value_type*> {
+        auto [p, count] = xme::allocate_at_least(m_alloc, n);
+        domain::on_allocate(count * sizeof(value_type));
+        return {p, count};
+    }
+
+    void deallocate(value_type* p, std::size_t n) noexcept {
+        domain::on_deallocate(n * sizeof(value_type));
+        m_alloc.deallocate(p, n);
+    }
+
+    [[nodiscard]]
+    constexpr auto inner() const noexcept -> const Alloc& {
+        return m_alloc;
+    }
+
+    friend constexpr bool operator==(const TrackingAllocator& lhs,
+                                     const TrackingAllocator& rhs) noexcept {
+        return lhs.m_alloc == rhs.m_alloc;
+    }
+
+private:
+    [[no_unique_address]]
+    Alloc m_alloc;
+};
+
+//! @returns the allocations of every TrackingAllocator with Tag, summed over every thread.
+//! Counters of other threads are read while they change, so the sums are not a snapshot.
+template<typename Tag = void>
+[[nodiscard]]
+auto allocation_stats() -> AllocationStats {
+    return detail::TrackingDomain<Tag>::instance().stats();
+}
+}  // namespace xme
@@ -0,0 +1,259 @@
+#pragma once
+#include <algorithm>
+#include <bit>
+#include <cstddef>
+#include <cstdint>
+#include <cstring>
+#include <iterator>
+#include <ranges>
+#include <type_traits>
+#include <xme/container/pair.hpp>
+#include <xme/hal/simd_detection.hpp>
+
+#if XME_USE_SIMD_AVX2
+#    include <immintrin.h>
+#elif XME_USE_SIMD_SSE2
+#    include <emmintrin.h>
+#endif
+
+namespace xme::ranges::detail {
+template<typename T>
+constexpr bool is_byte_like =
+  std::is_same_v<T, std::byte> || std::is_same_v<T, char> || std::is_same_v<T, signed char>
+  || std::is_same_v<T, unsigned char> || std::is_same_v<T, char8_t>;
+
+//! A contiguous and sized range of bytes, which the byte kernels can search.
+template<typename R>
+concept byte_range = std::ranges::contiguous_range<R> && std::ranges::sized_range<R>
+                  && is_byte_like<std::ranges::range_value_t<R>>;
+
+using byte_t = unsigned char;
+
+[[nodiscard]]
+inline auto load_word(const byte_t* p) noexcept -> std::uint64_t {
+    std::uint64_t word;
+    std::memcpy(&word, p, sizeof(word));
+    return word;
+}
+
+//! Index in memory order of the first byte of word that has a set bit.
+[[nodiscard]]
+inline auto first_set_byte(std::uint64_t word) noexcept -> std::size_t {
+    if constexpr(std::endian::native == std::endian::little)
+        return static_cast<std::size_t>(std::countr_zero(word)) / 8;
+    else
+        return static_cast<std::size_t>(std::countl_zero(word)) / 8;
+}
+
+//! Sets the high bit of every byte of word that is zero, and only of those,
+//! unlike the (x - lsbs) & ~x test whose borrow may mark the byte after a zero one.
+[[nodiscard]]
+inline auto mark_zero_bytes(std::uint64_t word) noexcept -> std::uint64_t {
+    constexpr std::uint64_t lows = 0x7f7f7f7f7f7f7f7full;
+    return ~(((word & lows) + lows) | word | lows);
+}
+
+//! Searches up to 16 needles with one comparison per needle and block,
+//! or up to 4 needles 8 bytes at a time without SIMD, larger sets use a lookup table.
+//! The kernels run a vector loop, then a word or byte loop for the tail, so no load
+//! reads past the end of the inputs, and return the index of the first match or n.
+[[nodiscard]]
+inline auto find_any_of_kernel(const byte_t* first, std::size_t n, const byte_t* set,
+                               std::size_t set_size) noexcept -> std::size_t {
+    if(set_size == 1 && n > 0) {
+        const void* found = std::memchr(first, set[0], n);
+        return found ? static_cast<std::size_t>(static_cast<const byte_t*>(found) - first) : n;
+    }
+    std::size_t i = 0;
+#if XME_USE_SIMD_AVX2 || XME_USE_SIMD_SSE2
+    if(set_size <= 16) {
+#    if XME_USE_SIMD_AVX2
+        __m256i needles[16];
+        for(std::size_t s = 0; s < set_size; ++s)
+            needles[s] = _mm256_set1_epi8(static_cast<char>(set[s]));
+        for(; i + 32 <= n; i += 32) {
+            const __m256i block = _mm256_loadu_si256(reinterpret_cast<const __m256i*>(first + i));
+            __m256i found       = _mm256_setzero_si256();
+            for(std::size_t s = 0; s < set_size; ++s)
+                found = _mm256_or_si256(found, _mm256_cmpeq_epi8(block, needles[s]));
+            const auto mask = static_cast<std::uint32_t>(_mm256_movemask_epi8(found));
+            if(mask != 0)
+                return i + static_cast<std::size_t>(std::countr_zero(mask));
+        }
+#    else
+        __m128i needles[16];
+        for(std::size_t s = 0; s < set_size; ++s)
+            needles[s] = _mm_set1_epi8(static_cast<char>(set[s]));
+        for(; i + 16 <= n; i += 16) {
+            const __m128i block = _mm_loadu_si128(reinterpret_cast<const __m128i*>(first + i));
+            __m128i found       = _mm_setzero_si128();
+            for(std::size_t s = 0; s < set_size; ++s)
+                found = _mm_or_si128(found, _mm_cmpeq_epi8(block, needles[s]));
+            const auto mask = static_cast<std::uint32_t>(_mm_movemask_epi8(found));
+            if(mask != 0)
+                return i + static_cast<std::size_t>(std::countr_zero(mask));
+        }
+#    endif
+    }
+#else
+    if(set_size <= 4) {
+        for(; i + 8 <= n; i += 8) {
+            const std::uint64_t word = load_word(first + i);
+            std::uint64_t found      = 0;
+            for(std::size_t s = 0; s < set_size; ++s)
+                found |= mark_zero_bytes(word ^ (0x0101010101010101ull * set[s]));
+            if(found != 0)
+                return i + first_set_byte(found);
+        }
+    }
+#endif
+    bool table[256]{};
+    for(std::size_t s = 0; s < set_size; ++s)
+        table[set[s]] = true;
+    for(; i < n; ++i) {
+        if(table[first[i]])
+            return i;
+    }
+    return n;
+}
+
+[[nodiscard]]
+inline auto mismatch_kernel(const byte_t* lhs, const byte_t* rhs, std::size_t n) noexcept
+  -> std::size_t {
+    std::size_t i = 0;
+#if XME_USE_SIMD_AVX2
+    const auto equal_mask = [](const byte_t* a, const byte_t* b) noexcept {
+        const __m256i va = _mm256_loadu_si256(reinterpret_cast<const __m256i*>(a));
+        const __m256i vb = _mm256_loadu_si256(reinterpret_cast<const __m256i*>(b));
+        return static_cast<std::uint32_t>(_mm256_movemask_epi8(_mm256_cmpeq_epi8(va, vb)));
+    };
+    for(; i + 64 <= n; i += 64) {
+        const std::uint64_t low   = equal_mask(lhs + i, rhs + i);
+        const std::uint64_t high  = equal_mask(lhs + i + 32, rhs + i + 32);
+        const std::uint64_t equal = low | (high << 32);
+        if(equal != ~std::uint64_t(0))
+            return i + static_cast<std::size_t>(std::countr_one(equal));
+    }
+    for(; i + 32 <= n; i += 32) {
+        const std::uint32_t equal = equal_mask(lhs + i, rhs + i);
+        if(equal != 0xffff'ffffu)
+            return i + static_cast<std::size_t>(std::countr_one(equal));
+    }
+#elif XME_USE_SIMD_SSE2
+    for(; i + 16 <= n; i += 16) {
+        const __m128i a  = _mm_loadu_si128(reinterpret_cast<const __m128i*>(lhs + i));
+        const __m128i b  = _mm_loadu_si128(reinterpret_cast<const __m128i*>(rhs + i));
+        const auto equal = static_cast<std::uint32_t>(_mm_movemask_epi8(_mm_cmpeq_epi8(a, b)));
+        if(equal != 0xffffu)
+            return i + static_cast<std::size_t>(std::countr_one(equal));
+    }
+#endif
+    for(; i + 8 <= n; i += 8) {
+        const std::uint64_t diff = load_word(lhs + i) ^ load_word(rhs + i);
+        if(diff != 0)
+            return i + first_set_byte(diff);
+    }
+    for(; i < n; ++i) {
+        if(lhs[i] != rhs[i])
+            return i;
+    }
+    return n;
+}
+
+template<typename R>
+[[nodiscard]]
+auto bytes_of(R& range) noexcept -> const byte_t* {
+    return reinterpret_cast<const byte_t*>(std::ranges::data(range));
+}
+
+template<typename T>
+[[nodiscard]]
+constexpr auto to_byte(T value) noexcept -> byte_t {
+    return static_cast<byte_t>(value);
+}
+}  // namespace xme::ranges::detail
+
+namespace xme::ranges {
+namespace detail {
+struct FindByte {
+    //! Finds the first element equal to value in a contiguous range of bytes,
+    //! like ArrayView<const std::byte>, a string or an Array<char>.
+    //! Uses memchr, which the C library already vectorizes for the running cpu.
+    //! @returns an iterator to it, or the end of range
+    template<byte_range R>
+    constexpr auto operator()(R&& range, std::ranges::range_value_t<R> value) const noexcept
+      -> std::ranges::borrowed_iterator_t<R> {
+        if(std::is_constant_evaluated())
+            return std::ranges::find(range, value);
+        const std::size_t n = std::ranges::size(range);
+        const byte_t* first = bytes_of(range);
+        const void* found   = n == 0 ? nullptr : std::memchr(first, to_byte(value), n);
+        const std::size_t index =
+          found ? static_cast<std::size_t>(static_cast<const byte_t*>(found) - first) : n;
+        return std::ranges::begin(range) + index;
+    }
+};
+
+struct FindAnyOf {
+    //! Finds the first element of range equal to any element of set, like a delimiter.
+    //! Ranges that are not of bytes fall back to std::ranges::find_first_of.
+    //! @returns an iterator to it, or the end of range
+    template<std::ranges::input_range R, std::ranges::forward_range Set>
+    constexpr auto operator()(R&& range, Set&& set) const -> std::ranges::borrowed_iterator_t<R> {
+        if constexpr(byte_range<R> && byte_range<Set>) {
+            if(!std::is_constant_evaluated()) {
+                const std::size_t n     = std::ranges::size(range);
+                const std::size_t index = find_any_of_kernel(bytes_of(range), n, bytes_of(set),
+                                                             std::ranges::size(set));
+                return std::ranges::begin(range) + index;
+            }
+        }
+        return std::ranges::find_first_of(range, set);
+    }
+};
+
+struct Mismatch {
+    //! Finds the first position where lhs and rhs differ.
+    //! Ranges that are not of bytes fall back to std::ranges::mismatch.
+    //! @returns the iterators to the differing elements, or to the end of the shorter range
+    template<std::ranges::input_range R1, std::ranges::input_range R2>
+    constexpr auto operator()(R1&& lhs, R2&& rhs) const
+      -> xme::Pair<std::ranges::borrowed_iterator_t<R1>, std::ranges::borrowed_iterator_t<R2>> {
+        if constexpr(byte_range<R1> && byte_range<R2>) {
+            if(!std::is_constant_evaluated()) {
+                const std::size_t n =
+                  std::min<std::size_t>(std::ranges::size(lhs), std::ranges::size(rhs));
+                const std::size_t index = mismatch_kernel(bytes_of(lhs), bytes_of(rhs), n);
+                return {std::ranges::begin(lhs) + index, std::ranges::begin(rhs) + index};
+            }
+        }
+        auto [in1, in2] = std::ranges::mismatch(lhs, rhs);
+        return {in1, in2};
+    }
+};
+
+struct Equal {
+    //! Returns true if lhs and rhs have the same size and elements.
+    //! Byte ranges are compared with memcmp, others fall back to std::ranges::equal.
+    template<std::ranges::input_range R1, std::ranges::input_range R2>
+    constexpr bool operator()(R1&& lhs, R2&& rhs) const {
+        if constexpr(byte_range<R1> && byte_range<R2>) {
+            if(!std::is_constant_evaluated()) {
+                const std::size_t n = std::ranges::size(lhs);
+                return n == std::ranges::size(rhs)
+                    && (n == 0 || std::memcmp(bytes_of(lhs), bytes_of(rhs), n) == 0);
+            }
+        }
+        return std::ranges::equal(lhs, rhs);
+    }
+};
+}  // namespace detail
+
+//! Algorithms specialized for contiguous ranges of bytes, like the delimiter scan of a
+//! message framing. find_any_of and mismatch are vectorized with AVX2 or SSE2 when
+//! enabled through xme::hal::enabled_simd, with 64 bit arithmetic otherwise.
+inline constexpr detail::FindByte find_byte;
+inline constexpr detail::FindAnyOf find_any_of;
+inline constexpr detail::Mismatch mismatch;
+inline constexpr detail::Equal equal;
+}  // namespace xme::ranges
@@ -10,12 +10,69 @@ using xme::CPairLike;
 using xme::AlignedData;
 
 using xme::Array;
+using xme::CGrowthPolicy;
+using xme::GeometricGrowth;
+using xme::DoublingGrowth;
+using xme::HalfGrowth;
+using xme::FixedStepGrowth;
+using xme::PageRoundedGrowth;
 
 using xme::ArrayView;
 using xme::as_bytes;
 using xme::as_writable_bytes;
 
+using xme::ArrayView2D;
+using xme::ArrayViewND;
+using xme::DynamicExtents;
+using xme::Extents;
+using xme::LayoutColumnMajor;
+using xme::LayoutRowMajor;
+using xme::LayoutStrided;
+using xme::StridedView;
+using xme::dynamic_extent;
+
+using xme::BitArray;
+
+using xme::ConcurrentArray;
+using xme::ConcurrentSkipListMap;
+
+using xme::DoublyLinkedList;
+
+using xme::FlatMap;
+using xme::FlatSet;
+
+using xme::HashMap;
+using xme::HashSet;
+
+using xme::BaseHook;
+using xme::IntrusiveList;
+using xme::IntrusiveListHook;
+using xme::IntrusiveSList;
+using xme::IntrusiveSListHook;
+using xme::MemberHook;
+
 using xme::LinkedList;
+using xme::LinkedListHook;
+using xme::LockFreeStack;
+using xme::LRUCache;
+using xme::UnitWeigher;
+using xme::MPSCQueue;
+
+using xme::DeltaEncoding;
+using xme::FrameOfReference;
+using xme::PackedIntArray;
+
+#if XME_PLATFORM_LINUX || XME_PLATFORM_APPLE
+using xme::MapAdvice;
+using xme::MapMode;
+using xme::MappedArray;
+#endif
+
+using xme::SegmentedArray;
+
+using xme::SoAArray;
+
+using xme::UnrolledList;
 
 using xme::Pair;
 using xme::make_pair;
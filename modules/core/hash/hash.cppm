@@ -0,0 +1,11 @@
+module;
+#include <xme/core/hash/crc32c.hpp>
+#include <xme/core/hash/hash.hpp>
+export module xme.hash;
+
+export namespace xme {
+using xme::CHashable;
+using xme::crc32c;
+using xme::Hash;
+using xme::hash_bytes;
+}
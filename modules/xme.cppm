@@ -1,6 +1,7 @@
 export module xme;
 export import xme.container;
 export import xme.functional;
+export import xme.hash;
 export import xme.iterators;
 export import xme.math;
 export import xme.utility;
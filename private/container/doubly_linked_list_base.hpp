@@ -0,0 +1,14 @@
+#pragma once
+#include <xme/container/aligned_data.hpp>
+
+namespace xme::detail {
+struct DoublyLinkedListNodeBase {
+    DoublyLinkedListNodeBase* next = nullptr;
+    DoublyLinkedListNodeBase* prev = nullptr;
+};
+
+template<typename T>
+struct DoublyLinkedListNode : DoublyLinkedListNodeBase {
+    xme::AlignedData<T> storage;
+};
+}  // namespace xme::detail
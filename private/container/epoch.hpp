@@ -0,0 +1,170 @@
+#pragma once
+#include <xme/container/array.hpp>
+#include <atomic>
+#include <cstdint>
+#include <utility>
+
+namespace xme::detail {
+//! State of one thread in the EpochDomain, reused by another thread after it exits.
+struct EpochRecord {
+    struct Retired {
+        void* object;
+        void (*deleter)(void*);
+    };
+
+    //! The global epoch seen when the thread entered its critical section, or 0 outside of it.
+    std::atomic<std::uint64_t> epoch = 0;
+    std::atomic<bool> in_use         = false;
+    EpochRecord* next                = nullptr;
+    unsigned nesting                 = 0;
+    unsigned retired_since_scan      = 0;
+    //! Objects retired in each of the last 3 epochs.
+    Array<Retired> bags[3];
+    std::uint64_t bag_epochs[3]{};
+};
+
+//! Epoch based reclamation shared by the lock free containers.
+//! A thread enters a critical section before reading shared nodes, and an unlinked node
+//! is retired instead of freed. The global epoch only advances when every thread in a
+//! critical section has seen the current one, so a node retired in epoch e is freed once
+//! the global epoch reaches e + 2, when no thread can still be reading it.
+//! The domain is never destroyed, so containers stay usable during static destruction and
+//! objects still retired at exit are leaked.
+class EpochDomain {
+private:
+    static constexpr unsigned scan_interval = 64;
+
+public:
+    [[nodiscard]]
+    static auto instance() noexcept -> EpochDomain& {
+        // Constant initialized and trivially destructible, so it needs no guard and is never
+        // destroyed
+        static constinit EpochDomain domain;
+        return domain;
+    }
+
+    EpochDomain(const EpochDomain&) = delete;
+
+    auto operator=(const EpochDomain&) -> EpochDomain& = delete;
+
+    //! The first call of a thread publishes its record, which may throw.
+    void enter() {
+        EpochRecord& record = local_record();
+        if(record.nesting++ == 0) {
+            record.epoch.store(m_epoch.load(std::memory_order_relaxed), std::memory_order_relaxed);
+            std::atomic_thread_fence(std::memory_order_seq_cst);
+        }
+    }
+
+    //! Must follow a call to enter on the same thread.
+    void exit() noexcept {
+        EpochRecord& record = *current();
+        if(--record.nesting == 0)
+            record.epoch.store(0, std::memory_order_release);
+    }
+
+    //! Frees object with deleter once no thread can be reading it.
+    void retire(void* object, void (*deleter)(void*)) {
+        EpochRecord& record       = local_record();
+        const std::uint64_t epoch = m_epoch.load(std::memory_order_acquire);
+        const std::size_t index   = epoch % 3;
+        if(record.bag_epochs[index] != epoch) {
+            // The bag holds objects retired 3 or more epochs ago.
+            free_bag(record.bags[index]);
+            record.bag_epochs[index] = epoch;
+        }
+        record.bags[index].push_back(EpochRecord::Retired{object, deleter});
+
+        if(++record.retired_since_scan >= scan_interval) {
+            record.retired_since_scan = 0;
+            try_advance();
+            const std::uint64_t current = m_epoch.load(std::memory_order_acquire);
+            for(std::size_t i = 0; i < 3; ++i) {
+                if(record.bag_epochs[i] + 2 <= current)
+                    free_bag(record.bags[i]);
+            }
+        }
+    }
+
+private:
+    constexpr EpochDomain() noexcept = default;
+
+    //! Releases the record of a thread when it exits.
+    struct LocalRecord {
+        ~LocalRecord() {
+            if(EpochRecord* record = std::exchange(current(), nullptr))
+                record->in_use.store(false, std::memory_order_release);
+        }
+    };
+
+    [[nodiscard]]
+    static auto current() noexcept -> EpochRecord*& {
+        // Constant initialized, so reading it needs no guard
+        static constinit thread_local EpochRecord* record = nullptr;
+        return record;
+    }
+
+    [[nodiscard]]
+    auto local_record() -> EpochRecord& {
+        EpochRecord*& record = current();
+        if(record == nullptr) [[unlikely]] {
+            static thread_local LocalRecord local;
+            record = acquire_record();
+        }
+        return *record;
+    }
+
+    //! Reuses the record of an exited thread, or publishes a new one.
+    [[nodiscard]]
+    auto acquire_record() -> EpochRecord* {
+        for(EpochRecord* record = m_records.load(std::memory_order_acquire); record;
+            record              = record->next) {
+            bool expected = false;
+            if(record->in_use.compare_exchange_strong(expected, true, std::memory_order_acquire))
+                return record;
+        }
+        auto* record   = new EpochRecord;
+        record->in_use = true;
+        record->next   = m_records.load(std::memory_order_relaxed);
+        while(!m_records.compare_exchange_weak(record->next, record, std::memory_order_release,
+                                               std::memory_order_relaxed)) {}
+        return record;
+    }
+
+    //! Advances the global epoch if every thread in a critical section has seen it.
+    void try_advance() noexcept {
+        std::uint64_t epoch = m_epoch.load(std::memory_order_seq_cst);
+        for(EpochRecord* record = m_records.load(std::memory_order_acquire); record;
+            record              = record->next) {
+            if(!record->in_use.load(std::memory_order_acquire))
+                continue;
+            const std::uint64_t seen = record->epoch.load(std::memory_order_seq_cst);
+            if(seen != 0 && seen != epoch)
+                return;
+        }
+        m_epoch.compare_exchange_strong(epoch, epoch + 1, std::memory_order_seq_cst);
+    }
+
+    static void free_bag(Array<EpochRecord::Retired>& bag) noexcept {
+        for(auto& retired : bag)
+            retired.deleter(retired.object);
+        bag.clear();
+    }
+
+    alignas(64) std::atomic<std::uint64_t> m_epoch = 1;
+    std::atomic<EpochRecord*> m_records            = nullptr;
+};
+
+//! Keeps the calling thread in a critical section of the EpochDomain while it lives.
+class EpochGuard {
+public:
+    //! Throws if the calling thread enters the domain for the first time and runs out of memory.
+    EpochGuard() { EpochDomain::instance().enter(); }
+
+    EpochGuard(const EpochGuard&) : EpochGuard() {}
+
+    auto operator=(const EpochGuard&) noexcept -> EpochGuard& { return *this; }
+
+    ~EpochGuard() { EpochDomain::instance().exit(); }
+};
+}  // namespace xme::detail
@@ -0,0 +1,22 @@
+#pragma once
+#include <cstddef>
+
+namespace xme::detail {
+//! Binary search without unpredictable branches, the comparison is turned into a
+//! conditional move, so the cost only depends on the size.
+//! @returns the index of the first element that is not less than key
+template<typename T, typename K, typename Compare>
+constexpr auto branchless_lower_bound(const T* first, std::size_t size, const K& key,
+                                      Compare& comp) -> std::size_t {
+    if(size == 0)
+        return 0;
+
+    const T* base = first;
+    while(size > 1) {
+        const std::size_t half = size / 2;
+        base                   = comp(base[half - 1], key) ? base + half : base;
+        size -= half;
+    }
+    return (base - first) + comp(*base, key);
+}
+}  // namespace xme::detail
@@ -0,0 +1,758 @@
+#pragma once
+#include <bit>
+#include <cassert>
+#include <cstdint>
+#include <cstring>
+#include <memory>
+#include <type_traits>
+#include <xme/hal/simd_detection.hpp>
+#include <xme/container/concepts.hpp>
+#include <xme/container/pair.hpp>
+
+#if XME_USE_SIMD_SSE2
+#    include <emmintrin.h>
+#endif
+
+namespace xme::detail {
+using ctrl_t = std::int8_t;
+
+//! Control byte of a slot, a full slot stores the 7 low bits of the hash (H2).
+inline constexpr ctrl_t ctrl_empty    = -128;  // 0b10000000
+inline constexpr ctrl_t ctrl_deleted  = -2;    // 0b11111110
+inline constexpr ctrl_t ctrl_sentinel = -1;    // 0b11111111
+
+//! Control bytes of a table without capacity, so lookups don't need to check for it.
+alignas(16) inline constexpr ctrl_t empty_group[16] = {
+  ctrl_sentinel, ctrl_empty, ctrl_empty, ctrl_empty, ctrl_empty, ctrl_empty, ctrl_empty,
+  ctrl_empty,    ctrl_empty, ctrl_empty, ctrl_empty, ctrl_empty, ctrl_empty, ctrl_empty,
+  ctrl_empty,    ctrl_empty};
+
+//! A mask with one bit, or one byte when Shift is 3, per slot of a group.
+template<typename U, int Shift>
+class HashBitMask {
+public:
+    constexpr explicit HashBitMask(U mask) noexcept : m_mask(mask) {}
+
+    constexpr explicit operator bool() const noexcept { return m_mask != 0; }
+
+    //! @returns the index of the first matching slot
+    [[nodiscard]]
+    constexpr auto lowest() const noexcept -> std::size_t {
+        return std::countr_zero(m_mask) >> Shift;
+    }
+
+    //! @returns the amount of non matching slots at the start of the group
+    [[nodiscard]]
+    constexpr auto trailing_zeros() const noexcept -> std::size_t {
+        return std::countr_zero(m_mask) >> Shift;
+    }
+
+    //! @returns the amount of non matching slots at the end of the group
+    [[nodiscard]]
+    constexpr auto leading_zeros() const noexcept -> std::size_t {
+        return std::countl_zero(m_mask) >> Shift;
+    }
+
+    constexpr void clear_lowest() noexcept { m_mask &= (m_mask - 1); }
+
+private:
+    U m_mask;
+};
+
+//! Matches 8 control bytes at once with 64 bit arithmetic.
+struct HashGroupPortable {
+    static constexpr std::size_t width = 8;
+
+    using mask = HashBitMask<std::uint64_t, 3>;
+
+    explicit HashGroupPortable(const ctrl_t* pos) noexcept {
+        for(std::size_t i = 0; i < width; ++i)
+            ctrl |= std::uint64_t(static_cast<std::uint8_t>(pos[i])) << (i * 8);
+    }
+
+    //! May have false positives, the key must always be compared.
+    [[nodiscard]]
+    auto match(ctrl_t h2) const noexcept -> mask {
+        const std::uint64_t x = ctrl ^ (lsbs * static_cast<std::uint8_t>(h2));
+        return mask((x - lsbs) & ~x & msbs);
+    }
+
+    [[nodiscard]]
+    auto match_empty() const noexcept -> mask {
+        return mask((ctrl & ~(ctrl << 6)) & msbs);
+    }
+
+    [[nodiscard]]
+    auto match_empty_or_deleted() const noexcept -> mask {
+        return mask((ctrl & ~(ctrl << 7)) & msbs);
+    }
+
+    static constexpr std::uint64_t msbs = 0x8080808080808080ull;
+    static constexpr std::uint64_t lsbs = 0x0101010101010101ull;
+
+    std::uint64_t ctrl = 0;
+};
+
+#if XME_USE_SIMD_SSE2
+//! Matches 16 control bytes at once with SSE2.
+struct HashGroupSse2 {
+    static constexpr std::size_t width = 16;
+
+    using mask = HashBitMask<std::uint16_t, 0>;
+
+    explicit HashGroupSse2(const ctrl_t* pos) noexcept :
+      ctrl(_mm_loadu_si128(reinterpret_cast<const __m128i*>(pos))) {}
+
+    [[nodiscard]]
+    auto match(ctrl_t h2) const noexcept -> mask {
+        return to_mask(_mm_cmpeq_epi8(_mm_set1_epi8(h2), ctrl));
+    }
+
+    [[nodiscard]]
+    auto match_empty() const noexcept -> mask {
+        return to_mask(_mm_cmpeq_epi8(_mm_set1_epi8(ctrl_empty), ctrl));
+    }
+
+    [[nodiscard]]
+    auto match_empty_or_deleted() const noexcept -> mask {
+        return to_mask(_mm_cmpgt_epi8(_mm_set1_epi8(ctrl_sentinel), ctrl));
+    }
+
+    static auto to_mask(__m128i v) noexcept -> mask {
+        return mask(static_cast<std::uint16_t>(_mm_movemask_epi8(v)));
+    }
+
+    __m128i ctrl;
+};
+#endif
+
+template<typename Default, typename Sse2>
+using select_hash_group =
+  std::conditional_t<(hal::enabled_simd & hal::ESimd::sse2) == hal::ESimd::sse2, Sse2, Default>;
+
+#if XME_USE_SIMD_SSE2
+using HashGroup = select_hash_group<HashGroupPortable, HashGroupSse2>;
+#else
+using HashGroup = HashGroupPortable;
+#endif
+
+//! Mixes the bits of a hash, so H2 and H1 are well distributed even for identity hashes.
+constexpr auto mix_hash(std::size_t hash) noexcept -> std::size_t {
+    std::uint64_t h = hash;
+    h ^= h >> 33;
+    h *= 0xff51afd7ed558ccdull;
+    h ^= h >> 33;
+    return static_cast<std::size_t>(h);
+}
+
+//! Converts to the result of make by calling it, so a member of a slot is constructed in
+//! place when the slot is, inside its exception guard.
+template<typename F>
+struct DeferredValue {
+    constexpr operator std::invoke_result_t<F&>() { return make(); }
+
+    F make;
+};
+
+template<typename F>
+DeferredValue(F) -> DeferredValue<F>;
+
+//! Stores elements of HashMap
+template<typename K, typename V>
+struct HashMapPolicy {
+    using key_type   = K;
+    using slot_type  = xme::Pair<K, V>;
+    using value_type = xme::Pair<const K, V>;
+    using reference  = value_type&;
+
+    template<CPairLike P>
+    static constexpr auto key(const P& value) noexcept -> const K& {
+        return get<0>(value);
+    }
+
+    //! Pair<K, V> and Pair<const K, V> have the same layout, the key is only exposed as const
+    static constexpr auto element(slot_type& slot) noexcept -> reference {
+        return reinterpret_cast<reference>(slot);
+    }
+};
+
+//! Stores elements of HashSet
+template<typename K>
+struct HashSetPolicy {
+    using key_type   = K;
+    using slot_type  = K;
+    using value_type = K;
+    using reference  = const K&;
+
+    static constexpr auto key(const slot_type& slot) noexcept -> const K& { return slot; }
+
+    static constexpr auto element(slot_type& slot) noexcept -> reference { return slot; }
+};
+
+//! Lets lookups deduce the key type only when the hasher and comparator are transparent.
+template<bool Transparent>
+struct HashKeyArg {
+    template<typename K, typename Key>
+    using type = Key;
+};
+
+template<>
+struct HashKeyArg<true> {
+    template<typename K, typename Key>
+    using type = K;
+};
+
+template<typename Policy, bool Const>
+class HashTableIterator {
+private:
+    using slot_type = typename Policy::slot_type;
+
+    template<typename, typename, typename, typename>
+    friend class HashTable;
+
+    template<typename, bool>
+    friend class HashTableIterator;
+
+public:
+    using difference_type   = std::ptrdiff_t;
+    using value_type        = typename Policy::value_type;
+    using reference =
+      std::conditional_t<Const, const value_type&, typename Policy::reference>;
+    using pointer           = std::remove_reference_t<reference>*;
+    using iterator_category = std::forward_iterator_tag;
+
+    constexpr HashTableIterator() noexcept = default;
+
+    constexpr HashTableIterator(const HashTableIterator<Policy, !Const>& it) noexcept
+        requires(Const)
+      : m_ctrl(it.m_ctrl), m_slot(it.m_slot) {}
+
+    constexpr auto operator*() const noexcept -> reference { return Policy::element(*m_slot); }
+
+    constexpr auto operator->() const noexcept -> pointer { return std::addressof(**this); }
+
+    constexpr auto operator++() noexcept -> HashTableIterator& {
+        ++m_ctrl;
+        ++m_slot;
+        skip_empty_or_deleted();
+        return *this;
+    }
+
+    constexpr auto operator++(int) noexcept -> HashTableIterator {
+        HashTableIterator tmp{*this};
+        ++(*this);
+        return tmp;
+    }
+
+    constexpr bool operator==(const HashTableIterator& rhs) const noexcept {
+        return m_ctrl == rhs.m_ctrl;
+    }
+
+private:
+    constexpr HashTableIterator(const ctrl_t* ctrl, slot_type* slot) noexcept :
+      m_ctrl(ctrl), m_slot(slot) {}
+
+    //! The sentinel is greater than empty and deleted, so the loop stops at the end.
+    constexpr void skip_empty_or_deleted() noexcept {
+        while(*m_ctrl < ctrl_sentinel) {
+            ++m_ctrl;
+            ++m_slot;
+        }
+    }
+
+    const ctrl_t* m_ctrl = nullptr;
+    slot_type* m_slot    = nullptr;
+};
+
+//! Open addressing hash table, with 1 byte of metadata per slot.
+//! Groups of control bytes are probed in parallel with SIMD when enabled.
+template<typename Policy, typename Hash, typename KeyEqual, typename Alloc>
+class HashTable {
+private:
+    using slot_type    = typename Policy::slot_type;
+    using slot_alloc   = typename std::allocator_traits<Alloc>::template rebind_alloc<slot_type>;
+    using ctrl_alloc   = typename std::allocator_traits<Alloc>::template rebind_alloc<ctrl_t>;
+    using slot_traits  = std::allocator_traits<slot_alloc>;
+    using ctrl_traits  = std::allocator_traits<ctrl_alloc>;
+    using group        = HashGroup;
+
+    static constexpr std::size_t cloned_bytes = group::width - 1;
+
+    static constexpr bool is_transparent = requires {
+        typename Hash::is_transparent;
+        typename KeyEqual::is_transparent;
+    };
+
+    template<typename K>
+    using key_arg =
+      typename HashKeyArg<is_transparent>::template type<K, typename Policy::key_type>;
+
+public:
+    using key_type        = typename Policy::key_type;
+    using value_type      = typename Policy::value_type;
+    using size_type       = std::size_t;
+    using difference_type = std::ptrdiff_t;
+    using hasher          = Hash;
+    using key_equal       = KeyEqual;
+    using allocator_type  = Alloc;
+    using reference       = typename Policy::reference;
+    using const_reference = const value_type&;
+    using iterator        = HashTableIterator<Policy, false>;
+    using const_iterator  = HashTableIterator<Policy, true>;
+
+    constexpr HashTable() noexcept(std::is_nothrow_default_constructible_v<Hash>
+                                   && std::is_nothrow_default_constructible_v<KeyEqual>
+                                   && std::is_nothrow_default_constructible_v<Alloc>) = default;
+
+    //! Creates an empty table with at least bucket_count slots.
+    explicit HashTable(size_type bucket_count, const Hash& hash = Hash(),
+                       const KeyEqual& equal = KeyEqual(), const Alloc& alloc = Alloc()) :
+      m_hash(hash), m_equal(equal), m_allocator(alloc) {
+        if(bucket_count != 0)
+            rehash(normalize_capacity(bucket_count));
+    }
+
+    HashTable(size_type bucket_count, const Alloc& alloc) :
+      HashTable(bucket_count, Hash(), KeyEqual(), alloc) {}
+
+    HashTable(size_type bucket_count, const Hash& hash, const Alloc& alloc) :
+      HashTable(bucket_count, hash, KeyEqual(), alloc) {}
+
+    explicit HashTable(const Alloc& alloc) : HashTable(0, Hash(), KeyEqual(), alloc) {}
+
+    template<std::input_iterator Iter, std::sentinel_for<Iter> Sent>
+    HashTable(Iter first, Sent last, size_type bucket_count = 0, const Hash& hash = Hash(),
+              const KeyEqual& equal = KeyEqual(), const Alloc& alloc = Alloc()) :
+      HashTable(bucket_count, hash, equal, alloc) {
+        if constexpr(std::forward_iterator<Iter>)
+            reserve(std::ranges::distance(first, last));
+        for(; first != last; ++first)
+            emplace_slot(*first);
+    }
+
+    template<std::input_iterator Iter, std::sentinel_for<Iter> Sent>
+    HashTable(Iter first, Sent last, size_type bucket_count, const Alloc& alloc) :
+      HashTable(first, last, bucket_count, Hash(), KeyEqual(), alloc) {}
+
+    template<std::input_iterator Iter, std::sentinel_for<Iter> Sent>
+    HashTable(Iter first, Sent last, size_type bucket_count, const Hash& hash,
+              const Alloc& alloc) :
+      HashTable(first, last, bucket_count, hash, KeyEqual(), alloc) {}
+
+    HashTable(std::initializer_list<value_type> list, size_type bucket_count = 0,
+              const Hash& hash = Hash(), const KeyEqual& equal = KeyEqual(),
+              const Alloc& alloc = Alloc()) :
+      HashTable(list.begin(), list.end(), bucket_count, hash, equal, alloc) {}
+
+    HashTable(std::initializer_list<value_type> list, size_type bucket_count,
+              const Alloc& alloc) :
+      HashTable(list.begin(), list.end(), bucket_count, Hash(), KeyEqual(), alloc) {}
+
+    HashTable(std::initializer_list<value_type> list, size_type bucket_count, const Hash& hash,
+              const Alloc& alloc) :
+      HashTable(list.begin(), list.end(), bucket_count, hash, KeyEqual(), alloc) {}
+
+    HashTable(const HashTable& other) :
+      m_hash(other.m_hash), m_equal(other.m_equal), m_allocator(other.m_allocator) {
+        reserve(other.size());
+        for(auto&& value : other)
+            emplace_slot(value);
+    }
+
+    HashTable(HashTable&& other) noexcept :
+      m_ctrl(std::exchange(other.m_ctrl, const_cast<ctrl_t*>(empty_group))),
+      m_slots(std::exchange(other.m_slots, nullptr)),
+      m_capacity(std::exchange(other.m_capacity, 0)),
+      m_size(std::exchange(other.m_size, 0)),
+      m_growth_left(std::exchange(other.m_growth_left, 0)),
+      m_hash(std::move(other.m_hash)),
+      m_equal(std::move(other.m_equal)),
+      m_allocator(std::move(other.m_allocator)) {}
+
+    ~HashTable() noexcept {
+        destroy_slots();
+        deallocate(m_ctrl, m_slots, m_capacity);
+    }
+
+    auto operator=(const HashTable& other) -> HashTable& {
+        HashTable(other).swap(*this);
+        return *this;
+    }
+
+    auto operator=(HashTable&& other) noexcept -> HashTable& {
+        HashTable(std::move(other)).swap(*this);
+        return *this;
+    }
+
+    [[nodiscard]]
+    auto hash_function() const -> hasher {
+        return m_hash;
+    }
+
+    [[nodiscard]]
+    auto key_eq() const -> key_equal {
+        return m_equal;
+    }
+
+    [[nodiscard]]
+    auto get_allocator() const noexcept -> allocator_type {
+        return m_allocator;
+    }
+
+    [[nodiscard]]
+    auto begin() noexcept -> iterator {
+        iterator it{m_ctrl, m_slots};
+        it.skip_empty_or_deleted();
+        return it;
+    }
+
+    [[nodiscard]]
+    auto end() noexcept -> iterator {
+        return {m_ctrl + m_capacity, nullptr};
+    }
+
+    [[nodiscard]]
+    auto begin() const noexcept -> const_iterator {
+        return const_cast<HashTable*>(this)->begin();
+    }
+
+    [[nodiscard]]
+    auto end() const noexcept -> const_iterator {
+        return const_cast<HashTable*>(this)->end();
+    }
+
+    [[nodiscard]]
+    auto cbegin() const noexcept -> const_iterator {
+        return begin();
+    }
+
+    [[nodiscard]]
+    auto cend() const noexcept -> const_iterator {
+        return end();
+    }
+
+    [[nodiscard]]
+    constexpr auto size() const noexcept -> size_type {
+        return m_size;
+    }
+
+    //! @returns the amount of slots, including empty and deleted.
+    [[nodiscard]]
+    constexpr auto capacity() const noexcept -> size_type {
+        return m_capacity;
+    }
+
+    [[nodiscard]]
+    constexpr bool empty() const noexcept {
+        return m_size == 0;
+    }
+
+    void swap(HashTable& other) noexcept {
+        std::ranges::swap(m_ctrl, other.m_ctrl);
+        std::ranges::swap(m_slots, other.m_slots);
+        std::ranges::swap(m_capacity, other.m_capacity);
+        std::ranges::swap(m_size, other.m_size);
+        std::ranges::swap(m_growth_left, other.m_growth_left);
+        std::ranges::swap(m_hash, other.m_hash);
+        std::ranges::swap(m_equal, other.m_equal);
+        std::ranges::swap(m_allocator, other.m_allocator);
+    }
+
+    //! Erases every element, keeping the capacity.
+    void clear() noexcept {
+        if(m_capacity == 0)
+            return;
+        destroy_slots();
+        reset_ctrl();
+        m_size = 0;
+    }
+
+    //! Makes room for at least n elements without rehashing.
+    void reserve(size_type n) {
+        if(n > m_size + m_growth_left)
+            rehash(normalize_capacity(growth_to_capacity(n)));
+    }
+
+    template<typename K = key_type>
+    [[nodiscard]]
+    auto find(const key_arg<K>& key) noexcept -> iterator {
+        const size_type index = find_index(key, hash_of(key));
+        return index == npos ? end() : iterator{m_ctrl + index, m_slots + index};
+    }
+
+    template<typename K = key_type>
+    [[nodiscard]]
+    auto find(const key_arg<K>& key) const noexcept -> const_iterator {
+        return const_cast<HashTable*>(this)->find(key);
+    }
+
+    template<typename K = key_type>
+    [[nodiscard]]
+    bool contains(const key_arg<K>& key) const noexcept {
+        return find_index(key, hash_of(key)) != npos;
+    }
+
+    template<typename K = key_type>
+    [[nodiscard]]
+    auto count(const key_arg<K>& key) const noexcept -> size_type {
+        return contains(key) ? 1 : 0;
+    }
+
+    //! Inserts value if its key is not in the table.
+    //! @returns an iterator to the element with the key and true if it was inserted
+    auto insert(const value_type& value) -> xme::Pair<iterator, bool> {
+        return emplace_slot(value);
+    }
+
+    //! Inserts value if its key is not in the table.
+    //! @returns an iterator to the element with the key and true if it was inserted
+    auto insert(value_type&& value) -> xme::Pair<iterator, bool> {
+        return emplace_slot(std::move(value));
+    }
+
+    //! Inserts [first, last) elements whose keys are not in the table.
+    template<std::input_iterator Iter, std::sentinel_for<Iter> Sent>
+    void insert(Iter first, Sent last) {
+        for(; first != last; ++first)
+            emplace_slot(*first);
+    }
+
+    //! Constructs an element from args, it is destroyed if the key already exists.
+    //! @returns an iterator to the element with the key and true if it was inserted
+    template<typename... Args>
+    auto emplace(Args&&... args) -> xme::Pair<iterator, bool> {
+        return emplace_slot(slot_type(std::forward<Args>(args)...));
+    }
+
+    //! Erases the element at pos.
+    void erase(const_iterator pos) noexcept {
+        erase_index(pos.m_ctrl - m_ctrl);
+    }
+
+    //! Erases the element with key.
+    //! @returns the amount of erased elements
+    template<typename K = key_type>
+    auto erase(const key_arg<K>& key) noexcept -> size_type {
+        const size_type index = find_index(key, hash_of(key));
+        if(index == npos)
+            return 0;
+        erase_index(index);
+        return 1;
+    }
+
+protected:
+    static constexpr size_type npos = static_cast<size_type>(-1);
+
+    template<typename K>
+    [[nodiscard]]
+    auto hash_of(const K& key) const noexcept -> size_type {
+        return mix_hash(m_hash(key));
+    }
+
+    template<typename K>
+    [[nodiscard]]
+    auto find_index(const K& key, size_type hash) const noexcept -> size_type {
+        const auto h2   = static_cast<ctrl_t>(hash & 0x7f);
+        size_type index = 0;
+        size_type pos   = (hash >> 7) & m_capacity;
+        while(true) {
+            group g(m_ctrl + pos);
+            for(auto match = g.match(h2); match; match.clear_lowest()) {
+                const size_type slot = (pos + match.lowest()) & m_capacity;
+                if(m_equal(Policy::key(m_slots[slot]), key)) [[likely]]
+                    return slot;
+            }
+            if(g.match_empty()) [[likely]]
+                return npos;
+            index += group::width;
+            pos = (pos + index) & m_capacity;
+        }
+    }
+
+    //! Finds a slot for the key, or the existing one.
+    //! @returns the index of the slot and true if it is empty.
+    template<typename K = key_type>
+    auto find_or_prepare_insert(const key_arg<K>& key) -> xme::Pair<size_type, bool> {
+        const size_type hash  = hash_of(key);
+        const size_type found = find_index(key, hash);
+        if(found != npos)
+            return {found, false};
+
+        size_type target = find_first_non_full(hash);
+        if(m_growth_left == 0 && m_ctrl[target] != ctrl_deleted) [[unlikely]] {
+            grow();
+            target = find_first_non_full(hash);
+        }
+        m_growth_left -= m_ctrl[target] == ctrl_empty;
+        set_ctrl(target, static_cast<ctrl_t>(hash & 0x7f));
+        ++m_size;
+        return {target, true};
+    }
+
+    //! Constructs a slot in index, found by find_or_prepare_insert.
+    template<typename... Args>
+    void construct_slot(size_type index, Args&&... args) {
+        slot_alloc alloc(m_allocator);
+        try {
+            slot_traits::construct(alloc, m_slots + index, std::forward<Args>(args)...);
+        }
+        catch(...) {
+            set_ctrl(index, ctrl_deleted);
+            --m_size;
+            throw;
+        }
+    }
+
+    auto iterator_at(size_type index) noexcept -> iterator {
+        return {m_ctrl + index, m_slots + index};
+    }
+
+    auto slot_at(size_type index) noexcept -> slot_type& { return m_slots[index]; }
+
+private:
+    template<typename U>
+    auto emplace_slot(U&& value) -> xme::Pair<iterator, bool> {
+        auto [index, inserted] = find_or_prepare_insert(Policy::key(value));
+        if(inserted) {
+            if constexpr(std::is_same_v<std::remove_cvref_t<U>, slot_type>)
+                construct_slot(index, std::forward<U>(value));
+            else
+                construct_slot(
+                  index, get<0>(std::forward<U>(value)), get<1>(std::forward<U>(value)));
+        }
+        return {iterator_at(index), inserted};
+    }
+
+    auto find_first_non_full(size_type hash) const noexcept -> size_type {
+        size_type index = 0;
+        size_type pos   = (hash >> 7) & m_capacity;
+        while(true) {
+            auto mask = group(m_ctrl + pos).match_empty_or_deleted();
+            if(mask)
+                return (pos + mask.lowest()) & m_capacity;
+            index += group::width;
+            pos = (pos + index) & m_capacity;
+        }
+    }
+
+    //! A slot can become empty again if no probe window containing it was ever full,
+    //! otherwise it is marked as deleted so probes continue past it.
+    void erase_index(size_type index) noexcept {
+        slot_alloc alloc(m_allocator);
+        slot_traits::destroy(alloc, m_slots + index);
+        --m_size;
+
+        const size_type before = (index - group::width) & m_capacity;
+        const auto empty_after  = group(m_ctrl + index).match_empty();
+        const auto empty_before = group(m_ctrl + before).match_empty();
+        const bool was_never_full =
+          empty_before && empty_after
+          && (empty_after.trailing_zeros() + empty_before.leading_zeros()) < group::width;
+
+        set_ctrl(index, was_never_full ? ctrl_empty : ctrl_deleted);
+        m_growth_left += was_never_full;
+    }
+
+    void set_ctrl(size_type index, ctrl_t h) noexcept {
+        m_ctrl[index] = h;
+        m_ctrl[((index - cloned_bytes) & m_capacity) + (cloned_bytes & m_capacity)] = h;
+    }
+
+    void reset_ctrl() noexcept {
+        std::memset(m_ctrl, ctrl_empty, m_capacity + group::width);
+        m_ctrl[m_capacity] = ctrl_sentinel;
+        m_growth_left      = capacity_to_growth(m_capacity) - m_size;
+    }
+
+    //! Grows the table, or only drops the deleted slots when they are too many.
+    void grow() {
+        if(m_capacity > group::width && m_size * 32 <= m_capacity * 25)
+            rehash(m_capacity);
+        else
+            rehash(m_capacity * 2 + 1);
+    }
+
+    void rehash(size_type new_capacity) {
+        ctrl_alloc ctrl_allocator(m_allocator);
+        slot_alloc slot_allocator(m_allocator);
+        ctrl_t* old_ctrl     = m_ctrl;
+        slot_type* old_slots = m_slots;
+        size_type old_cap    = m_capacity;
+
+        m_ctrl = ctrl_traits::allocate(ctrl_allocator, new_capacity + group::width);
+        try {
+            m_slots = slot_traits::allocate(slot_allocator, new_capacity);
+        }
+        catch(...) {
+            ctrl_traits::deallocate(ctrl_allocator, m_ctrl, new_capacity + group::width);
+            m_ctrl = old_ctrl;
+            throw;
+        }
+        m_capacity             = new_capacity;
+        const size_type count  = m_size;
+        m_size                 = 0;
+        reset_ctrl();
+
+        for(size_type i = 0; i < old_cap; ++i) {
+            if(old_ctrl[i] < 0)
+                continue;
+            const size_type hash   = hash_of(Policy::key(old_slots[i]));
+            const size_type target = find_first_non_full(hash);
+            set_ctrl(target, static_cast<ctrl_t>(hash & 0x7f));
+            slot_traits::construct(slot_allocator, m_slots + target, std::move(old_slots[i]));
+            slot_traits::destroy(slot_allocator, old_slots + i);
+        }
+        m_size        = count;
+        m_growth_left = capacity_to_growth(m_capacity) - m_size;
+        deallocate(old_ctrl, old_slots, old_cap);
+    }
+
+    void destroy_slots() noexcept {
+        if constexpr(!std::is_trivially_destructible_v<slot_type>) {
+            slot_alloc alloc(m_allocator);
+            for(size_type i = 0; i < m_capacity; ++i)
+                if(m_ctrl[i] >= 0)
+                    slot_traits::destroy(alloc, m_slots + i);
+        }
+    }
+
+    void deallocate(ctrl_t* ctrl, slot_type* slots, size_type cap) noexcept {
+        if(cap == 0)
+            return;
+        ctrl_alloc ctrl_allocator(m_allocator);
+        slot_alloc slot_allocator(m_allocator);
+        ctrl_traits::deallocate(ctrl_allocator, ctrl, cap + group::width);
+        slot_traits::deallocate(slot_allocator, slots, cap);
+    }
+
+    //! Keeps the load factor under 7/8, but always leaves an empty slot in small tables.
+    static constexpr auto capacity_to_growth(size_type cap) noexcept -> size_type {
+        if(group::width == 8 && cap == 7)
+            return 6;
+        return cap - cap / 8;
+    }
+
+    static constexpr auto growth_to_capacity(size_type growth) noexcept -> size_type {
+        if(group::width == 8 && growth == 7)
+            return 8;
+        return growth + (growth == 0 ? 0 : (growth - 1) / 7);
+    }
+
+    //! Capacities are always 2^N - 1, so they can be used as a mask.
+    static constexpr auto normalize_capacity(size_type n) noexcept -> size_type {
+        return n ? ~size_type(0) >> std::countl_zero(n) : 1;
+    }
+
+    ctrl_t* m_ctrl          = const_cast<ctrl_t*>(empty_group);
+    slot_type* m_slots      = nullptr;
+    size_type m_capacity    = 0;
+    size_type m_size        = 0;
+    size_type m_growth_left = 0;
+    [[no_unique_address]]
+    Hash m_hash;
+    [[no_unique_address]]
+    KeyEqual m_equal;
+    [[no_unique_address]]
+    Alloc m_allocator;
+};
+}  // namespace xme::detail
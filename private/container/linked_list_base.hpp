@@ -1,5 +1,8 @@
 #pragma once
+#include "prefetch.hpp"
 #include <xme/container/aligned_data.hpp>
+#include <iterator>
+#include <type_traits>
 
 namespace xme::detail {
 struct LinkedListNodeBase {
@@ -11,6 +14,31 @@ struct LinkedListNode : LinkedListNodeBase {
     xme::AlignedData<T> storage;
 };
 
+//! Element count of a LinkedList, which is empty and does nothing when it is not tracked.
+template<bool Track>
+struct LinkedListSize {
+    constexpr void add(std::size_t) noexcept {}
+
+    constexpr void sub(std::size_t) noexcept {}
+
+    constexpr void take(LinkedListSize&) noexcept {}
+};
+
+template<>
+struct LinkedListSize<true> {
+    constexpr void add(std::size_t n) noexcept { value += n; }
+
+    constexpr void sub(std::size_t n) noexcept { value -= n; }
+
+    //! Adds the count of other and sets it to 0.
+    constexpr void take(LinkedListSize& other) noexcept {
+        value += other.value;
+        other.value = 0;
+    }
+
+    std::size_t value = 0;
+};
+
 template<typename T>
 struct LinkedListIterator {
 private:
@@ -103,4 +131,83 @@ public:
 
     const node_base* current_node = nullptr;
 };
-}  // namespace xme::detail
\ No newline at end of file
+
+//! Forward iterator over a LinkedList that keeps a second node distance ahead of the
+//! current one and prefetches it, so the cache misses of the upcoming nodes overlap
+//! the work done on the current elements.
+//! Compares equal to std::default_sentinel at the end.
+//! @param T the type of the element, const for a const iteration
+template<typename T>
+struct LinkedListPrefetchIterator {
+private:
+    //! U with the constness of T
+    template<typename U>
+    using const_as_t = std::conditional_t<std::is_const_v<T>, const U, U>;
+
+    using node_base = const_as_t<LinkedListNodeBase>;
+    using node      = const_as_t<LinkedListNode<std::remove_const_t<T>>>;
+    using self      = LinkedListPrefetchIterator<T>;
+
+public:
+    using difference_type  = std::ptrdiff_t;
+    using value_type       = std::remove_const_t<T>;
+    using pointer          = T*;
+    using reference        = T&;
+    using iterator_concept = std::forward_iterator_tag;
+
+    constexpr LinkedListPrefetchIterator() noexcept = default;
+
+    constexpr LinkedListPrefetchIterator(node_base* first, std::size_t distance) noexcept :
+      current_node(first),
+      ahead_node(first) {
+        for(; distance > 0 && ahead_node; --distance)
+            advance_ahead();
+    }
+
+    constexpr auto operator->() const noexcept -> pointer {
+        return static_cast<node*>(current_node)->storage.data();
+    }
+
+    constexpr auto operator*() const noexcept -> reference {
+        return *static_cast<node*>(current_node)->storage.data();
+    }
+
+    constexpr auto operator++() noexcept -> self& {
+        current_node = current_node->next;
+        if(ahead_node)
+            advance_ahead();
+        return *this;
+    }
+
+    constexpr auto operator++(int) noexcept -> self {
+        self tmp{*this};
+        ++*this;
+        return tmp;
+    }
+
+    constexpr bool operator==(const self& rhs) const noexcept {
+        return current_node == rhs.current_node;
+    }
+
+    constexpr bool operator==(std::default_sentinel_t) const noexcept {
+        return current_node == nullptr;
+    }
+
+    node_base* current_node = nullptr;
+    node_base* ahead_node   = nullptr;
+
+private:
+    //! The node reached is prefetched now and read the next time the iterator advances.
+    constexpr void advance_ahead() noexcept {
+        ahead_node = ahead_node->next;
+        if(ahead_node)
+            prefetch_object<sizeof(node)>(ahead_node);
+    }
+};
+}  // namespace xme::detail
+
+namespace xme {
+//! Node shape shared by LinkedList and the intrusive lock free lists,
+//! a type must derive from it to be linked in a LockFreeStack or an MPSCQueue.
+using LinkedListHook = detail::LinkedListNodeBase;
+}  // namespace xme
@@ -0,0 +1,34 @@
+#pragma once
+#include <cstddef>
+#include <type_traits>
+#if defined(_MSC_VER) && (defined(_M_X64) || defined(_M_IX86))
+#    include <xmmintrin.h>
+#endif
+
+namespace xme::detail {
+//! Hints the cpu to bring the cache line of address into the cache for a read.
+//! It never faults, so address may be invalid, and it does nothing during constant evaluation.
+constexpr void prefetch_read(const void* address) noexcept {
+    if(std::is_constant_evaluated())
+        return;
+#if defined(__GNUC__) || defined(__clang__)
+    __builtin_prefetch(address, 0, 3);
+#elif defined(_MSC_VER) && (defined(_M_X64) || defined(_M_IX86))
+    _mm_prefetch(static_cast<const char*>(address), _MM_HINT_T0);
+#else
+    (void)address;
+#endif
+}
+
+//! Prefetches every cache line of an object of Size bytes at address.
+template<std::size_t Size>
+constexpr void prefetch_object(const void* address) noexcept {
+    constexpr std::size_t line = 64;
+    const auto* bytes          = static_cast<const char*>(address);
+    for(std::size_t offset = 0; offset < Size; offset += line)
+        prefetch_read(bytes + offset);
+    // An object smaller than a line may still straddle two.
+    if constexpr(Size % line != 0)
+        prefetch_read(bytes + Size - 1);
+}
+}  // namespace xme::detail
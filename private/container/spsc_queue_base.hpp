@@ -158,6 +158,12 @@ public:
         m_data = m_allocator.allocate(capacity);
     }
 
+    constexpr DynamicSPSCQueue(std::size_t capacity, const Alloc& alloc) :
+      m_capacity(capacity),
+      m_allocator(alloc) {
+        m_data = m_allocator.allocate(capacity);
+    }
+
     constexpr ~DynamicSPSCQueue() noexcept {
         while(m_read_index != m_write_index) {
             std::ranges::destroy_at(&m_data[m_read_index]);
@@ -0,0 +1,26 @@
+#pragma once
+#include <bit>
+#include <cstddef>
+#include <cstdint>
+#include <cstring>
+#include <type_traits>
+
+namespace xme::detail {
+//! Reads an unsigned integer stored in little endian order at p, which needs no alignment.
+//! Uses a single load on little endian targets, and the bytes one by one in constant
+//! expressions, where memcpy is not usable.
+template<typename T>
+[[nodiscard]]
+constexpr auto load_le(const std::byte* p) noexcept -> T {
+    static_assert(std::is_unsigned_v<T>, "T must be unsigned");
+    if(!std::is_constant_evaluated() && std::endian::native == std::endian::little) {
+        T value;
+        std::memcpy(&value, p, sizeof(T));
+        return value;
+    }
+    T value = 0;
+    for(std::size_t i = 0; i < sizeof(T); ++i)
+        value |= static_cast<T>(static_cast<T>(p[i]) << (8 * i));
+    return value;
+}
+}  // namespace xme::detail
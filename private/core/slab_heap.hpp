@@ -0,0 +1,323 @@
+#pragma once
+#include <algorithm>
+#include <atomic>
+#include <bit>
+#include <cstddef>
+#include <cstdint>
+#include <new>
+#include <utility>
+
+namespace xme::detail {
+//! Sizes up to slab_max_size are served from size classes, 16 byte apart up to 128 bytes,
+//! then 4 classes per power of 2.
+inline constexpr std::size_t slab_max_size    = 4096;
+inline constexpr std::size_t slab_class_count = 28;
+
+[[nodiscard]]
+constexpr auto slab_class(std::size_t bytes) noexcept -> std::size_t {
+    if(bytes <= 16)
+        return 0;
+    if(bytes <= 128)
+        return (bytes + 15) / 16 - 1;
+    const std::size_t log = std::bit_width(bytes - 1);
+    return 8 + (log - 8) * 4 + (((bytes - 1) >> (log - 3)) & 3);
+}
+
+[[nodiscard]]
+constexpr auto slab_class_size(std::size_t index) noexcept -> std::size_t {
+    if(index < 8)
+        return (index + 1) * 16;
+    const std::size_t log = (index - 8) / 4 + 8;
+    return (4 + (index - 8) % 4 + 1) << (log - 3);
+}
+
+//! Objects moved between a thread and the depot at once, fewer for large classes so a
+//! thread does not hold too much memory.
+[[nodiscard]]
+constexpr auto slab_magazine_capacity(std::size_t index) noexcept -> std::uint32_t {
+    const std::size_t capacity = std::clamp<std::size_t>(16384 / slab_class_size(index), 8, 64);
+    return static_cast<std::uint32_t>(capacity);
+}
+
+//! A stack of free objects of one size class, owned by one thread or by the depot.
+struct Magazine {
+    static constexpr std::uint32_t max_capacity = 64;
+
+    //! Index + 1 of the next magazine in a MagazineStack, 0 for none.
+    std::atomic<std::uint32_t> next = 0;
+    std::uint32_t index             = 0;
+    std::uint32_t count             = 0;
+    std::uint32_t capacity          = 0;
+    void* objects[max_capacity];
+};
+
+//! Owns every magazine and finds it by index. Magazines are never freed, so an index read
+//! from a stale stack head still names a valid magazine.
+class MagazineTable {
+private:
+    static constexpr std::uint32_t first_segment = 64;
+    static constexpr std::size_t segment_count   = 26;
+
+public:
+    MagazineTable() noexcept = default;
+
+    MagazineTable(const MagazineTable&) = delete;
+
+    auto operator=(const MagazineTable&) -> MagazineTable& = delete;
+
+    //! Creates a magazine, segment i holds first_segment << i of them.
+    [[nodiscard]]
+    auto create() -> Magazine* {
+        const std::uint32_t index    = m_count.fetch_add(1, std::memory_order_relaxed);
+        const auto [segment, offset] = locate(index);
+        Magazine* magazines          = m_segments[segment].load(std::memory_order_acquire);
+        if(magazines == nullptr) {
+            auto* created = new Magazine[std::size_t(first_segment) << segment];
+            if(m_segments[segment].compare_exchange_strong(magazines, created,
+                                                           std::memory_order_acq_rel))
+                magazines = created;
+            else
+                delete[] created;
+        }
+        Magazine* magazine = magazines + offset;
+        magazine->index    = index;
+        return magazine;
+    }
+
+    [[nodiscard]]
+    auto operator[](std::uint32_t index) const noexcept -> Magazine* {
+        const auto [segment, offset] = locate(index);
+        return m_segments[segment].load(std::memory_order_acquire) + offset;
+    }
+
+private:
+    [[nodiscard]]
+    static constexpr auto locate(std::uint32_t index) noexcept
+      -> std::pair<std::size_t, std::uint32_t> {
+        const std::size_t segment = std::bit_width(index / first_segment + 1) - 1;
+        return {segment, index - first_segment * ((std::uint32_t(1) << segment) - 1)};
+    }
+
+    std::atomic<Magazine*> m_segments[segment_count] = {};
+    std::atomic<std::uint32_t> m_count               = 0;
+};
+
+//! Lock free stack of magazines. The head packs the index + 1 of the top magazine with a
+//! counter bumped by every change, so a pop racing with a pop and push of the same
+//! magazine fails its compare exchange instead of linking a stale next.
+class MagazineStack {
+public:
+    void push(Magazine* magazine) noexcept {
+        std::uint64_t head = m_head.load(std::memory_order_relaxed);
+        std::uint64_t top;
+        do {
+            magazine->next.store(static_cast<std::uint32_t>(head), std::memory_order_relaxed);
+            top = next_tag(head) | (std::uint64_t(magazine->index) + 1);
+        } while(!m_head.compare_exchange_weak(head, top, std::memory_order_release,
+                                              std::memory_order_relaxed));
+    }
+
+    [[nodiscard]]
+    auto pop(const MagazineTable& table) noexcept -> Magazine* {
+        std::uint64_t head = m_head.load(std::memory_order_acquire);
+        Magazine* magazine;
+        std::uint64_t top;
+        do {
+            const auto index = static_cast<std::uint32_t>(head);
+            if(index == 0)
+                return nullptr;
+            magazine = table[index - 1];
+            top      = next_tag(head) | magazine->next.load(std::memory_order_relaxed);
+        } while(!m_head.compare_exchange_weak(head, top, std::memory_order_acquire,
+                                              std::memory_order_acquire));
+        return magazine;
+    }
+
+private:
+    [[nodiscard]]
+    static constexpr auto next_tag(std::uint64_t head) noexcept -> std::uint64_t {
+        return ((head >> 32) + 1) << 32;
+    }
+
+    alignas(64) std::atomic<std::uint64_t> m_head = 0;
+};
+
+//! The objects of one size class cached by a thread. Allocation pops from loaded and
+//! deallocation pushes to it, previous is swapped in when loaded runs empty or full, so a
+//! thread alternating between both only reaches the depot once per magazine.
+struct SlabClassCache {
+    Magazine* loaded   = nullptr;
+    Magazine* previous = nullptr;
+    //! The part of the thread's last chunk not handed out yet.
+    std::byte* cursor = nullptr;
+    std::byte* end    = nullptr;
+};
+
+struct SlabCache {
+    SlabClassCache classes[slab_class_count];
+    bool registered = false;
+};
+
+//! Size class allocator with per thread magazine caches in front of a shared depot.
+//! A thread allocates and deallocates from its own magazines without synchronization, and
+//! only exchanges a whole full or empty magazine with the depot when its two magazines run
+//! out, with a single compare exchange. Objects freed by another thread, like a consumer
+//! freeing what a producer allocated, fill the consumer's magazines, which go back to the
+//! producer through the depot.
+//! New objects are carved from 64 KiB chunks owned by the thread.
+//! The heap is never destroyed, so containers destroyed during static destruction can still
+//! free their nodes, and its memory is kept for reuse instead of returned to the system.
+class SlabHeap {
+private:
+    static constexpr std::size_t chunk_size  = 64 * 1024;
+    static constexpr std::size_t chunk_align = 64;
+
+public:
+    [[nodiscard]]
+    static auto instance() -> SlabHeap& {
+        static SlabHeap* heap = new SlabHeap;
+        return *heap;
+    }
+
+    SlabHeap(const SlabHeap&) = delete;
+
+    auto operator=(const SlabHeap&) -> SlabHeap& = delete;
+
+    //! Allocates an object of size class index, aligned to 16 bytes.
+    [[nodiscard]]
+    static auto allocate(std::size_t index) -> void* {
+        SlabClassCache& cache = local_cache().classes[index];
+        Magazine* magazine    = cache.loaded;
+        if(magazine && magazine->count != 0) [[likely]]
+            return magazine->objects[--magazine->count];
+        return instance().refill(cache, index);
+    }
+
+    static void deallocate(void* p, std::size_t index) noexcept {
+        SlabClassCache& cache = local_cache().classes[index];
+        Magazine* magazine    = cache.loaded;
+        if(magazine && magazine->count != magazine->capacity) [[likely]] {
+            magazine->objects[magazine->count++] = p;
+            return;
+        }
+        instance().drain(cache, index, p);
+    }
+
+private:
+    SlabHeap() noexcept = default;
+
+    //! Returns the magazines and the rest of the chunks of the thread to the depot at exit.
+    struct CacheFlusher {
+        ~CacheFlusher() { instance().flush(local_cache()); }
+    };
+
+    [[nodiscard]]
+    static auto local_cache() noexcept -> SlabCache& {
+        // Constant initialized and trivially destructible, so it needs no guard and stays
+        // usable after the flusher ran
+        static constinit thread_local SlabCache cache;
+        return cache;
+    }
+
+    static void register_flusher() noexcept {
+        SlabCache& cache = local_cache();
+        if(!cache.registered) {
+            cache.registered = true;
+            static thread_local CacheFlusher flusher;
+        }
+    }
+
+    //! Allocates when the loaded magazine is empty.
+    [[nodiscard]]
+    auto refill(SlabClassCache& cache, std::size_t index) -> void* {
+        register_flusher();
+        if(cache.previous && cache.previous->count != 0) {
+            std::swap(cache.loaded, cache.previous);
+        } else if(Magazine* full = m_full[index].pop(m_magazines)) {
+            // Keeps the empty loaded magazine for the next deallocations
+            if(cache.previous)
+                m_empty[index].push(cache.previous);
+            cache.previous = cache.loaded;
+            cache.loaded   = full;
+        } else {
+            if(cache.cursor == cache.end)
+                new_chunk(cache, index);
+            void* p = cache.cursor;
+            cache.cursor += slab_class_size(index);
+            return p;
+        }
+        return cache.loaded->objects[--cache.loaded->count];
+    }
+
+    //! Deallocates when the loaded magazine is full, or the thread has none yet.
+    void drain(SlabClassCache& cache, std::size_t index, void* p) noexcept {
+        register_flusher();
+        if(cache.previous && cache.previous->count != cache.previous->capacity) {
+            std::swap(cache.loaded, cache.previous);
+        } else {
+            Magazine* empty = m_empty[index].pop(m_magazines);
+            if(empty == nullptr) {
+                try {
+                    empty = new_magazine(index);
+                } catch(...) {
+                    return;  // p is lost, deallocation must not throw
+                }
+            }
+            if(cache.previous)
+                m_full[index].push(cache.previous);
+            cache.previous = cache.loaded;
+            cache.loaded   = empty;
+        }
+        cache.loaded->objects[cache.loaded->count++] = p;
+    }
+
+    [[nodiscard]]
+    auto new_magazine(std::size_t index) -> Magazine* {
+        Magazine* magazine = m_magazines.create();
+        magazine->capacity = slab_magazine_capacity(index);
+        return magazine;
+    }
+
+    void new_chunk(SlabClassCache& cache, std::size_t index) {
+        const std::size_t size  = slab_class_size(index);
+        const std::size_t bytes = std::max(chunk_size / size, std::size_t(1)) * size;
+        void* chunk             = ::operator new(bytes, std::align_val_t(chunk_align));
+        cache.cursor            = static_cast<std::byte*>(chunk);
+        cache.end               = cache.cursor + bytes;
+    }
+
+    void give_back(Magazine* magazine, std::size_t index) noexcept {
+        if(magazine)
+            (magazine->count != 0 ? m_full[index] : m_empty[index]).push(magazine);
+    }
+
+    void flush(SlabCache& local) noexcept {
+        for(std::size_t index = 0; index < slab_class_count; ++index) {
+            SlabClassCache& cache = local.classes[index];
+            give_back(std::exchange(cache.loaded, nullptr), index);
+            give_back(std::exchange(cache.previous, nullptr), index);
+            const std::size_t size = slab_class_size(index);
+            while(cache.cursor != cache.end) {
+                Magazine* magazine = m_empty[index].pop(m_magazines);
+                if(magazine == nullptr) {
+                    try {
+                        magazine = new_magazine(index);
+                    } catch(...) {
+                        break;  // the rest of the chunk is lost
+                    }
+                }
+                for(; cache.cursor != cache.end && magazine->count != magazine->capacity;
+                    cache.cursor += size)
+                    magazine->objects[magazine->count++] = cache.cursor;
+                m_full[index].push(magazine);
+            }
+            cache.cursor = nullptr;
+            cache.end    = nullptr;
+        }
+    }
+
+    MagazineTable m_magazines;
+    MagazineStack m_full[slab_class_count];
+    MagazineStack m_empty[slab_class_count];
+};
+}  // namespace xme::detail
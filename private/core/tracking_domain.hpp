@@ -0,0 +1,230 @@
+#pragma once
+#include <algorithm>
+#include <array>
+#include <atomic>
+#include <bit>
+#include <cstddef>
+#include <cstdint>
+#include <utility>
+
+namespace xme {
+//! Allocations of a tag of TrackingAllocator, summed over every thread.
+struct AllocationStats {
+    //! Allocations whose size is in [2^(i - 1), 2^i) bytes are counted in histogram[i],
+    //! the last bucket also counts every larger size.
+    static constexpr std::size_t histogram_size = 32;
+
+    std::uint64_t allocations       = 0;
+    std::uint64_t deallocations     = 0;
+    std::uint64_t bytes_allocated   = 0;
+    std::uint64_t bytes_deallocated = 0;
+    //! Bytes allocated and not deallocated yet.
+    std::uint64_t live_bytes = 0;
+    //! Highest live_bytes seen by allocation_stats, or published by a thread, which it does
+    //! every TrackingDomain::batch_bytes, so peaks between 2 calls may be missed by that much
+    //! per thread.
+    std::uint64_t peak_bytes = 0;
+    std::array<std::uint64_t, histogram_size> histogram{};
+};
+}  // namespace xme
+
+namespace xme::detail {
+//! Counters of one thread, reused by another thread after it exits. Only the owner writes
+//! them, with a relaxed load and store instead of a locked add, and they are atomic so
+//! stats can read them from any thread.
+struct TrackingRecord {
+    std::atomic<std::uint64_t> allocations       = 0;
+    std::atomic<std::uint64_t> deallocations     = 0;
+    std::atomic<std::uint64_t> bytes_allocated   = 0;
+    std::atomic<std::uint64_t> bytes_deallocated = 0;
+    std::atomic<std::uint64_t> histogram[AllocationStats::histogram_size]{};
+    //! Change of the live bytes of the thread not added to TrackingDomain::m_live yet.
+    std::int64_t unpublished = 0;
+    std::atomic<bool> in_use = false;
+    TrackingRecord* next     = nullptr;
+};
+
+inline void increment(std::atomic<std::uint64_t>& counter, std::uint64_t n) noexcept {
+    counter.store(counter.load(std::memory_order_relaxed) + n, std::memory_order_relaxed);
+}
+
+//! The per thread counters of the allocations of one Tag.
+//! Live bytes are published to a shared counter, which tracks the peak, once a thread has
+//! allocated or deallocated batch_bytes more, so threads only share a cache line once per
+//! batch.
+//! A thread that cannot allocate its record counts in a shared record with locked adds, so
+//! tracking never throws.
+//! The domain is never destroyed, so containers destroyed during static destruction can
+//! still be tracked.
+template<typename Tag>
+class TrackingDomain {
+public:
+    static constexpr std::int64_t batch_bytes = 64 * 1024;
+
+    [[nodiscard]]
+    static auto instance() noexcept -> TrackingDomain& {
+        // Constant initialized and trivially destructible, so it needs no guard and is never
+        // destroyed
+        static constinit TrackingDomain domain;
+        return domain;
+    }
+
+    TrackingDomain(const TrackingDomain&) = delete;
+
+    auto operator=(const TrackingDomain&) -> TrackingDomain& = delete;
+
+    static void on_allocate(std::size_t bytes) noexcept {
+        TrackingRecord* record = local_record();
+        if(record == nullptr) [[unlikely]] {
+            instance().shared_allocate(bytes);
+            return;
+        }
+        increment(record->allocations, 1);
+        increment(record->bytes_allocated, bytes);
+        increment(record->histogram[histogram_bucket(bytes)], 1);
+        record->unpublished += static_cast<std::int64_t>(bytes);
+        if(record->unpublished >= batch_bytes) [[unlikely]]
+            instance().publish(*record);
+    }
+
+    static void on_deallocate(std::size_t bytes) noexcept {
+        TrackingRecord* record = local_record();
+        if(record == nullptr) [[unlikely]] {
+            instance().shared_deallocate(bytes);
+            return;
+        }
+        increment(record->deallocations, 1);
+        increment(record->bytes_deallocated, bytes);
+        record->unpublished -= static_cast<std::int64_t>(bytes);
+        if(record->unpublished <= -batch_bytes) [[unlikely]]
+            instance().publish(*record);
+    }
+
+    [[nodiscard]]
+    auto stats() noexcept -> AllocationStats {
+        AllocationStats stats;
+        for(TrackingRecord* record = m_records.load(std::memory_order_acquire); record;
+            record                 = record->next) {
+            stats.allocations += record->allocations.load(std::memory_order_relaxed);
+            stats.deallocations += record->deallocations.load(std::memory_order_relaxed);
+            stats.bytes_allocated += record->bytes_allocated.load(std::memory_order_relaxed);
+            stats.bytes_deallocated += record->bytes_deallocated.load(std::memory_order_relaxed);
+            for(std::size_t i = 0; i < AllocationStats::histogram_size; ++i)
+                stats.histogram[i] += record->histogram[i].load(std::memory_order_relaxed);
+        }
+        // Another thread may deallocate what was allocated after its counters were read
+        stats.live_bytes = stats.bytes_allocated - std::min(stats.bytes_allocated,
+                                                            stats.bytes_deallocated);
+        stats.peak_bytes = update_peak(stats.live_bytes);
+        return stats;
+    }
+
+private:
+    constexpr TrackingDomain() noexcept = default;
+
+    //! Publishes the counters of a thread and releases its record when it exits.
+    struct LocalRecord {
+        ~LocalRecord() {
+            if(TrackingRecord* record = std::exchange(current(), nullptr)) {
+                instance().publish(*record);
+                record->in_use.store(false, std::memory_order_release);
+            }
+        }
+    };
+
+    [[nodiscard]]
+    static auto current() noexcept -> TrackingRecord*& {
+        // Constant initialized, so reading it needs no guard
+        static constinit thread_local TrackingRecord* record = nullptr;
+        return record;
+    }
+
+    //! @returns the record of the thread, or nullptr if it has none and none can be allocated
+    [[nodiscard]]
+    static auto local_record() noexcept -> TrackingRecord* {
+        TrackingRecord* record = current();
+        if(record == nullptr) [[unlikely]] {
+            try {
+                record = instance().attach();
+            }
+            catch(...) {
+                return nullptr;
+            }
+        }
+        return record;
+    }
+
+    [[nodiscard]]
+    static constexpr auto histogram_bucket(std::size_t bytes) noexcept -> std::size_t {
+        return std::min<std::size_t>(std::bit_width(bytes), AllocationStats::histogram_size - 1);
+    }
+
+    //! Gives the calling thread the record of an exited thread, or a new one.
+    [[nodiscard]]
+    auto attach() -> TrackingRecord* {
+        static thread_local LocalRecord local;
+        TrackingRecord* record = reuse_record();
+        if(record == nullptr) {
+            record         = new TrackingRecord;
+            record->in_use = true;
+            record->next   = m_records.load(std::memory_order_relaxed);
+            while(!m_records.compare_exchange_weak(record->next, record,
+                                                   std::memory_order_release,
+                                                   std::memory_order_relaxed)) {}
+        }
+        current() = record;
+        return record;
+    }
+
+    [[nodiscard]]
+    auto reuse_record() noexcept -> TrackingRecord* {
+        for(TrackingRecord* record = m_records.load(std::memory_order_acquire); record;
+            record                 = record->next) {
+            bool expected = false;
+            if(record->in_use.compare_exchange_strong(expected, true, std::memory_order_acquire))
+                return record;
+        }
+        return nullptr;
+    }
+
+    void publish(TrackingRecord& record) noexcept {
+        const std::int64_t delta = std::exchange(record.unpublished, 0);
+        const std::uint64_t live =
+          m_live.fetch_add(static_cast<std::uint64_t>(delta), std::memory_order_relaxed)
+          + static_cast<std::uint64_t>(delta);
+        // Frees of memory allocated by other threads can make live wrap below 0 for a while
+        if(static_cast<std::int64_t>(live) >= 0)
+            update_peak(live);
+    }
+
+    void shared_allocate(std::size_t bytes) noexcept {
+        m_shared.allocations.fetch_add(1, std::memory_order_relaxed);
+        m_shared.bytes_allocated.fetch_add(bytes, std::memory_order_relaxed);
+        m_shared.histogram[histogram_bucket(bytes)].fetch_add(1, std::memory_order_relaxed);
+        const std::uint64_t live = m_live.fetch_add(bytes, std::memory_order_relaxed) + bytes;
+        if(static_cast<std::int64_t>(live) >= 0)
+            update_peak(live);
+    }
+
+    void shared_deallocate(std::size_t bytes) noexcept {
+        m_shared.deallocations.fetch_add(1, std::memory_order_relaxed);
+        m_shared.bytes_deallocated.fetch_add(bytes, std::memory_order_relaxed);
+        m_live.fetch_sub(bytes, std::memory_order_relaxed);
+    }
+
+    //! @returns the peak after raising it to live
+    auto update_peak(std::uint64_t live) noexcept -> std::uint64_t {
+        std::uint64_t peak = m_peak.load(std::memory_order_relaxed);
+        while(live > peak
+              && !m_peak.compare_exchange_weak(peak, live, std::memory_order_relaxed)) {}
+        return std::max(peak, live);
+    }
+
+    //! Counters of the threads without a record, never handed to a thread and always the
+    //! last of m_records.
+    TrackingRecord m_shared{.in_use = true};
+    std::atomic<TrackingRecord*> m_records = &m_shared;
+    alignas(64) std::atomic<std::uint64_t> m_live = 0;
+    std::atomic<std::uint64_t> m_peak             = 0;
+};
+}  // namespace xme::detail
@@ -1,6 +1,10 @@
 #include <array>
+#include <cstdint>
 #include <iostream>
+#include <iterator>
 #include <list>
+#include <sstream>
+#include <string>
 #include <vector>
 #include <xme/container/array.hpp>
 
@@ -197,6 +201,29 @@ int test_insertion() {
             ++errors;
         }
     }
+    {
+        xme::Array<std::string> arr;
+        arr.reserve(16);
+        for(int i = 0; i < 6; ++i)
+            arr.push_back(std::to_string(i));
+        std::array<std::string, 2> few{"a", "b"};
+        std::array<std::string, 4> many{"c", "d", "e", "f"};
+        arr.insert(arr.begin() + 1, few);
+        arr.insert(arr.end() - 2, many);
+        const std::array<std::string, 12> expected{"0", "a", "b", "1", "2", "3",
+                                                   "c", "d", "e", "f", "4", "5"};
+        bool error = !std::ranges::equal(arr, expected) || arr.capacity() != 16;
+
+        std::istringstream stream{"x y"};
+        auto it = arr.insert(arr.begin() + 1, std::istream_iterator<std::string>{stream},
+                             std::istream_iterator<std::string>{});
+        error |= it != arr.begin() + 1 || arr[1] != "x" || arr[2] != "y" || arr[3] != "a";
+        error |= arr.size() != 14 || arr.back() != "5";
+        if(error) {
+            std::cerr << "xme::Array::insert 4 error\n";
+            ++errors;
+        }
+    }
     return errors;
 }
 
@@ -231,6 +258,33 @@ int test_delete() {
             ++errors;
         }
     }
+    {
+        xme::Array<std::string> arr;
+        for(int i = 0; i < 10; ++i)
+            arr.push_back(std::to_string(i));
+        auto is_odd = [](const std::string& str) { return (str.back() - '0') % 2 == 1; };
+        bool error  = arr.erase_if(is_odd) != 5 || arr.size() != 5;
+        error |= arr[0] != "0" || arr[1] != "2" || arr[4] != "8";
+        error |= xme::erase_if(arr, [](const std::string& str) { return str == "4"; }) != 1;
+        error |= arr.size() != 4 || arr[2] != "6";
+        if(error) {
+            std::cerr << "xme::Array::erase_if error\n";
+            ++errors;
+        }
+    }
+    {
+        xme::Array<std::string> arr{"a", "b", "c", "d"};
+        auto it    = arr.unordered_erase(arr.begin());
+        bool error = *it != "d" || arr.size() != 3 || arr[2] != "c";
+        it = arr.unordered_erase(arr.end() - 1);
+        error |= it != arr.end() || arr.size() != 2;
+        error |= arr.unordered_erase_if([](const std::string& str) { return str != "b"; }) != 1;
+        error |= arr.size() != 1 || arr[0] != "b";
+        if(error) {
+            std::cerr << "xme::Array::unordered_erase error\n";
+            ++errors;
+        }
+    }
     return errors;
 }
 
@@ -306,6 +360,74 @@ int test_insert_iterators() {
     return errors;
 }
 
+template<typename T>
+struct AtLeastAllocator : std::allocator<T> {
+    using value_type = T;
+
+    template<typename U>
+    struct rebind {
+        using other = AtLeastAllocator<U>;
+    };
+
+    auto allocate_at_least(std::size_t n) -> xme::AllocationResult<T*> {
+        return {std::allocator<T>::allocate(n + 3), n + 3};
+    }
+};
+
+int test_growth() {
+    int errors = 0;
+    {
+        xme::Array<int, std::allocator<int>, xme::HalfGrowth> arr;
+        std::vector<std::size_t> capacities;
+        for(int i = 0; i < 9; ++i) {
+            arr.push_back(i);
+            if(capacities.empty() || capacities.back() != arr.capacity())
+                capacities.push_back(arr.capacity());
+        }
+        bool error = capacities != std::vector<std::size_t>{1, 2, 3, 4, 6, 9};
+        if(error) {
+            std::cerr << "xme::Array HalfGrowth error\n";
+            ++errors;
+        }
+    }
+    {
+        xme::Array<int, std::allocator<int>, xme::FixedStepGrowth<4>> arr;
+        arr.push_back(1);
+        bool error = arr.capacity() != 4;
+        for(int i = 0; i < 4; ++i)
+            arr.push_back(i);
+        error |= arr.capacity() != 8 || arr.size() != 5;
+        if(error) {
+            std::cerr << "xme::Array FixedStepGrowth error\n";
+            ++errors;
+        }
+    }
+    {
+        xme::Array<std::int64_t, std::allocator<std::int64_t>, xme::PageRoundedGrowth<>> arr;
+        arr.push_back(1);
+        bool error = arr.capacity() != 4096 / sizeof(std::int64_t);
+        if(error) {
+            std::cerr << "xme::Array PageRoundedGrowth error\n";
+            ++errors;
+        }
+    }
+    {
+        xme::Array<int, AtLeastAllocator<int>> arr;
+        arr.push_back(5);
+        bool error = arr.capacity() != 4;
+        std::array<int, 3> values{1, 2, 3};
+        arr.insert(arr.begin(), values);
+        arr.insert(arr.begin(), 7);
+        error |= arr.size() != 5 || arr.capacity() != 11;
+        error |= arr[0] != 7 || arr[1] != 1 || arr[4] != 5;
+        if(error) {
+            std::cerr << "xme::Array allocate_at_least error\n";
+            ++errors;
+        }
+    }
+    return errors;
+}
+
 int main() {
     int errors = 0;
     errors += test_access();
@@ -314,5 +436,6 @@ int main() {
     errors += test_delete();
     errors += test_resize();
     errors += test_insert_iterators();
+    errors += test_growth();
     return errors;
 }
@@ -0,0 +1,127 @@
+#include <xme/container/array_view_nd.hpp>
+#include <xme/container/strided_view.hpp>
+#include <algorithm>
+#include <iostream>
+#include <numeric>
+#include <vector>
+
+static_assert(sizeof(xme::StridedView<int>) == sizeof(int*) + 2 * sizeof(std::size_t));
+static_assert(sizeof(xme::StridedView<int, 4>) == sizeof(int*) + sizeof(std::size_t));
+static_assert(std::ranges::random_access_range<xme::StridedView<int>>);
+static_assert(std::ranges::view<xme::StridedView<int>>);
+
+static_assert(sizeof(xme::Extents<3, 4>) == 1);
+static_assert(sizeof(xme::Extents<3, xme::dynamic_extent>) == sizeof(std::size_t));
+static_assert(xme::Extents<3, xme::dynamic_extent, xme::dynamic_extent>::rank_dynamic() == 2);
+static_assert(sizeof(xme::ArrayView2D<int, 3, 4>) == sizeof(int*));
+static_assert(sizeof(xme::ArrayView2D<int>) == sizeof(int*) + 2 * sizeof(std::size_t));
+static_assert(xme::ArrayView2D<int, 2, 3>(nullptr).mapping()({1, 2}) == 5);
+
+int test_strided_view() {
+    int errors = 0;
+    // 3 interleaved channels
+    int pixels[12];
+    std::iota(std::begin(pixels), std::end(pixels), 0);
+    xme::StridedView<int> green(pixels + 1, 4, 3);
+    bool error = green.size() != 4 || green[0] != 1 || green[3] != 10 || green.back() != 10;
+    error |= !std::ranges::equal(green, std::vector{1, 4, 7, 10});
+    error |= !std::ranges::equal(green.subview(1, 2), std::vector{4, 7});
+    error |= !std::ranges::equal(green.subview<2, 2>(), std::vector{7, 10});
+    error |= !std::ranges::equal(green.every(2), std::vector{1, 7});
+    error |= !std::ranges::equal(green.subview(4, 0), std::vector<int>{});
+
+    xme::StridedView<int> backwards(pixels + 11, 4, -3);
+    error |= !std::ranges::equal(backwards, std::vector{11, 8, 5, 2});
+    std::ranges::sort(backwards);
+    error |= !std::ranges::equal(backwards, std::vector{2, 5, 8, 11});
+
+    xme::StridedView all{xme::ArrayView{pixels}};
+    static_assert(std::is_same_v<decltype(all), xme::StridedView<int, 12>>);
+    error |= all.stride() != 1 || all.size() != 12 || all[4] != 4;
+    for(int& value : green)
+        value = -1;
+    error |= pixels[4] != -1 || pixels[3] != 3;
+    if(error) {
+        std::cerr << "xme::StridedView error\n";
+        ++errors;
+    }
+    return errors;
+}
+
+int test_layouts() {
+    int errors = 0;
+    std::vector<int> buffer(12);
+    std::iota(buffer.begin(), buffer.end(), 0);
+    {
+        xme::ArrayView2D<int> rows(buffer.data(), 3, 4);
+        bool error = rows.extent(0) != 3 || rows.extent(1) != 4 || rows.size() != 12;
+        error |= rows(1, 2) != 6 || rows[{2, 3}] != 11;
+        error |= rows.stride(0) != 4 || rows.stride(1) != 1;
+
+        xme::ArrayView2D<int, 3, 4, xme::LayoutColumnMajor> columns(buffer.data());
+        error |= columns(1, 2) != 7 || columns(2, 0) != 2 || columns.stride(1) != 3;
+
+        // static rows and dynamic columns, constructed from the dynamic extent only
+        xme::ArrayView2D<const int, 3> partial(buffer.data(), 4);
+        error |= partial.extent(1) != 4 || partial(2, 1) != 9;
+        error |= !std::ranges::equal(rows.as_array_view(), buffer);
+
+        xme::ArrayView2D<const int, xme::dynamic_extent, xme::dynamic_extent, xme::LayoutStrided>
+          strided{rows};
+        error |= strided(1, 2) != 6 || strided.stride(0) != 4;
+        if(error) {
+            std::cerr << "xme::ArrayViewND layout error\n";
+            ++errors;
+        }
+    }
+    {
+        xme::ArrayViewND<int, xme::Extents<2, 2, 3>> volume(xme::ArrayView{buffer});
+        bool error = volume(1, 0, 2) != 8 || volume.stride(0) != 6 || volume.rank() != 3;
+        auto plane = volume.slice<0>(1);
+        error |= plane.rank() != 2 || plane(1, 1) != 10 || plane.size() != 6;
+        auto depth = volume.slice<2>(1);
+        error |= depth.extent(0) != 2 || depth.extent(1) != 2 || depth(1, 1) != 10;
+        if(error) {
+            std::cerr << "xme::ArrayViewND::slice error\n";
+            ++errors;
+        }
+    }
+    return errors;
+}
+
+int test_subviews() {
+    int errors = 0;
+    std::vector<int> image(6 * 5);
+    std::iota(image.begin(), image.end(), 0);
+    xme::ArrayView2D<int> view(image.data(), 6, 5);
+
+    auto column = view.column(3);
+    bool error  = column.size() != 6 || column.stride() != 5;
+    error |= !std::ranges::equal(column, std::vector{3, 8, 13, 18, 23, 28});
+    error |= !std::ranges::equal(view.row(2), std::vector{10, 11, 12, 13, 14});
+
+    auto tile = view.subview({2, 1}, {3, 2});
+    error |= tile.extent(0) != 3 || tile.extent(1) != 2 || tile(0, 0) != 11 || tile(2, 1) != 22;
+    error |= tile.mapping().required_span_size() != 12;
+    auto inner = tile.subview({1, 1}, {2, 1});
+    error |= inner(0, 0) != 17 || inner(1, 0) != 22;
+    error |= !std::ranges::equal(tile.column(1), std::vector{12, 17, 22});
+    error |= !view.subview({6, 5}, {0, 0}).is_empty();
+
+    for(int& value : tile.row(1))
+        value = -1;
+    error |= image[16] != -1 || image[17] != -1 || image[18] != 18;
+    if(error) {
+        std::cerr << "xme::ArrayViewND::subview error\n";
+        ++errors;
+    }
+    return errors;
+}
+
+int main() {
+    int errors = 0;
+    errors += test_strided_view();
+    errors += test_layouts();
+    errors += test_subviews();
+    return errors;
+}
@@ -0,0 +1,106 @@
+#include <algorithm>
+#include <iostream>
+#include <random>
+#include <vector>
+#include <xme/container/bit_array.hpp>
+
+int test_bits() {
+    int errors = 0;
+    xme::BitArray bits(130);
+    bits.set(0);
+    bits.set(64);
+    bits.set(129);
+    bool error = bits.count() != 3 || !bits[64] || bits[63] || bits.words().size() != 3;
+    error |= bits.find_first() != 0 || bits.find_next(0) != 64 || bits.find_next(64) != 129;
+    error |= bits.find_next(129) != 130;
+
+    bits.flip();
+    error |= bits.count() != 127 || bits.words()[2] != 0b01;
+    bits.resize(200, true);
+    error |= bits.count() != 197 || !bits[199];
+    bits.push_back(false);
+    error |= bits.size() != 201 || bits[200];
+    if(error) {
+        std::cerr << "xme::BitArray bits error\n";
+        ++errors;
+    }
+    return errors;
+}
+
+int test_operations() {
+    int errors = 0;
+    xme::BitArray lhs(100);
+    xme::BitArray rhs(100);
+    for(std::size_t i = 0; i < 100; i += 2)
+        lhs.set(i);
+    for(std::size_t i = 0; i < 100; i += 3)
+        rhs.set(i);
+    bool error = (lhs & rhs).count() != 17 || (lhs | rhs).count() != 67;
+    error |= (lhs ^ rhs).count() != 50 || (~lhs).count() != 50;
+    error |= (lhs ^ lhs).any() || !(lhs | ~lhs).all() || lhs == rhs;
+    if(error) {
+        std::cerr << "xme::BitArray operations error\n";
+        ++errors;
+    }
+    return errors;
+}
+
+int test_rank_select() {
+    int errors = 0;
+    std::mt19937_64 rng(42);
+    xme::BitArray bits;
+    std::vector<std::size_t> positions;
+    for(std::size_t i = 0; i < 100000; ++i) {
+        const bool value = rng() % 7 == 0 || (i > 50000 && i < 52000);
+        bits.push_back(value);
+        if(value)
+            positions.push_back(i);
+    }
+    bits.build_index();
+
+    bool error       = !bits.indexed() || bits.rank(bits.size()) != positions.size();
+    std::size_t ones = 0;
+    for(std::size_t i = 0; i < bits.size(); ++i) {
+        error |= bits.rank(i) != ones;
+        ones += bits[i];
+    }
+    for(std::size_t k = 0; k < positions.size(); ++k)
+        error |= bits.select(k) != positions[k];
+    error |= bits.select(positions.size()) != bits.size();
+
+    bits.set(1);
+    error |= bits.indexed();
+    if(error) {
+        std::cerr << "xme::BitArray::rank/select error\n";
+        ++errors;
+    }
+
+    // Samples far apart, with many empty superblocks between set bits
+    xme::BitArray sparse(2'000'000, false);
+    positions.clear();
+    for(std::size_t i = 0; i < 600; ++i)
+        positions.push_back(i);
+    for(std::size_t i = 3; i < 600; ++i)
+        positions.push_back(i * 3313);
+    std::ranges::sort(positions);
+    positions.erase(std::unique(positions.begin(), positions.end()), positions.end());
+    for(std::size_t position : positions)
+        sparse.set(position);
+    sparse.build_index();
+    error = false;
+    for(std::size_t k = 0; k < positions.size(); ++k)
+        error |= sparse.select(k) != positions[k];
+    if(error) {
+        std::cerr << "xme::BitArray::select sparse error\n";
+        ++errors;
+    }
+    return errors;
+}
+
+int main() {
+    int errors = 0;
+    errors += test_bits();
+    errors += test_operations();
+    errors += test_rank_select();
+    return errors;
+}
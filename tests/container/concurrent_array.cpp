@@ -0,0 +1,79 @@
+#include <algorithm>
+#include <atomic>
+#include <iostream>
+#include <string>
+#include <thread>
+#include <vector>
+#include <xme/container/concurrent_array.hpp>
+
+int test_push_back() {
+    int errors = 0;
+    xme::ConcurrentArray<std::string, 4> array;
+    for(int i = 0; i < 1000; ++i)
+        array.push_back(std::to_string(i));
+
+    bool error = array.size() != 1000 || array[0] != "0" || array[999] != "999";
+    const std::string* address = &array[3];
+    array.emplace_back(10, 'a');
+    error |= address != &array[3] || array[1000] != std::string(10, 'a');
+
+    int index = 0;
+    for(auto& str : array)
+        error |= str != (index < 1000 ? std::to_string(index++) : std::string(10, 'a'));
+    if(error) {
+        std::cerr << "xme::ConcurrentArray::push_back error\n";
+        ++errors;
+    }
+    return errors;
+}
+
+int test_concurrent() {
+    int errors = 0;
+    constexpr int writers  = 8;
+    constexpr int per_item = 20000;
+
+    xme::ConcurrentArray<int> array;
+    std::atomic<bool> done = false;
+    std::atomic<bool> error = false;
+
+    std::thread reader([&] {
+        while(!done.load()) {
+            std::size_t count = 0;
+            for(int value : array) {
+                error = error || value < 0 || value >= writers * per_item;
+                ++count;
+            }
+            error = error || count > array.size();
+        }
+    });
+
+    std::vector<std::thread> threads;
+    for(int t = 0; t < writers; ++t) {
+        threads.emplace_back([&, t] {
+            for(int i = 0; i < per_item; ++i)
+                array.push_back(t * per_item + i);
+        });
+    }
+    for(auto& thread : threads)
+        thread.join();
+    done = true;
+    reader.join();
+
+    std::vector<bool> seen(writers * per_item);
+    for(int value : array)
+        seen[value] = true;
+    error = error || array.size() != writers * per_item;
+    error = error || std::find(seen.begin(), seen.end(), false) != seen.end();
+    if(error) {
+        std::cerr << "xme::ConcurrentArray concurrent push_back error\n";
+        ++errors;
+    }
+    return errors;
+}
+
+int main() {
+    int errors = 0;
+    errors += test_push_back();
+    errors += test_concurrent();
+    return errors;
+}
@@ -0,0 +1,210 @@
+#include <algorithm>
+#include <atomic>
+#include <cstdlib>
+#include <iostream>
+#include <iterator>
+#include <map>
+#include <random>
+#include <ranges>
+#include <string>
+#include <thread>
+#include <vector>
+#include <xme/container/concurrent_skip_list.hpp>
+
+int test_insert_erase() {
+    int errors = 0;
+    xme::ConcurrentSkipListMap<int, std::string> map;
+    std::map<int, std::string> expected;
+    std::mt19937 rng(5);
+    for(int i = 0; i < 5000; ++i) {
+        const int key = int(rng() % 1000);
+        if(rng() % 3 == 0) {
+            const bool erased = map.erase(key);
+            if(erased != (expected.erase(key) == 1)) {
+                std::cerr << "xme::ConcurrentSkipListMap::erase error\n";
+                return 1;
+            }
+        }
+        else {
+            const bool inserted = map.insert(key, std::to_string(key));
+            if(inserted != expected.emplace(key, std::to_string(key)).second) {
+                std::cerr << "xme::ConcurrentSkipListMap::insert error\n";
+                return 1;
+            }
+        }
+    }
+    bool error = map.size() != expected.size() || map.find(-1).has_value();
+    for(auto& [key, value] : expected)
+        error |= map.find(key) != value || !map.contains(key);
+
+    auto it = map.begin();
+    for(auto& [key, value] : expected) {
+        error |= it == map.end() || it.key() != key || (*it).second != value;
+        ++it;
+    }
+    error |= it != map.end();
+    if(error) {
+        std::cerr << "xme::ConcurrentSkipListMap::(find|begin) error\n";
+        ++errors;
+    }
+    return errors;
+}
+
+int test_lower_bound() {
+    int errors = 0;
+    xme::ConcurrentSkipListMap<int, int, std::greater<int>> map;
+    for(int i = 0; i < 100; i += 10)
+        map.try_emplace(i, i * 2);
+    auto it    = map.lower_bound(55);
+    bool error = it == map.end() || it.key() != 50 || it.value() != 100;
+    error |= map.lower_bound(-5) != map.end() || map.lower_bound(1000).key() != 90;
+    map.erase(50);
+    error |= map.lower_bound(55).key() != 40;
+    if(error) {
+        std::cerr << "xme::ConcurrentSkipListMap::lower_bound error\n";
+        ++errors;
+    }
+    return errors;
+}
+
+int test_iterator() {
+    using Map = xme::ConcurrentSkipListMap<int, std::string>;
+    static_assert(std::forward_iterator<Map::iterator>);
+    static_assert(std::ranges::forward_range<Map>);
+
+    int errors = 0;
+    Map map;
+    for(int i = 0; i < 10; ++i)
+        map.try_emplace(i, std::to_string(i));
+    auto it    = std::ranges::find_if(map, [](const auto& pair) { return pair.second == "7"; });
+    bool error = it == map.end() || it.key() != 7;
+    error |= std::ranges::distance(map) != 10;
+    auto keys = map | std::views::transform([](const auto& pair) { return pair.first; });
+    error |= !std::ranges::is_sorted(keys);
+    if(error) {
+        std::cerr << "xme::ConcurrentSkipListMap iterator error\n";
+        ++errors;
+    }
+    return errors;
+}
+
+//! Each writer owns a range of keys and inserts and erases them repeatedly,
+//! while readers scan the map and check that it stays ordered.
+int test_concurrent() {
+    int errors = 0;
+    constexpr int writers  = 4;
+    constexpr int readers  = 2;
+    constexpr int keys     = 500;
+    constexpr int rounds   = 20;
+
+    xme::ConcurrentSkipListMap<int, std::string> map;
+    std::atomic<bool> done  = false;
+    std::atomic<bool> error = false;
+
+    std::vector<std::thread> threads;
+    for(int r = 0; r < readers; ++r) {
+        threads.emplace_back([&] {
+            while(!done.load()) {
+                int previous = -1;
+                for(auto it = map.begin(); it != map.end(); ++it) {
+                    if(it.key() <= previous || it.value() != std::to_string(it.key()))
+                        error = true;
+                    previous = it.key();
+                }
+                for(int key = 0; key < writers * keys; key += 97) {
+                    auto value = map.find(key);
+                    if(value && *value != std::to_string(key))
+                        error = true;
+                }
+            }
+        });
+    }
+    std::vector<std::thread> writer_threads;
+    for(int w = 0; w < writers; ++w) {
+        writer_threads.emplace_back([&, w] {
+            for(int round = 0; round < rounds; ++round) {
+                for(int key = w; key < writers * keys; key += writers) {
+                    if(!map.insert(key, std::to_string(key)))
+                        error = true;
+                }
+                for(int key = w; key < writers * keys; key += writers) {
+                    if(round + 1 < rounds || key % 2 == 0) {
+                        if(!map.erase(key))
+                            error = true;
+                    }
+                }
+            }
+        });
+    }
+    for(std::thread& thread : writer_threads)
+        thread.join();
+    done = true;
+    for(std::thread& thread : threads)
+        thread.join();
+
+    int count = 0;
+    for(auto it = map.begin(); it != map.end(); ++it)
+        error = error || it.key() % 2 == 0 || (++count, false);
+    if(error || count != writers * keys / 2 || map.size() != std::size_t(count)) {
+        std::cerr << "xme::ConcurrentSkipListMap concurrent error\n";
+        ++errors;
+    }
+    return errors;
+}
+
+//! Every thread races to insert and erase the same few keys.
+int test_contended() {
+    int errors = 0;
+    xme::ConcurrentSkipListMap<int, int> map;
+    std::atomic<int> balance[8]{};
+    std::vector<std::thread> threads;
+    for(int t = 0; t < 8; ++t) {
+        threads.emplace_back([&, t] {
+            std::mt19937 rng(t);
+            for(int i = 0; i < 20000; ++i) {
+                const int key = int(rng() % 8);
+                if(rng() % 2)
+                    balance[key] += map.insert(key, key);
+                else
+                    balance[key] -= map.erase(key);
+            }
+        });
+    }
+    for(std::thread& thread : threads)
+        thread.join();
+    bool error = false;
+    for(int key = 0; key < 8; ++key)
+        error |= balance[key] != int(map.contains(key));
+    if(error) {
+        std::cerr << "xme::ConcurrentSkipListMap contended error\n";
+        ++errors;
+    }
+    return errors;
+}
+
+//! Constructed before the epoch domain is first used, so it is destroyed after it would be.
+struct UsedAtExit {
+    ~UsedAtExit() {
+        xme::ConcurrentSkipListMap<int, int> map;
+        for(int i = 0; i < 200; ++i)
+            map.insert(i, i);
+        for(int i = 0; i < 200; ++i)
+            map.erase(i);
+        if(!map.empty() || map.begin() != map.end()) {
+            std::cerr << "xme::ConcurrentSkipListMap static destruction error\n";
+            std::_Exit(1);
+        }
+    }
+};
+
+UsedAtExit used_at_exit;
+
+int main() {
+    int errors = 0;
+    errors += test_insert_erase();
+    errors += test_lower_bound();
+    errors += test_iterator();
+    errors += test_concurrent();
+    errors += test_contended();
+    return errors;
+}
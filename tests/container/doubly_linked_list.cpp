@@ -0,0 +1,128 @@
+#include <iostream>
+#include <string>
+#include <xme/container/array.hpp>
+#include <xme/container/doubly_linked_list.hpp>
+
+template<typename List>
+bool equals(const List& list, std::initializer_list<int> expected) {
+    if(list.size() != expected.size())
+        return false;
+    auto it = expected.begin();
+    for(const auto& value : list) {
+        if(value != *it++)
+            return false;
+    }
+    // Walks backwards to check the prev links.
+    auto rit = expected.end();
+    for(auto curr = list.rbegin(); curr != list.rend(); ++curr) {
+        if(*curr != *--rit)
+            return false;
+    }
+    return true;
+}
+
+int test_constructors() {
+    int errors = 0;
+    {
+        xme::DoublyLinkedList<std::string> list(3, "abc");
+        bool error = list.size() != 3 || list.front() != "abc" || list.back() != "abc";
+        xme::DoublyLinkedList<int> ints{1, 2, 3};
+        error |= !equals(ints, {1, 2, 3});
+        xme::DoublyLinkedList<int> from_range(xme::Array<int>{4, 5});
+        error |= !equals(from_range, {4, 5});
+        if(error) {
+            std::cerr << "xme::DoublyLinkedList::DoublyLinkedList error\n";
+            ++errors;
+        }
+    }
+    {
+        xme::DoublyLinkedList<int> list{1, 2, 3};
+        xme::DoublyLinkedList<int> copy{list};
+        xme::DoublyLinkedList<int> moved{std::move(list)};
+        bool error = !equals(copy, {1, 2, 3}) || !equals(moved, {1, 2, 3}) || !list.is_empty();
+        list.push_back(7);
+        error |= !equals(list, {7});
+
+        copy = xme::DoublyLinkedList<int>{4, 5, 6, 7};
+        error |= !equals(copy, {4, 5, 6, 7});
+        copy = moved;
+        error |= !equals(copy, {1, 2, 3});
+        copy = {9};
+        error |= !equals(copy, {9});
+        xme::DoublyLinkedList<int> empty;
+        copy = std::move(empty);
+        error |= !copy.is_empty() || copy.begin() != copy.end();
+        if(error) {
+            std::cerr << "xme::DoublyLinkedList copy/move error\n";
+            ++errors;
+        }
+    }
+    return errors;
+}
+
+int test_modifiers() {
+    int errors = 0;
+    xme::DoublyLinkedList<int> list;
+    list.push_back(2);
+    list.push_front(1);
+    list.emplace_back(4);
+    auto three = list.insert(std::prev(list.end()), 3);
+    bool error = !equals(list, {1, 2, 3, 4}) || *three != 3;
+
+    auto after = list.erase(three);
+    error |= *after != 4 || !equals(list, {1, 2, 4});
+    const int values[] = {7, 8};
+    auto first = list.insert(list.begin(), std::begin(values), std::end(values));
+    error |= *first != 7 || !equals(list, {7, 8, 1, 2, 4});
+    list.pop_front();
+    list.pop_back();
+    error |= !equals(list, {8, 1, 2});
+    list.reverse();
+    error |= !equals(list, {2, 1, 8});
+    list.erase(std::next(list.begin()), list.end());
+    error |= !equals(list, {2});
+    list.clear();
+    error |= !list.is_empty() || list.begin() != list.end();
+    if(error) {
+        std::cerr << "xme::DoublyLinkedList modifiers error\n";
+        ++errors;
+    }
+    return errors;
+}
+
+int test_splice() {
+    int errors = 0;
+    xme::DoublyLinkedList<int> lhs{1, 2, 3};
+    xme::DoublyLinkedList<int> rhs{4, 5, 6};
+
+    auto five = std::next(rhs.begin());
+    lhs.splice(lhs.begin(), rhs, five);
+    bool error = !equals(lhs, {5, 1, 2, 3}) || !equals(rhs, {4, 6}) || &*five != &lhs.front();
+
+    // Moving an element inside the same list keeps its iterator valid.
+    auto three = std::prev(lhs.end());
+    lhs.splice(lhs.begin(), lhs, three);
+    error |= !equals(lhs, {3, 5, 1, 2}) || *three != 3;
+    lhs.splice(lhs.begin(), lhs, lhs.begin());
+    error |= !equals(lhs, {3, 5, 1, 2});
+
+    lhs.splice(lhs.end(), lhs, lhs.begin(), std::next(lhs.begin(), 2));
+    error |= !equals(lhs, {1, 2, 3, 5});
+    lhs.splice(std::next(lhs.begin()), rhs, rhs.begin(), rhs.end());
+    error |= !equals(lhs, {1, 4, 6, 2, 3, 5}) || !rhs.is_empty();
+    rhs.splice(rhs.end(), lhs);
+    error |= !equals(rhs, {1, 4, 6, 2, 3, 5}) || !lhs.is_empty();
+    if(error) {
+        std::cerr << "xme::DoublyLinkedList::splice error\n";
+        ++errors;
+    }
+    return errors;
+}
+
+int main() {
+    int errors = 0;
+    errors += test_constructors();
+    errors += test_modifiers();
+    errors += test_splice();
+    return errors;
+}
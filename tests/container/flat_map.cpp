@@ -0,0 +1,97 @@
+#include <algorithm>
+#include <iostream>
+#include <iterator>
+#include <ranges>
+#include <string>
+#include <xme/container/flat_map.hpp>
+
+int test_insertion() {
+    int errors = 0;
+    {
+        xme::FlatMap<int, int> map;
+        for(int i = 499; i >= 0; --i)
+            map.try_emplace(i % 250, i);
+        bool error = map.size() != 250 || !map.contains(249) || map.contains(250);
+        error |= map.find(10) == map.end() || map[10] != 260;
+        error |= !std::ranges::is_sorted(map.keys());
+        if(error) {
+            std::cerr << "xme::FlatMap::try_emplace error\n";
+            ++errors;
+        }
+    }
+    {
+        xme::FlatMap<std::string, int> map{{"b", 2}, {"a", 1}, {"c", 3}};
+        map["d"]   = 4;
+        auto [it, inserted] = map.insert_or_assign("a", 10);
+        bool error = inserted || get<1>(*it) != 10 || map.size() != 4;
+        error |= map.keys()[0] != "a" || map.keys()[3] != "d" || map.values()[3] != 4;
+        if(error) {
+            std::cerr << "xme::FlatMap::insert_or_assign error\n";
+            ++errors;
+        }
+    }
+    return errors;
+}
+
+int test_insert_range() {
+    int errors = 0;
+    xme::FlatMap<int, int> map{{1, 1}, {5, 5}, {9, 9}};
+    xme::Array<xme::Pair<int, int>> items;
+    for(int i = 10; i >= 0; --i)
+        items.emplace_back(i, -i);
+    items.emplace_back(3, 100);
+    map.insert_range(items);
+
+    bool error = map.size() != 11 || !std::ranges::is_sorted(map.keys());
+    error |= map[1] != 1 || map[5] != 5 || map[9] != 9;
+    error |= map[3] != -3 || map[10] != -10;
+    if(error) {
+        std::cerr << "xme::FlatMap::insert_range error\n";
+        ++errors;
+    }
+    return errors;
+}
+
+int test_erase() {
+    int errors = 0;
+    xme::FlatMap<int, int> map{{1, 1}, {2, 2}, {3, 3}};
+    bool error = map.erase(2) != 1 || map.erase(2) != 0 || map.contains(2);
+    auto it = map.erase(map.find(1));
+    error |= it == map.end() || get<0>(*it) != 3 || map.size() != 1;
+    error |= map.lower_bound(0) != map.begin() || map.lower_bound(4) != map.end();
+    if(error) {
+        std::cerr << "xme::FlatMap::erase error\n";
+        ++errors;
+    }
+    return errors;
+}
+
+int test_iterator() {
+    using Map = xme::FlatMap<int, std::string>;
+    static_assert(std::random_access_iterator<Map::iterator>);
+    static_assert(std::random_access_iterator<Map::const_iterator>);
+    static_assert(std::ranges::random_access_range<const Map>);
+
+    int errors = 0;
+    Map map{{1, "a"}, {2, "b"}, {3, "c"}};
+    map.find(2)->second = "x";
+    const Map& cmap     = map;
+    bool error          = cmap.find(2)->second != "x" || cmap.find(3)->first != 3;
+    auto it = std::ranges::find_if(map, [](const auto& p) { return p.second == "c"; });
+    error |= it == map.end() || it->first != 3;
+    error |= std::ranges::distance(map | std::views::reverse) != 3;
+    if(error) {
+        std::cerr << "xme::FlatMap::iterator error\n";
+        ++errors;
+    }
+    return errors;
+}
+
+int main() {
+    int errors = 0;
+    errors += test_insertion();
+    errors += test_insert_range();
+    errors += test_erase();
+    errors += test_iterator();
+    return errors;
+}
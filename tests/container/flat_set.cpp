@@ -0,0 +1,54 @@
+#include <iostream>
+#include <string>
+#include <xme/container/flat_set.hpp>
+
+int test_insertion() {
+    int errors = 0;
+    {
+        xme::FlatSet<int> set;
+        for(int i = 0; i < 500; ++i)
+            set.insert((i * 7) % 250);
+        bool error = set.size() != 250 || !set.contains(249) || set.contains(250);
+        error |= !std::ranges::is_sorted(set) || *set.lower_bound(100) != 100;
+        if(error) {
+            std::cerr << "xme::FlatSet::insert error\n";
+            ++errors;
+        }
+    }
+    {
+        xme::FlatSet<std::string> set{"c", "a", "b", "a"};
+        auto [it, inserted] = set.emplace("d");
+        bool error          = !inserted || *it != "d" || set.size() != 4;
+        error |= set.keys()[0] != "a" || set.keys()[3] != "d";
+        if(error) {
+            std::cerr << "xme::FlatSet::emplace error\n";
+            ++errors;
+        }
+    }
+    return errors;
+}
+
+int test_insert_range() {
+    int errors = 0;
+    xme::FlatSet<int> set{2, 4, 6};
+    xme::Array<int> items;
+    for(int i = 7; i >= 0; --i)
+        items.push_back(i);
+    items.push_back(3);
+    set.insert_range(items);
+    bool error = set.size() != 8 || !std::ranges::is_sorted(set);
+    error |= std::ranges::adjacent_find(set) != set.end();
+    error |= set.erase(4) != 1 || set.contains(4) || set.size() != 7;
+    if(error) {
+        std::cerr << "xme::FlatSet::insert_range error\n";
+        ++errors;
+    }
+    return errors;
+}
+
+int main() {
+    int errors = 0;
+    errors += test_insertion();
+    errors += test_insert_range();
+    return errors;
+}
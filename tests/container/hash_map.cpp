@@ -0,0 +1,246 @@
+#include <iostream>
+#include <memory>
+#include <stdexcept>
+#include <string>
+#include <string_view>
+#include <xme/container/hash_map.hpp>
+#include <xme/core/memory/monotonic_arena.hpp>
+
+struct MoveOnly {
+    MoveOnly(int v) : value(v) {}
+    MoveOnly(MoveOnly&&)                    = default;
+    auto operator=(MoveOnly&&) -> MoveOnly& = default;
+
+    int value;
+};
+
+struct StringHash {
+    using is_transparent = void;
+
+    auto operator()(std::string_view str) const noexcept -> std::size_t {
+        return std::hash<std::string_view>{}(str);
+    }
+};
+
+struct SeededHash {
+    auto operator()(int value) const noexcept -> std::size_t {
+        return std::hash<int>{}(value) ^ seed;
+    }
+
+    std::size_t seed;
+};
+
+int test_insertion() {
+    int errors = 0;
+    {
+        xme::HashMap<int, int> map;
+        bool error = !map.empty() || map.find(5) != map.end();
+        for(int i = 0; i < 1000; ++i)
+            map.insert({i, i * 2});
+        error |= map.size() != 1000;
+        for(int i = 0; i < 1000; ++i) {
+            auto it = map.find(i);
+            error |= it == map.end() || it->first != i || it->second != i * 2;
+        }
+        error |= map.contains(1000) || map.count(999) != 1;
+        auto [it, inserted] = map.insert({5, 0});
+        error |= inserted || it->second != 10;
+        if(error) {
+            std::cerr << "xme::HashMap::insert error\n";
+            ++errors;
+        }
+    }
+    {
+        xme::HashMap<std::string, int> map;
+        map["one"] = 1;
+        map["two"] = 2;
+        ++map["one"];
+        auto [it, inserted] = map.try_emplace("two", 5);
+        bool error          = inserted || it->second != 2 || map["one"] != 2;
+        map.insert_or_assign("two", 7);
+        error |= map["two"] != 7 || map.size() != 2;
+        map.emplace("three", 3);
+        error |= map["three"] != 3;
+        if(error) {
+            std::cerr << "xme::HashMap::operator[] error\n";
+            ++errors;
+        }
+    }
+    {
+        xme::HashMap<int, MoveOnly> map;
+        for(int i = 0; i < 100; ++i)
+            map.try_emplace(i, MoveOnly(i));
+        bool error = map.find(50)->second.value != 50 || map.size() != 100;
+        if(error) {
+            std::cerr << "xme::HashMap move only error\n";
+            ++errors;
+        }
+    }
+    return errors;
+}
+
+int test_erase() {
+    int errors = 0;
+    {
+        xme::HashMap<int, int> map{{1, 1}, {2, 2}, {3, 3}};
+        bool error = map.erase(2) != 1 || map.erase(2) != 0 || map.size() != 2;
+        map.erase(map.find(1));
+        error |= map.contains(1) || !map.contains(3) || map.size() != 1;
+        if(error) {
+            std::cerr << "xme::HashMap::erase error\n";
+            ++errors;
+        }
+    }
+    {
+        xme::HashMap<int, int> map;
+        bool error = false;
+        for(int round = 0; round < 50; ++round) {
+            for(int i = 0; i < 200; ++i)
+                map[round * 1000 + i] = i;
+            for(int i = 0; i < 200; ++i)
+                error |= map.erase(round * 1000 + i) != 1;
+        }
+        error |= !map.empty() || map.capacity() > 1023;
+        if(error) {
+            std::cerr << "xme::HashMap erase and reinsert error\n";
+            ++errors;
+        }
+    }
+    return errors;
+}
+
+int test_iteration() {
+    int errors = 0;
+    {
+        xme::HashMap<int, int> map;
+        for(int i = 0; i < 64; ++i)
+            map[i] = 1;
+        int sum = 0;
+        for(auto&& [key, value] : map)
+            sum += value;
+        const auto& cmap = map;
+        int count        = 0;
+        for(auto it = cmap.begin(); it != cmap.end(); ++it)
+            ++count;
+        bool error = sum != 64 || count != 64;
+        map.clear();
+        error |= map.begin() != map.end() || !map.empty();
+        if(error) {
+            std::cerr << "xme::HashMap iteration error\n";
+            ++errors;
+        }
+    }
+    return errors;
+}
+
+int test_heterogeneous() {
+    int errors = 0;
+    {
+        xme::HashMap<std::string, int, StringHash, std::equal_to<>> map;
+        map["key"]  = 5;
+        bool error  = !map.contains(std::string_view("key")) || map.find("key")->second != 5;
+        error      |= map.erase(std::string_view("key")) != 1;
+        if(error) {
+            std::cerr << "xme::HashMap heterogeneous lookup error\n";
+            ++errors;
+        }
+    }
+    return errors;
+}
+
+int test_copy_move() {
+    int errors = 0;
+    {
+        xme::HashMap<int, std::string> map{{1, "a"}, {2, "b"}};
+        xme::HashMap<int, std::string> copy{map};
+        xme::HashMap<int, std::string> moved{std::move(map)};
+        bool error = !map.empty() || copy.size() != 2 || moved.size() != 2;
+        error |= copy[1] != "a" || moved[2] != "b";
+        map = copy;
+        error |= map.size() != 2 || map[2] != "b";
+        if(error) {
+            std::cerr << "xme::HashMap copy/move error\n";
+            ++errors;
+        }
+    }
+    return errors;
+}
+
+int test_constructors() {
+    int errors = 0;
+    {
+        using Alloc = xme::ArenaAllocator<xme::Pair<const int, int>>;
+        xme::MonotonicArena arena;
+        xme::HashMap<int, int, SeededHash, std::equal_to<int>, Alloc> map(
+          100, SeededHash{42}, std::equal_to<int>(), Alloc(arena));
+        bool error = map.capacity() < 100 || map.hash_function().seed != 42;
+        error |= !(map.get_allocator() == Alloc(arena));
+        for(int i = 0; i < 200; ++i)
+            map[i] = i * 2;
+        error |= map.size() != 200 || map[150] != 300;
+
+        xme::HashMap<int, int, SeededHash, std::equal_to<int>, Alloc> list(
+          {{1, 2}, {3, 4}}, 0, SeededHash{7}, Alloc(arena));
+        error |= list.size() != 2 || list[3] != 4 || list.hash_function().seed != 7;
+
+        xme::HashMap<int, int, SeededHash, std::equal_to<int>, Alloc> copy(
+          map.begin(), map.end(), 0, SeededHash{1}, Alloc(arena));
+        error |= copy.size() != 200 || copy[199] != 398;
+        if(error) {
+            std::cerr << "xme::HashMap constructors error\n";
+            ++errors;
+        }
+    }
+    return errors;
+}
+
+//! Throws when constructed from a negative value.
+struct ThrowingValue {
+    ThrowingValue(int v) : value(std::make_unique<int>(v)) {
+        if(v < 0)
+            throw std::runtime_error("negative");
+    }
+
+    std::unique_ptr<int> value;
+};
+
+int test_exceptions() {
+    int errors = 0;
+    {
+        xme::HashMap<int, ThrowingValue> map;
+        map.try_emplace(1, 1);
+        bool error = true;
+        try {
+            map.try_emplace(2, -1);
+        }
+        catch(const std::runtime_error&) {
+            error = false;
+        }
+        try {
+            map.insert_or_assign(3, -1);
+            error = true;
+        }
+        catch(const std::runtime_error&) {
+        }
+        error |= map.size() != 1 || map.contains(2) || *map.find(1)->second.value != 1;
+        map.try_emplace(2, 2);
+        error |= map.size() != 2 || *map.find(2)->second.value != 2;
+        if(error) {
+            std::cerr << "xme::HashMap exception error\n";
+            ++errors;
+        }
+    }
+    return errors;
+}
+
+int main() {
+    int errors = 0;
+    errors += test_insertion();
+    errors += test_erase();
+    errors += test_iteration();
+    errors += test_heterogeneous();
+    errors += test_copy_move();
+    errors += test_constructors();
+    errors += test_exceptions();
+    return errors;
+}
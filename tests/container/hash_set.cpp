@@ -0,0 +1,34 @@
+#include <iostream>
+#include <string>
+#include <xme/container/hash_set.hpp>
+
+int test_insertion() {
+    int errors = 0;
+    {
+        xme::HashSet<int> set;
+        for(int i = 0; i < 500; ++i)
+            set.insert(i % 250);
+        bool error = set.size() != 250 || !set.contains(249) || set.contains(250);
+        if(error) {
+            std::cerr << "xme::HashSet::insert error\n";
+            ++errors;
+        }
+    }
+    {
+        xme::HashSet<std::string> set{"a", "b", "c"};
+        auto [it, inserted] = set.emplace("d");
+        bool error          = !inserted || *it != "d" || set.size() != 4;
+        error |= set.erase("a") != 1 || set.contains("a");
+        if(error) {
+            std::cerr << "xme::HashSet::emplace error\n";
+            ++errors;
+        }
+    }
+    return errors;
+}
+
+int main() {
+    int errors = 0;
+    errors += test_insertion();
+    return errors;
+}
@@ -0,0 +1,109 @@
+#include <iostream>
+#include <xme/container/intrusive_list.hpp>
+
+struct Timer : xme::IntrusiveListHook {
+    int deadline = 0;
+};
+
+struct Connection {
+    int id = 0;
+    xme::IntrusiveListHook active;
+    xme::IntrusiveListHook idle;
+};
+
+int test_base_hook() {
+    int errors = 0;
+    Timer timers[8];
+    {
+        xme::IntrusiveList<Timer> list;
+        for(int i = 0; i < 8; ++i) {
+            timers[i].deadline = i;
+            list.push_back(timers[i]);
+        }
+        bool error = list.size() != 8 || list.front().deadline != 0 || list.back().deadline != 7;
+        list.remove(timers[3]);
+        error |= timers[3].is_linked() || list.size() != 7;
+        error |= &*xme::IntrusiveList<Timer>::iterator_to(timers[4]) != &timers[4];
+        int expected = 0;
+        for(const Timer& timer : list) {
+            if(expected == 3)
+                ++expected;
+            error |= timer.deadline != expected++;
+        }
+        list.reverse();
+        error |= list.front().deadline != 7 || list.back().deadline != 0;
+        error |= list.remove_if([](const Timer& timer) { return timer.deadline % 2 == 0; }) != 4;
+        error |= list.size() != 3 || (--list.end())->deadline != 1;
+        list.pop_front();
+        list.pop_back();
+        error |= list.size() != 1 || timers[7].is_linked() || !timers[5].is_linked();
+        if(error) {
+            std::cerr << "xme::IntrusiveList base hook error\n";
+            ++errors;
+        }
+    }
+    for(const Timer& timer : timers) {
+        if(timer.is_linked()) {
+            std::cerr << "xme::IntrusiveList::~IntrusiveList error\n";
+            ++errors;
+            break;
+        }
+    }
+    return errors;
+}
+
+int test_member_hook() {
+    int errors = 0;
+    Connection connections[4];
+    xme::IntrusiveList<Connection, xme::MemberHook<&Connection::active>> active;
+    xme::IntrusiveList<Connection, xme::MemberHook<&Connection::idle>> idle;
+    for(int i = 0; i < 4; ++i) {
+        connections[i].id = i;
+        active.push_back(connections[i]);
+        if(i % 2 == 0)
+            idle.push_front(connections[i]);
+    }
+    bool error = active.size() != 4 || idle.size() != 2 || idle.front().id != 2;
+    idle.remove(connections[2]);
+    error |= active.size() != 4 || idle.front().id != 0 || connections[2].idle.is_linked();
+    error |= !connections[2].active.is_linked();
+
+    auto it = active.erase(decltype(active)::iterator_to(connections[1]));
+    error |= it->id != 2 || active.size() != 3;
+    if(error) {
+        std::cerr << "xme::IntrusiveList member hook error\n";
+        ++errors;
+    }
+    return errors;
+}
+
+int test_splice() {
+    int errors = 0;
+    Timer timers[6];
+    xme::IntrusiveList<Timer> lhs;
+    xme::IntrusiveList<Timer> rhs;
+    for(int i = 0; i < 6; ++i) {
+        timers[i].deadline = i;
+        (i < 3 ? lhs : rhs).push_back(timers[i]);
+    }
+    lhs.splice(lhs.end(), rhs, decltype(rhs)::iterator_to(timers[4]));
+    bool error = lhs.size() != 4 || rhs.size() != 2 || lhs.back().deadline != 4;
+    lhs.splice(lhs.begin(), rhs);
+    error |= lhs.size() != 6 || !rhs.empty() || lhs.front().deadline != 3;
+
+    xme::IntrusiveList<Timer> moved{std::move(lhs)};
+    error |= moved.size() != 6 || !lhs.empty() || moved.back().deadline != 4;
+    if(error) {
+        std::cerr << "xme::IntrusiveList::splice error\n";
+        ++errors;
+    }
+    return errors;
+}
+
+int main() {
+    int errors = 0;
+    errors += test_base_hook();
+    errors += test_member_hook();
+    errors += test_splice();
+    return errors;
+}
@@ -0,0 +1,71 @@
+#include <iostream>
+#include <xme/container/intrusive_slist.hpp>
+
+struct Task : xme::IntrusiveSListHook {
+    int id = 0;
+};
+
+struct Job {
+    int id = 0;
+    xme::IntrusiveSListHook hook;
+};
+
+int test_base_hook() {
+    int errors = 0;
+    Task tasks[6];
+    xme::IntrusiveSList<Task> list;
+    for(int i = 0; i < 6; ++i) {
+        tasks[i].id = i;
+        list.push_front(tasks[i]);
+    }
+    bool error = list.size() != 6 || list.front().id != 5;
+    list.reverse();
+    int expected = 0;
+    for(const Task& task : list)
+        error |= task.id != expected++;
+
+    auto it = list.erase_after(xme::IntrusiveSList<Task>::iterator_to(tasks[1]));
+    error |= it->id != 3 || list.size() != 5 || tasks[2].next != nullptr;
+    list.insert_after(list.before_begin(), tasks[2]);
+    error |= list.front().id != 2;
+    error |= list.remove_if([](const Task& task) { return task.id % 2 == 1; }) != 3;
+    error |= list.size() != 3 || list.front().id != 2;
+    list.pop_front();
+    error |= list.front().id != 0;
+    if(error) {
+        std::cerr << "xme::IntrusiveSList base hook error\n";
+        ++errors;
+    }
+    return errors;
+}
+
+int test_member_hook() {
+    int errors = 0;
+    Job jobs[4];
+    xme::IntrusiveSList<Job, xme::MemberHook<&Job::hook>> lhs;
+    xme::IntrusiveSList<Job, xme::MemberHook<&Job::hook>> rhs;
+    for(int i = 0; i < 4; ++i) {
+        jobs[i].id = i;
+        (i < 2 ? lhs : rhs).push_front(jobs[i]);
+    }
+    lhs.splice_after(lhs.before_begin(), rhs, rhs.before_begin());
+    bool error = lhs.size() != 3 || rhs.size() != 1 || lhs.front().id != 3;
+    lhs.splice_after(decltype(lhs)::iterator_to(jobs[0]), rhs);
+    error |= lhs.size() != 4 || !rhs.empty();
+    const int order[] = {3, 1, 0, 2};
+    int i             = 0;
+    for(const Job& job : lhs)
+        error |= job.id != order[i++];
+    if(error) {
+        std::cerr << "xme::IntrusiveSList member hook error\n";
+        ++errors;
+    }
+    return errors;
+}
+
+int main() {
+    int errors = 0;
+    errors += test_base_hook();
+    errors += test_member_hook();
+    return errors;
+}
@@ -1,7 +1,10 @@
 #include <xme/container/linked_list.hpp>
+#include <xme/core/memory/pool_allocator.hpp>
 #include <iostream>
 #include <vector>
 #include <forward_list>
+#include <random>
+#include <string>
 
 int test_access() {
     int errors = 0;
@@ -239,6 +242,172 @@ int test_operations() {
     return errors;
 }
 
+int test_sort_merge() {
+    int errors = 0;
+    {
+        std::mt19937 rng(7);
+        std::vector<std::pair<int, int>> values;
+        for(int i = 0; i < 1000; ++i)
+            values.emplace_back(int(rng() % 50), i);
+        xme::LinkedList<std::pair<int, int>, std::allocator<std::pair<int, int>>, true> l(values);
+        auto by_key = [](const auto& lhs, const auto& rhs) { return lhs.first < rhs.first; };
+        l.sort(by_key);
+        std::ranges::stable_sort(values, by_key);
+        bool error = !std::ranges::equal(l, values) || l.size() != 1000;
+
+        xme::LinkedList<int> empty;
+        empty.sort();
+        xme::LinkedList<int> single{1};
+        single.sort();
+        error |= !empty.is_empty() || single.front() != 1;
+        if(error) {
+            std::cerr << "xme::LinkedList::sort error\n";
+            ++errors;
+        }
+    }
+    {
+        xme::LinkedList<int, std::allocator<int>, true> lhs{1, 3, 5, 7};
+        xme::LinkedList<int, std::allocator<int>, true> rhs{0, 3, 4, 8, 9};
+        const int* three = &*std::next(rhs.begin());
+        lhs.merge(rhs);
+        std::vector<int> expected{0, 1, 3, 3, 4, 5, 7, 8, 9};
+        bool error = !std::ranges::equal(lhs, expected) || lhs.size() != 9 || rhs.size() != 0;
+        error |= !rhs.is_empty() || &*std::next(lhs.begin(), 3) != three;
+        lhs.merge(xme::LinkedList<int, std::allocator<int>, true>{10}, std::less<>{});
+        error |= lhs.size() != 10;
+        if(error) {
+            std::cerr << "xme::LinkedList::merge error\n";
+            ++errors;
+        }
+    }
+    return errors;
+}
+
+int test_splice() {
+    int errors = 0;
+    using list_t = xme::LinkedList<int, std::allocator<int>, true>;
+    {
+        list_t lhs{1, 2, 3};
+        list_t rhs{4, 5, 6, 7};
+        lhs.splice_after(lhs.begin(), rhs, rhs.begin());
+        bool error = !std::ranges::equal(lhs, std::vector{1, 5, 2, 3}) || lhs.size() != 4;
+        error |= !std::ranges::equal(rhs, std::vector{4, 6, 7}) || rhs.size() != 3;
+
+        lhs.splice_after(lhs.before_begin(), rhs, rhs.before_begin(), std::next(rhs.begin(), 2));
+        error |= !std::ranges::equal(lhs, std::vector{4, 6, 1, 5, 2, 3}) || lhs.size() != 6;
+        error |= rhs.size() != 1 || rhs.front() != 7;
+
+        lhs.splice_after(std::next(lhs.begin(), 5), rhs);
+        error |= !std::ranges::equal(lhs, std::vector{4, 6, 1, 5, 2, 3, 7}) || lhs.size() != 7;
+        error |= !rhs.is_empty() || rhs.size() != 0;
+
+        lhs.splice_after(lhs.before_begin(), lhs, std::next(lhs.begin(), 5));
+        error |= !std::ranges::equal(lhs, std::vector{7, 4, 6, 1, 5, 2, 3}) || lhs.size() != 7;
+        if(error) {
+            std::cerr << "xme::LinkedList::splice_after error\n";
+            ++errors;
+        }
+    }
+    return errors;
+}
+
+int test_remove_unique() {
+    int errors = 0;
+    {
+        xme::LinkedList<std::string, std::allocator<std::string>, true> l{"a", "b", "a", "c", "a"};
+        bool error = l.remove("a") != 3 || l.size() != 2;
+        error |= !std::ranges::equal(l, std::vector<std::string>{"b", "c"});
+        error |= l.remove_if([](const std::string&) { return true; }) != 2 || !l.is_empty();
+        if(error) {
+            std::cerr << "xme::LinkedList::remove_if error\n";
+            ++errors;
+        }
+    }
+    {
+        // The value is the first of the erased elements
+        xme::LinkedList<std::string, std::allocator<std::string>, true> l{
+          "long string not in SSO", "b", "long string not in SSO", "c"};
+        bool error = l.remove(l.front()) != 2 || l.size() != 2;
+        error |= !std::ranges::equal(l, std::vector<std::string>{"b", "c"});
+        if(error) {
+            std::cerr << "xme::LinkedList::remove aliasing error\n";
+            ++errors;
+        }
+    }
+    {
+        xme::LinkedList<int, std::allocator<int>, true> l{1, 1, 2, 2, 2, 3, 1, 1};
+        bool error = l.unique() != 4 || l.size() != 4;
+        error |= !std::ranges::equal(l, std::vector{1, 2, 3, 1});
+        error |= l.unique([](int lhs, int rhs) { return lhs + 1 == rhs; }) != 1;
+        error |= !std::ranges::equal(l, std::vector{1, 3, 1}) || l.size() != 3;
+        if(error) {
+            std::cerr << "xme::LinkedList::unique error\n";
+            ++errors;
+        }
+    }
+    return errors;
+}
+
+int test_prefetch_compact() {
+    int errors = 0;
+    {
+        const xme::LinkedList<int> l{1, 2, 3, 4, 5};
+        std::vector<int> visited;
+        l.for_each_prefetch([&visited](int value) { visited.push_back(value); }, 2);
+        bool error = visited != std::vector{1, 2, 3, 4, 5};
+        error |= !std::ranges::equal(l.prefetched(16), visited);
+        error |= !std::ranges::equal(l.prefetched(0), visited);
+        error |= xme::LinkedList<int>{}.prefetched().begin() != std::default_sentinel;
+        if(error) {
+            std::cerr << "xme::LinkedList::for_each_prefetch error\n";
+            ++errors;
+        }
+    }
+    {
+        std::vector<std::string> values;
+        for(int i = 0; i < 200; ++i)
+            values.push_back(std::to_string(i * 7919 % 200));
+        xme::LinkedList<std::string, std::allocator<std::string>, true> l{values};
+        l.sort();
+        std::ranges::sort(values);
+        l.compact();
+        bool error = !std::ranges::equal(l, values) || l.size() != 200;
+        // Every node follows the previous one in memory.
+        for(auto prev = l.begin(), curr = std::next(prev); curr != l.end(); ++prev, ++curr)
+            error |= std::less<>{}(curr.current_node, prev.current_node);
+        if(error) {
+            std::cerr << "xme::LinkedList::compact error\n";
+            ++errors;
+        }
+    }
+    return errors;
+}
+
+int test_pool_allocator() {
+    int errors = 0;
+    {
+        std::vector<std::string> values{"a", "b", "c", "d"};
+        xme::LinkedList<std::string, xme::PoolAllocator<std::string>> l(values);
+        auto first  = &*l.begin();
+        auto second = &*std::next(l.begin());
+        bool error  = reinterpret_cast<const char*>(second) - reinterpret_cast<const char*>(first)
+                     != sizeof(xme::detail::LinkedListNode<std::string>);
+        l.pop_front();
+        l.push_front("e");
+        error |= &l.front() != first || l.front() != "e";
+
+        xme::LinkedList<std::string, xme::PoolAllocator<std::string>> moved(std::move(l));
+        moved.insert_after(moved.begin(), values);
+        std::vector<std::string> expected{"e", "a", "b", "c", "d", "b", "c", "d"};
+        error |= !std::ranges::equal(moved, expected);
+        if(error) {
+            std::cerr << "xme::LinkedList PoolAllocator error\n";
+            ++errors;
+        }
+    }
+    return errors;
+}
+
 int main() {
     int errors = 0;
     errors += test_access();
@@ -246,5 +415,10 @@ int main() {
     errors += test_erase();
     errors += test_copy_move();
     errors += test_operations();
+    errors += test_sort_merge();
+    errors += test_splice();
+    errors += test_remove_unique();
+    errors += test_prefetch_compact();
+    errors += test_pool_allocator();
     return errors;
 }
@@ -0,0 +1,82 @@
+#include <atomic>
+#include <iostream>
+#include <thread>
+#include <vector>
+#include <xme/container/lock_free_stack.hpp>
+
+struct Block : xme::LinkedListHook {
+    int owner = -1;
+};
+
+int test_push_pop() {
+    int errors = 0;
+    Block blocks[4];
+    xme::LockFreeStack<Block> stack;
+    bool error = !stack.empty() || stack.pop() != nullptr;
+    for(Block& block : blocks)
+        stack.push(block);
+    error |= stack.empty() || stack.pop() != &blocks[3] || stack.pop() != &blocks[2];
+    stack.push(blocks[3]);
+    error |= stack.pop() != &blocks[3];
+
+    Block* all = stack.pop_all();
+    error |= all != &blocks[1] || all->next != &blocks[0] || !stack.empty();
+
+    blocks[2].next = &blocks[3];
+    stack.push_chain(blocks[2], blocks[3]);
+    error |= stack.pop() != &blocks[2] || stack.pop() != &blocks[3] || stack.pop() != nullptr;
+    if(error) {
+        std::cerr << "xme::LockFreeStack push and pop error\n";
+        ++errors;
+    }
+    return errors;
+}
+
+//! Threads take blocks from a shared free list and give them back,
+//! a block taken by two threads at once would be claimed twice.
+int test_concurrent() {
+    int errors = 0;
+    constexpr int threads    = 8;
+    constexpr int iterations = 100000;
+
+    std::vector<Block> blocks(64);
+    xme::LockFreeStack<Block> free_list;
+    for(Block& block : blocks)
+        free_list.push(block);
+
+    std::atomic<bool> error = false;
+    std::vector<std::thread> workers;
+    for(int t = 0; t < threads; ++t) {
+        workers.emplace_back([&, t] {
+            for(int i = 0; i < iterations; ++i) {
+                Block* block = free_list.pop();
+                if(block == nullptr)
+                    continue;
+                std::atomic_ref<int> owner(block->owner);
+                int expected = -1;
+                if(!owner.compare_exchange_strong(expected, t))
+                    error = true;
+                owner.store(-1);
+                free_list.push(*block);
+            }
+        });
+    }
+    for(std::thread& worker : workers)
+        worker.join();
+
+    std::size_t count = 0;
+    while(free_list.pop())
+        ++count;
+    if(error || count != blocks.size()) {
+        std::cerr << "xme::LockFreeStack concurrent error\n";
+        ++errors;
+    }
+    return errors;
+}
+
+int main() {
+    int errors = 0;
+    errors += test_push_pop();
+    errors += test_concurrent();
+    return errors;
+}
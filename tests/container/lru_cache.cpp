@@ -0,0 +1,84 @@
+#include <iostream>
+#include <string>
+#include <xme/container/lru_cache.hpp>
+
+struct ByteWeigher {
+    auto operator()(const std::string& key, const std::string& value) const -> std::size_t {
+        return key.size() + value.size();
+    }
+};
+
+int test_entries() {
+    int errors = 0;
+    xme::LRUCache<int, std::string> cache(3);
+    cache.put(1, "one");
+    cache.put(2, "two");
+    cache.put(3, "three");
+    bool error = cache.size() != 3 || cache.get(4) != nullptr;
+
+    std::string* one = cache.get(1);
+    error |= one == nullptr || *one != "one";
+    // 2 is the least recently used, since 1 was read after it.
+    cache.put(4, "four");
+    error |= cache.contains(2) || cache.size() != 3 || cache.weight() != 3;
+    error |= cache.get(1) != one;
+
+    // peek does not change the order, so 3 is evicted before 1.
+    error |= cache.peek(3) == nullptr || *cache.peek(3) != "three";
+    cache.put(5, "five");
+    error |= cache.contains(3) || !cache.contains(1);
+
+    std::string* assigned = cache.put(4, "FOUR");
+    error |= assigned == nullptr || *assigned != "FOUR" || cache.size() != 3;
+    int expected[] = {4, 5, 1};
+    int i          = 0;
+    for(const auto& [key, value] : cache)
+        error |= key != expected[i++];
+
+    error |= !cache.erase(5) || cache.erase(5) || cache.size() != 2;
+    cache.set_capacity(1);
+    error |= cache.size() != 1 || !cache.contains(4);
+    cache.clear();
+    error |= !cache.is_empty() || cache.weight() != 0;
+    if(error) {
+        std::cerr << "xme::LRUCache entry capacity error\n";
+        ++errors;
+    }
+    return errors;
+}
+
+int test_bytes() {
+    int errors = 0;
+    xme::LRUCache<std::string, std::string, ByteWeigher> cache(16);
+    cache.put("a", "1234567");
+    cache.put("b", "1234567");
+    bool error = cache.weight() != 16 || cache.size() != 2;
+    // 16 bytes leave no room, so both entries are evicted.
+    cache.put("c", "123456789abcdef");
+    error |= cache.weight() != 16 || cache.size() != 1 || !cache.contains("c");
+    // Too heavy for the whole cache.
+    error |= cache.put("d", std::string(16, 'x')) != nullptr || cache.contains("d");
+    error |= !cache.contains("c");
+
+    cache.put("a", "1");
+    cache.put("c", "1234567");
+    error |= cache.weight() != 10 || cache.size() != 2 || *cache.get("c") != "1234567";
+    // Growing a value evicts the other entries.
+    cache.put("c", "123456789abcdef");
+    error |= cache.size() != 1 || cache.weight() != 16 || cache.contains("a");
+
+    xme::LRUCache<std::string, std::string, ByteWeigher> moved{std::move(cache)};
+    error |= moved.size() != 1 || moved.weight() != 16 || *moved.get("c") != "123456789abcdef";
+    if(error) {
+        std::cerr << "xme::LRUCache byte capacity error\n";
+        ++errors;
+    }
+    return errors;
+}
+
+int main() {
+    int errors = 0;
+    errors += test_entries();
+    errors += test_bytes();
+    return errors;
+}
@@ -0,0 +1,95 @@
+#include <filesystem>
+#include <iostream>
+#include <system_error>
+#include <xme/container/mapped_array.hpp>
+
+struct Record {
+    int id;
+    double value;
+};
+
+auto temporary_path() -> std::filesystem::path {
+    return std::filesystem::temp_directory_path() / "xme_mapped_array_test.bin";
+}
+
+int test_append() {
+    int errors = 0;
+    std::filesystem::remove(temporary_path());
+    {
+        xme::MappedArray<Record> array(temporary_path());
+        for(int i = 0; i < 10000; ++i)
+            array.push_back({i, i * 0.5});
+        bool error = !array.is_open() || array.size() != 10000 || array.capacity() < 10000;
+        error |= array[9999].id != 9999 || array.view().size() != 10000;
+        error |= !array.flush() || !array.advise(xme::MapAdvice::sequential);
+        if(error) {
+            std::cerr << "xme::MappedArray::push_back error\n";
+            ++errors;
+        }
+    }
+    bool error = std::filesystem::file_size(temporary_path()) != 10000 * sizeof(Record);
+    if(error) {
+        std::cerr << "xme::MappedArray::close error\n";
+        ++errors;
+    }
+    return errors;
+}
+
+int test_reopen() {
+    int errors = 0;
+    {
+        xme::MappedArray<Record> array(temporary_path(), xme::MapMode::read_only);
+        bool error = !array.is_open() || array.size() != 10000;
+        for(int i = 0; i < 10000; ++i)
+            error |= array[i].id != i || array[i].value != i * 0.5;
+        if(error) {
+            std::cerr << "xme::MappedArray::open error\n";
+            ++errors;
+        }
+    }
+    {
+        xme::MappedArray<Record> array(temporary_path());
+        array.resize(5);
+        array.emplace_back(5, 2.5);
+        Record records[]{{6, 3.0}, {7, 3.5}};
+        array.append_range(records);
+        bool error = array.size() != 8 || array.back().id != 7 || array[4].id != 4;
+        if(error) {
+            std::cerr << "xme::MappedArray::append_range error\n";
+            ++errors;
+        }
+    }
+    {
+        xme::MappedArray<char> array;
+        bool error = array.open(temporary_path()) == false || array.size() != 8 * sizeof(Record);
+        error |= !xme::MappedArray<Record>().open(temporary_path());
+        error |= xme::MappedArray<int[3]>().open(temporary_path());
+        try {
+            xme::MappedArray<int[3]> mismatched(temporary_path());
+            error = true;
+        }
+        catch(const std::system_error& e) {
+            error |= e.code() != std::errc::invalid_argument;
+        }
+        try {
+            xme::MappedArray<char> missing("/nonexistent/xme", xme::MapMode::read_only);
+            error = true;
+        }
+        catch(const std::system_error& e) {
+            error |= e.code() != std::errc::no_such_file_or_directory;
+        }
+        if(error) {
+            std::cerr << "xme::MappedArray::open size error\n";
+            ++errors;
+        }
+    }
+    std::filesystem::remove(temporary_path());
+    return errors;
+}
+
+int main() {
+    int errors = 0;
+    errors += test_append();
+    errors += test_reopen();
+    return errors;
+}
@@ -0,0 +1,75 @@
+#include <iostream>
+#include <thread>
+#include <vector>
+#include <xme/container/mpsc_queue.hpp>
+
+struct Wakeup : xme::LinkedListHook {
+    int producer = 0;
+    int sequence = 0;
+};
+
+int test_push_pop() {
+    int errors = 0;
+    Wakeup wakeups[3];
+    xme::MPSCQueue<Wakeup> queue;
+    bool error = !queue.empty() || queue.pop() != nullptr;
+    for(Wakeup& wakeup : wakeups)
+        queue.push(wakeup);
+    error |= queue.empty() || queue.pop() != &wakeups[0] || queue.pop() != &wakeups[1];
+    queue.push(wakeups[0]);
+    error |= queue.pop() != &wakeups[2] || queue.pop() != &wakeups[0];
+    error |= queue.pop() != nullptr || !queue.empty();
+    queue.push(wakeups[1]);
+    error |= queue.pop() != &wakeups[1];
+    if(error) {
+        std::cerr << "xme::MPSCQueue push and pop error\n";
+        ++errors;
+    }
+    return errors;
+}
+
+//! Every producer pushes its own nodes in order, the consumer checks that
+//! each producer's nodes arrive in that order and that none is lost.
+int test_concurrent() {
+    int errors = 0;
+    constexpr int producers = 6;
+    constexpr int per_item  = 20000;
+
+    std::vector<std::vector<Wakeup>> wakeups(producers, std::vector<Wakeup>(per_item));
+    xme::MPSCQueue<Wakeup> queue;
+    std::vector<std::thread> threads;
+    for(int p = 0; p < producers; ++p) {
+        threads.emplace_back([&, p] {
+            for(int i = 0; i < per_item; ++i) {
+                wakeups[p][i].producer = p;
+                wakeups[p][i].sequence = i;
+                queue.push(wakeups[p][i]);
+            }
+        });
+    }
+
+    bool error = false;
+    std::vector<int> next(producers, 0);
+    for(int received = 0; received < producers * per_item;) {
+        Wakeup* wakeup = queue.pop();
+        if(wakeup == nullptr)
+            continue;
+        error |= wakeup->sequence != next[wakeup->producer]++;
+        ++received;
+    }
+    for(std::thread& thread : threads)
+        thread.join();
+    error |= queue.pop() != nullptr;
+    if(error) {
+        std::cerr << "xme::MPSCQueue concurrent error\n";
+        ++errors;
+    }
+    return errors;
+}
+
+int main() {
+    int errors = 0;
+    errors += test_push_pop();
+    errors += test_concurrent();
+    return errors;
+}
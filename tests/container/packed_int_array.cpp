@@ -0,0 +1,118 @@
+#include <xme/container/packed_int_array.hpp>
+#include <cstdint>
+#include <iostream>
+#include <random>
+#include <vector>
+
+static_assert(xme::PackedIntArray<>::width_for(0) == 1);
+static_assert(xme::PackedIntArray<>::width_for(255) == 8);
+static_assert(xme::PackedIntArray<>::width_for(~std::uint64_t(0)) == 64);
+
+//! Every width with values that use all of their bits, so each value crosses words at
+//! some point, checked through get, both unpacks, from every start modulo 8.
+int test_widths() {
+    int errors = 0;
+    std::mt19937_64 rng(7);
+    bool error = false;
+    for(unsigned width = 1; width <= 64; ++width) {
+        xme::PackedIntArray<> packed(width);
+        std::vector<std::uint64_t> values(300);
+        for(std::uint64_t& value : values) {
+            value = rng() & packed.max_value();
+            packed.push_back(value);
+        }
+        packed.set(3, packed.max_value());
+        values[3] = packed.max_value();
+        error |= packed.size() != values.size() || packed.width() != width;
+        error |= packed.words().size() != (values.size() * width + 63) / 64 + 1;
+        for(std::size_t i = 0; i < values.size(); ++i)
+            error |= packed[i] != values[i];
+
+        for(std::size_t first = 0; first < 9; ++first) {
+            std::vector<std::uint64_t> wide(values.size() - first);
+            packed.unpack(first, xme::ArrayView(wide));
+            error |= !std::equal(wide.begin(), wide.end(), values.begin() + first);
+            if(width <= 32) {
+                std::vector<std::uint32_t> narrow(values.size() - first);
+                packed.unpack(first, xme::ArrayView(narrow));
+                error |= !std::equal(narrow.begin(), narrow.end(), values.begin() + first);
+            }
+        }
+        if(error) {
+            std::cerr << "xme::PackedIntArray width " << width << " error\n";
+            return 1;
+        }
+    }
+    return errors;
+}
+
+int test_modifiers() {
+    int errors = 0;
+    xme::PackedIntArray<> packed(5, 10, 31);
+    bool error = packed.size() != 10 || packed[9] != 31 || packed.capacity() < 10;
+    packed.resize(20, 7);
+    error |= packed[9] != 31 || packed[10] != 7 || packed[19] != 7;
+    packed.resize(3);
+    packed.push_back(1);
+    error |= packed.size() != 4 || packed[3] != 1;
+    packed.pop_back();
+
+    // Values removed by resize and pop_back leave no bits behind
+    xme::PackedIntArray<> same(5, 3, 31);
+    error |= !(packed == same);
+    packed.clear();
+    error |= !packed.empty() || packed.words().size() != 0;
+    if(error) {
+        std::cerr << "xme::PackedIntArray modifiers error\n";
+        ++errors;
+    }
+    return errors;
+}
+
+int test_encodings() {
+    int errors = 0;
+    std::vector<std::int64_t> timestamps;
+    std::int64_t time = 1'700'000'000'000;
+    for(int i = 0; i < 1000; ++i) {
+        time += i % 17 == 0 ? -3 : i % 5;
+        timestamps.push_back(time);
+    }
+
+    xme::FrameOfReference<> frame(timestamps);
+    bool error = frame.size() != timestamps.size() || frame.offsets().width() > 12;
+    error |= frame[0] != timestamps[0] || frame[999] != timestamps[999];
+    std::vector<std::int64_t> decoded(990);
+    frame.decode(10, xme::ArrayView(decoded));
+    error |= !std::equal(decoded.begin(), decoded.end(), timestamps.begin() + 10);
+
+    xme::DeltaEncoding<> delta(timestamps);
+    error |= delta.size() != timestamps.size() || delta.deltas().width() != 4;
+    error |= delta.first() != timestamps[0];
+    decoded.resize(timestamps.size());
+    delta.decode(xme::ArrayView(decoded));
+    error |= decoded != timestamps;
+
+    const std::vector<std::int64_t> extremes{INT64_MIN, INT64_MAX, 0, -1};
+    xme::FrameOfReference<> wide(extremes);
+    xme::DeltaEncoding<> jumps(extremes);
+    decoded.resize(extremes.size());
+    jumps.decode(xme::ArrayView(decoded));
+    error |= wide.offsets().width() != 64 || wide[0] != INT64_MIN || wide[1] != INT64_MAX;
+    error |= decoded != extremes;
+
+    xme::DeltaEncoding<> empty(xme::ArrayView<const std::int64_t>{});
+    error |= empty.size() != 0 || xme::FrameOfReference<>().size() != 0;
+    if(error) {
+        std::cerr << "xme::FrameOfReference and xme::DeltaEncoding error\n";
+        ++errors;
+    }
+    return errors;
+}
+
+int main() {
+    int errors = 0;
+    errors += test_widths();
+    errors += test_modifiers();
+    errors += test_encodings();
+    return errors;
+}
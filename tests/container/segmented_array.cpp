@@ -0,0 +1,134 @@
+#include <array>
+#include <atomic>
+#include <iostream>
+#include <thread>
+#include <vector>
+#include <xme/container/segmented_array.hpp>
+#include <xme/core/memory/pool_allocator.hpp>
+
+int test_access() {
+    int errors = 0;
+    {
+        xme::SegmentedArray<int, 2> arr{5, 3, 2, 7, 1};
+        bool error = arr[0] != 5 || arr[1] != 3 || arr[2] != 2 || arr[3] != 7 || arr[4] != 1;
+        error |= arr.front() != 5 || arr.back() != 1 || arr.size() != 5 || arr.capacity() != 6;
+        if(error) {
+            std::cerr << "xme::SegmentedArray::operator[] error\n";
+            ++errors;
+        }
+    }
+    {
+        std::array<int, 5> a{1, 2, 3, 4, 5};
+        xme::SegmentedArray<int, 4> arr{a};
+        auto it    = arr.cbegin();
+        bool error = *(it++) != 1 || *(it++) != 2;
+        error |= it[2] != 5 || (arr.end() - arr.begin()) != 5 || *(arr.end() - 1) != 5;
+        error |= *arr.rbegin() != 5;
+        int sum = 0;
+        for(int v : arr)
+            sum += v;
+        error |= sum != 15;
+        if(error) {
+            std::cerr << "xme::SegmentedArray iterator error\n";
+            ++errors;
+        }
+    }
+    return errors;
+}
+
+int test_stable_address() {
+    int errors = 0;
+    {
+        xme::SegmentedArray<int, 4> arr;
+        arr.push_back(10);
+        int* first = &arr[0];
+        for(int i = 0; i < 1000; ++i)
+            arr.emplace_back(i);
+        bool error = first != &arr[0] || *first != 10 || arr.size() != 1001 || arr[1000] != 999;
+        if(error) {
+            std::cerr << "xme::SegmentedArray stable address error\n";
+            ++errors;
+        }
+    }
+    {
+        // The chunk table is allocated through an allocator rebound from a pool allocator
+        xme::SegmentedArray<int, 4, xme::PoolAllocator<int>> arr;
+        for(int i = 0; i < 1000; ++i)
+            arr.push_back(i);
+        if(arr.size() != 1000 || arr[0] != 0 || arr[999] != 999) {
+            std::cerr << "xme::SegmentedArray pool allocator error\n";
+            ++errors;
+        }
+    }
+    return errors;
+}
+
+int test_modifiers() {
+    int errors = 0;
+    {
+        xme::SegmentedArray<int, 2> arr{1, 2, 3};
+        arr.pop_back();
+        bool error = arr.size() != 2 || arr.back() != 2;
+        arr.clear();
+        error |= !arr.empty() || arr.capacity() != 4;
+        arr.reserve(9);
+        error |= arr.capacity() != 10;
+        if(error) {
+            std::cerr << "xme::SegmentedArray modifiers error\n";
+            ++errors;
+        }
+    }
+    {
+        xme::SegmentedArray<int, 2> arr1{1, 2, 3};
+        xme::SegmentedArray<int, 2> arr2{arr1};
+        xme::SegmentedArray<int, 2> arr3{std::move(arr1)};
+        bool error = !arr1.empty() || arr2.size() != 3 || arr3.size() != 3;
+        error |= arr2[2] != 3 || arr3[2] != 3;
+        arr1 = arr2;
+        error |= arr1.size() != 3 || arr1[0] != 1;
+        if(error) {
+            std::cerr << "xme::SegmentedArray copy/move error\n";
+            ++errors;
+        }
+    }
+    return errors;
+}
+
+int test_concurrency() {
+    int errors = 0;
+    xme::SegmentedArray<std::size_t, 16> arr;
+    std::atomic<bool> done  = false;
+    std::atomic<bool> error = false;
+
+    std::vector<std::thread> readers;
+    for(int t = 0; t < 2; ++t) {
+        readers.emplace_back([&] {
+            while(!done.load(std::memory_order_acquire)) {
+                const std::size_t size = arr.size();
+                for(std::size_t i = 0; i < size; ++i)
+                    if(arr[i] != i)
+                        error = true;
+            }
+        });
+    }
+    for(std::size_t i = 0; i < 20'000; ++i)
+        arr.push_back(i);
+    done = true;
+    for(auto& reader : readers)
+        reader.join();
+
+    if(error || arr.size() != 20'000) {
+        std::cerr << "xme::SegmentedArray concurrent read error\n";
+        ++errors;
+    }
+    return errors;
+}
+
+int main() {
+    int errors = 0;
+    errors += test_access();
+    errors += test_stable_address();
+    errors += test_modifiers();
+    errors += test_concurrency();
+    return errors;
+}
@@ -0,0 +1,157 @@
+#include <cstdint>
+#include <iostream>
+#include <memory>
+#include <ranges>
+#include <stdexcept>
+#include <string>
+#include <xme/container/soa_array.hpp>
+
+int test_access() {
+    int errors = 0;
+    {
+        xme::SoAArray<int, float> arr{{1, 0.5f}, {2, 1.5f}};
+        auto [i, f] = arr[1];
+        bool error  = i != 2 || f != 1.5f || arr.size() != 2;
+        error |= get<0>(arr.front()) != 1 || get<1>(arr.back()) != 1.5f;
+        if(error) {
+            std::cerr << "xme::SoAArray::operator[] error\n";
+            ++errors;
+        }
+    }
+    {
+        xme::SoAArray<int, double> arr;
+        arr.emplace_back(3, 0.25);
+        arr[0]     = xme::Tuple{5, 2.0};
+        get<0>(arr[0]) += 1;
+        bool error = get<0>(arr[0]) != 6 || get<1>(arr[0]) != 2.0;
+        if(error) {
+            std::cerr << "xme::SoAArray proxy reference error\n";
+            ++errors;
+        }
+    }
+    {
+        xme::SoAArray<int, float> arr{{1, 0.5f}, {2, 1.5f}, {3, 2.5f}};
+        int sum = 0;
+        for(auto [i, f] : arr)
+            sum += i;
+        bool error = sum != 6 || arr.end() - arr.begin() != 3;
+        error |= get<1>(*(arr.cbegin() + 2)) != 2.5f;
+        error |= !std::random_access_iterator<decltype(arr.begin())>;
+        if(error) {
+            std::cerr << "xme::SoAArray iterator error\n";
+            ++errors;
+        }
+    }
+    return errors;
+}
+
+int test_columns() {
+    int errors = 0;
+    {
+        xme::SoAArray<char, double, std::int32_t> arr;
+        for(int i = 0; i < 10; ++i)
+            arr.emplace_back(char('a' + i), i * 0.5, i);
+
+        auto ints    = arr.column<2>();
+        auto doubles = arr.column<1>();
+        int sum      = 0;
+        for(auto v : ints)
+            sum += v;
+        bool error = sum != 45 || ints.size() != 10 || doubles[4] != 2.0;
+        error |= reinterpret_cast<std::uintptr_t>(arr.data<0>()) % 64 != 0;
+        error |= reinterpret_cast<std::uintptr_t>(arr.data<1>()) % 64 != 0;
+        error |= !std::is_same_v<decltype(arr)::column_type<1>, double>;
+        if(error) {
+            std::cerr << "xme::SoAArray::column error\n";
+            ++errors;
+        }
+    }
+    return errors;
+}
+
+int test_modifiers() {
+    int errors = 0;
+    {
+        xme::SoAArray<std::string, int> arr;
+        arr.emplace_back("a", 1);
+        arr.push_back(xme::Tuple<std::string, int>{"b", 2});
+        arr.emplace_back("c", 3);
+        bool error = arr.size() != 3 || arr.capacity() != 4 || get<0>(arr[2]) != "c";
+        arr.pop_back();
+        error |= arr.size() != 2 || get<0>(arr.back()) != "b";
+
+        xme::SoAArray<std::string, int> copy{arr};
+        xme::SoAArray<std::string, int> moved{std::move(arr)};
+        error |= !arr.empty() || copy.size() != 2 || moved.size() != 2;
+        error |= get<0>(copy[0]) != "a" || get<1>(moved[1]) != 2;
+        moved.clear();
+        error |= !moved.empty() || moved.capacity() != 4;
+        if(error) {
+            std::cerr << "xme::SoAArray modifiers error\n";
+            ++errors;
+        }
+    }
+    return errors;
+}
+
+//! Copying throws once armed, and its move may throw, so growing copies it.
+struct ThrowingCopy {
+    static inline bool armed = false;
+
+    explicit ThrowingCopy(int v) : value(std::make_unique<int>(v)) {}
+
+    ThrowingCopy(const ThrowingCopy& other) : value(std::make_unique<int>(*other.value)) {
+        if(armed)
+            throw std::runtime_error("copy");
+    }
+
+    ThrowingCopy(ThrowingCopy&& other) noexcept(false) = default;
+
+    std::unique_ptr<int> value;
+};
+
+int test_growth() {
+    int errors = 0;
+    {
+        // The argument is an element of the full array
+        xme::SoAArray<int, std::string> arr;
+        arr.emplace_back(1, "long string not in small buffer");
+        arr.push_back(arr[0]);
+        arr.push_back(arr[1]);
+        bool error = arr.size() != 3 || get<1>(arr[2]) != "long string not in small buffer";
+        error |= get<0>(arr[2]) != 1;
+        if(error) {
+            std::cerr << "xme::SoAArray aliasing error\n";
+            ++errors;
+        }
+    }
+    {
+        xme::SoAArray<std::string, ThrowingCopy> arr;
+        arr.emplace_back("a", ThrowingCopy(1));
+        ThrowingCopy::armed = true;
+        bool error          = true;
+        try {
+            arr.emplace_back("b", ThrowingCopy(2));
+        }
+        catch(const std::runtime_error&) {
+            error = false;
+        }
+        ThrowingCopy::armed = false;
+        error |= arr.size() != 1 || arr.capacity() != 1;
+        error |= get<0>(arr[0]) != "a" || *get<1>(arr[0]).value != 1;
+        if(error) {
+            std::cerr << "xme::SoAArray growth exception error\n";
+            ++errors;
+        }
+    }
+    return errors;
+}
+
+int main() {
+    int errors = 0;
+    errors += test_access();
+    errors += test_columns();
+    errors += test_modifiers();
+    errors += test_growth();
+    return errors;
+}
@@ -0,0 +1,150 @@
+#include <algorithm>
+#include <iostream>
+#include <list>
+#include <random>
+#include <string>
+#include <vector>
+#include <xme/container/unrolled_list.hpp>
+
+int test_construction() {
+    int errors = 0;
+    {
+        std::vector<int> values(100);
+        for(int i = 0; i < 100; ++i)
+            values[i] = i;
+        xme::UnrolledList<int, 8> list(values);
+        bool error = list.size() != 100 || !std::ranges::equal(list, values);
+        int sum = 0;
+        list.for_each([&sum](int value) { sum += value; });
+        error |= sum != 4950;
+        xme::UnrolledList<int, 8> copy{list};
+        error |= !std::ranges::equal(copy, values);
+        xme::UnrolledList<int, 8> moved{std::move(copy)};
+        error |= !std::ranges::equal(moved, values) || !copy.is_empty();
+        if(error) {
+            std::cerr << "xme::UnrolledList range construction error\n";
+            ++errors;
+        }
+    }
+    {
+        xme::UnrolledList<std::string, 4> list(10, "unrolled list string");
+        bool error = list.size() != 10;
+        for(const std::string& value : list)
+            error |= value != "unrolled list string";
+        list = xme::UnrolledList<std::string, 4>{"a", "b", "c"};
+        error |= list.size() != 3 || list.front() != "a";
+        if(error) {
+            std::cerr << "xme::UnrolledList value construction error\n";
+            ++errors;
+        }
+    }
+    return errors;
+}
+
+template<typename T>
+auto make_value(int i) -> T {
+    if constexpr(std::is_same_v<T, std::string>)
+        return "a string long enough to allocate " + std::to_string(i);
+    else
+        return T(i);
+}
+
+//! Applies the same random insertions and erasures to an UnrolledList and a std::list.
+template<typename T, std::size_t N>
+int test_random_operations(std::uint32_t seed) {
+    int errors = 0;
+    xme::UnrolledList<T, N> list;
+    std::list<T> expected;
+    std::mt19937 rng(seed);
+    for(int i = 0; i < 2000; ++i) {
+        const std::size_t position = expected.empty() ? 0 : rng() % (expected.size() + 1);
+        auto pos                   = list.before_begin();
+        auto expected_pos          = expected.begin();
+        for(std::size_t j = 0; j < position && j < expected.size(); ++j) {
+            ++pos;
+            ++expected_pos;
+        }
+        const bool erase = rng() % 3 == 0 && expected_pos != expected.end();
+        if(erase) {
+            auto it      = list.erase_after(pos);
+            expected_pos = expected.erase(expected_pos);
+            if((it == list.end()) != (expected_pos == expected.end())
+               || (it != list.end() && *it != *expected_pos)) {
+                std::cerr << "xme::UnrolledList::erase_after return error\n";
+                return 1;
+            }
+        }
+        else {
+            const T value = make_value<T>(i);
+            auto it       = list.insert_after(pos, value);
+            expected.insert(expected_pos, value);
+            if(*it != value) {
+                std::cerr << "xme::UnrolledList::insert_after return error\n";
+                return 1;
+            }
+        }
+    }
+    if(list.size() != expected.size() || !std::ranges::equal(list, expected)) {
+        std::cerr << "xme::UnrolledList random operations error\n";
+        ++errors;
+    }
+    list.reverse();
+    expected.reverse();
+    if(!std::ranges::equal(list, expected)) {
+        std::cerr << "xme::UnrolledList::reverse error\n";
+        ++errors;
+    }
+    while(!list.is_empty())
+        list.pop_front();
+    return errors;
+}
+
+int test_front() {
+    int errors = 0;
+    xme::UnrolledList<std::string, 2> list;
+    for(int i = 0; i < 5; ++i)
+        list.emplace_front(std::to_string(i));
+    list.push_front("front");
+    bool error = list.front() != "front" || list.size() != 6;
+    list.pop_front();
+    list.pop_front();
+    error |= list.front() != "3" || list.size() != 4;
+    list.clear();
+    error |= !list.is_empty() || list.begin() != list.end();
+    if(error) {
+        std::cerr << "xme::UnrolledList front error\n";
+        ++errors;
+    }
+    return errors;
+}
+
+int test_aliasing() {
+    int errors = 0;
+    {
+        // The argument is an element moved to the new node by the split of a full node
+        xme::UnrolledList<std::string, 4> list;
+        const std::vector<std::string> values{"first long string", "second long string",
+                                              "third long string", "fourth long string"};
+        list.insert_after(list.before_begin(), values);
+        list.emplace_after(list.begin(), *std::next(list.begin(), 3));
+        list.insert_after(list.begin(), list.front());
+        const std::vector<std::string> expected{values[0], values[0], values[3],
+                                                values[1], values[2], values[3]};
+        if(!std::ranges::equal(list, expected) || list.size() != 6) {
+            std::cerr << "xme::UnrolledList aliasing error\n";
+            ++errors;
+        }
+    }
+    return errors;
+}
+
+int main() {
+    int errors = 0;
+    errors += test_construction();
+    errors += test_random_operations<int, 2>(1);
+    errors += test_random_operations<int, 8>(2);
+    errors += test_random_operations<std::string, 5>(3);
+    errors += test_front();
+    errors += test_aliasing();
+    return errors;
+}
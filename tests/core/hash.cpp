@@ -0,0 +1,178 @@
+#include <gtest/gtest.h>
+#include <array>
+#include <cstdint>
+#include <set>
+#include <string>
+#include <string_view>
+#include <tuple>
+#include <vector>
+#include <xme/container/array.hpp>
+#include <xme/container/hash_map.hpp>
+#include <xme/container/pair.hpp>
+#include <xme/container/tuple.hpp>
+#include <xme/core/hash/crc32c.hpp>
+#include <xme/core/hash/hash.hpp>
+#include <xme/math/vector.hpp>
+
+class HashTest : public testing::Test {
+public:
+    //! Bit at a time reference of the crc32c, without the inversions.
+    static auto reference_crc32c(std::uint32_t crc, const std::vector<std::byte>& data)
+      -> std::uint32_t {
+        crc = ~crc;
+        for(std::byte byte : data) {
+            crc ^= static_cast<std::uint32_t>(byte);
+            for(int bit = 0; bit < 8; ++bit)
+                crc = (crc & 1) ? (crc >> 1) ^ 0x82f6'3b78 : crc >> 1;
+        }
+        return ~crc;
+    }
+
+    static auto pseudo_random_bytes(std::size_t n) -> std::vector<std::byte> {
+        std::vector<std::byte> bytes(n);
+        std::uint64_t state = 0x9e37'79b9'7f4a'7c15ull;
+        for(std::byte& byte : bytes) {
+            state = state * 6364136223846793005ull + 1442695040888963407ull;
+            byte  = static_cast<std::byte>(state >> 56);
+        }
+        return bytes;
+    }
+};
+
+static constexpr auto as_byte_array(std::string_view text) {
+    std::array<std::byte, 9> bytes{};
+    for(std::size_t i = 0; i < bytes.size(); ++i)
+        bytes[i] = static_cast<std::byte>(text[i]);
+    return bytes;
+}
+
+static_assert(xme::crc32c(as_byte_array("123456789")) == 0xe306'9283);
+static_assert(xme::Hash<int>{}(42) == xme::Hash<long>{}(42l));
+static_assert(xme::CHashable<xme::Pair<int, std::string>>);
+static_assert(!xme::CHashable<std::set<int>::iterator>);
+
+TEST_F(HashTest, Crc32c) {
+    const std::string check = "123456789";
+    EXPECT_EQ(xme::crc32c(xme::as_bytes(xme::ArrayView(check))), 0xe306'9283);
+    EXPECT_EQ(xme::crc32c({}), 0);
+
+    // RFC 3720 B.4
+    std::array<std::byte, 32> bytes{};
+    EXPECT_EQ(xme::crc32c(bytes), 0x8a91'36aa);
+    bytes.fill(std::byte{0xff});
+    EXPECT_EQ(xme::crc32c(bytes), 0x62a8'ab43);
+    for(std::size_t i = 0; i < bytes.size(); ++i)
+        bytes[i] = static_cast<std::byte>(i);
+    EXPECT_EQ(xme::crc32c(bytes), 0x46dd'794e);
+
+    // Long enough for both interleaved block sizes, at every alignment.
+    const std::vector<std::byte> data = pseudo_random_bytes(3 * 8192 + 3 * 256 + 40);
+    for(std::size_t offset = 0; offset < 8; ++offset) {
+        for(std::size_t size : {std::size_t(7), std::size_t(800), data.size() - offset}) {
+            const std::vector<std::byte> part(data.begin() + offset, data.begin() + offset + size);
+            EXPECT_EQ(xme::crc32c(part), reference_crc32c(0, part)) << offset << ' ' << size;
+        }
+    }
+
+    // The checksum of a record written in parts.
+    const xme::ArrayView<const std::byte> view(data);
+    std::uint32_t crc = 0;
+    for(std::size_t i = 0; i < view.size(); i += 1000)
+        crc = xme::crc32c(view.subview(i, std::min<std::size_t>(1000, view.size() - i)), crc);
+    EXPECT_EQ(crc, xme::crc32c(view));
+}
+
+#if XME_USE_SIMD_SSE42 && (defined(__x86_64__) || defined(_M_X64))
+TEST_F(HashTest, Crc32cHardware) {
+    // Shifting a crc over Block bytes is the crc of Block zero bytes.
+    const std::vector<std::byte> zeros(8192);
+    for(std::uint32_t crc : {0x0000'0001u, 0x8000'0000u, 0xe306'9283u, 0xffff'ffffu}) {
+        EXPECT_EQ(xme::detail::crc32c_shift<256>(crc),
+                  xme::detail::crc32c_software(crc, zeros.data(), 256));
+        EXPECT_EQ(xme::detail::crc32c_shift<8192>(crc),
+                  xme::detail::crc32c_software(crc, zeros.data(), 8192));
+    }
+
+    // Every length up to past the short interleave, and around each long interleave.
+    std::vector<std::size_t> sizes;
+    for(std::size_t size = 0; size <= 3 * 256 + 40; ++size)
+        sizes.push_back(size);
+    for(std::size_t blocks : {1, 2}) {
+        for(std::size_t tail : {0, 1, 7, 8, 3 * 256 - 1, 3 * 256, 3 * 256 + 9})
+            sizes.push_back(blocks * 3 * 8192 + tail);
+        sizes.push_back(blocks * 3 * 8192 - 1);
+    }
+
+    const std::vector<std::byte> data = pseudo_random_bytes(2 * 3 * 8192 + 3 * 256 + 16);
+    for(std::size_t offset = 0; offset < 8; ++offset) {
+        for(std::size_t size : sizes) {
+            const std::byte* first = data.data() + offset;
+            EXPECT_EQ(xme::detail::crc32c_hardware(0x1234'5678, first, size),
+                      xme::detail::crc32c_software(0x1234'5678, first, size))
+              << offset << ' ' << size;
+        }
+    }
+}
+#endif
+
+TEST_F(HashTest, HashBytes) {
+    const std::vector<std::byte> data = pseudo_random_bytes(300);
+    const xme::ArrayView<const std::byte> view(data);
+    std::set<std::uint64_t> hashes;
+    for(std::size_t n = 0; n <= data.size(); ++n) {
+        const std::uint64_t hash = xme::hash_bytes(view.subview(0, n));
+        EXPECT_EQ(hash, xme::hash_bytes(view.subview(0, n)));
+        EXPECT_NE(hash, xme::hash_bytes(view.subview(0, n), 1));
+        hashes.insert(hash);
+    }
+    EXPECT_EQ(hashes.size(), data.size() + 1);
+
+    // Every bit of the input changes the hash
+    std::vector<std::byte> copy = data;
+    for(std::size_t n : {3, 9, 16, 47, 48, 100}) {
+        const std::uint64_t hash = xme::hash_bytes(xme::ArrayView<const std::byte>(copy.data(), n));
+        for(std::size_t bit = 0; bit < 8 * n; ++bit) {
+            copy[bit / 8] ^= std::byte(1 << (bit % 8));
+            EXPECT_NE(hash, xme::hash_bytes(xme::ArrayView<const std::byte>(copy.data(), n)));
+            copy[bit / 8] ^= std::byte(1 << (bit % 8));
+        }
+    }
+}
+
+TEST_F(HashTest, Hash) {
+    EXPECT_NE(xme::Hash<int>{}(1), xme::Hash<int>{}(2));
+    EXPECT_EQ(xme::Hash<double>{}(0.0), xme::Hash<double>{}(-0.0));
+    EXPECT_NE(xme::Hash<float>{}(1.f), xme::Hash<float>{}(2.f));
+
+    const std::string text = "a key long enough to not be stored inline";
+    const xme::Hash<std::string> string_hash;
+    EXPECT_EQ(string_hash(text), xme::Hash<std::string_view>{}(text));
+    EXPECT_EQ(string_hash(text), xme::Hash<std::vector<char>>{}({text.begin(), text.end()}));
+    EXPECT_NE(string_hash(text), string_hash(text.substr(1)));
+
+    xme::Array<int> array{1, 2, 3};
+    EXPECT_EQ(xme::Hash<xme::Array<int>>{}(array), (xme::Hash<std::array<int, 3>>{}({1, 2, 3})));
+    array[2] = 4;
+    EXPECT_NE(xme::Hash<xme::Array<int>>{}(array), (xme::Hash<std::array<int, 3>>{}({1, 2, 3})));
+    const std::vector<std::string> words{"ab", "c"};
+    EXPECT_NE(xme::Hash<std::vector<std::string>>{}(words),
+              (xme::Hash<std::vector<std::string>>{}({"a", "bc"})));
+
+    using P = xme::Pair<int, std::string>;
+    EXPECT_EQ(xme::Hash<P>{}({1, "one"}), xme::Hash<P>{}({1, "one"}));
+    EXPECT_NE(xme::Hash<P>{}({1, "one"}), xme::Hash<P>{}({2, "one"}));
+    EXPECT_EQ(xme::Hash<P>{}({1, "one"}), (xme::Hash<std::tuple<int, std::string>>{}({1, "one"})));
+    using T = xme::Tuple<int, double, char>;
+    EXPECT_NE(xme::Hash<T>{}({1, 2.0, 'c'}), xme::Hash<T>{}({1, 2.0, 'd'}));
+    EXPECT_NE(xme::Hash<T>{}({1, 2.0, 'c'}), xme::Hash<T>{}({2, 1.0, 'c'}));
+
+    using Vec3 = xme::math::Vector<float, 3>;
+    EXPECT_EQ(xme::Hash<Vec3>{}({1, 2, 3}), xme::Hash<Vec3>{}({1, 2, 3}));
+    EXPECT_NE(xme::Hash<Vec3>{}({1, 2, 3}), xme::Hash<Vec3>{}({3, 2, 1}));
+    EXPECT_NE((xme::Hash<xme::math::Vector<int, 5>>{}({1, 2, 3, 4, 5})),
+              (xme::Hash<xme::math::Vector<int, 5>>{}({1, 2, 3, 4, 6})));
+
+    xme::HashMap<std::string, int, xme::Hash<std::string>, std::equal_to<>> map;
+    map.try_emplace(std::string("key"), 1);
+    EXPECT_TRUE(map.contains(std::string_view("key")));
+}
@@ -0,0 +1,327 @@
+#include <gtest/gtest.h>
+#include <cstddef>
+#include <cstdint>
+#include <memory>
+#include <string>
+#include <thread>
+#include <type_traits>
+#include <xme/container/array.hpp>
+#include <xme/container/concepts.hpp>
+#include <xme/container/linked_list.hpp>
+#include <xme/container/spsc_queue.hpp>
+#include <xme/core/memory/aligned_allocator.hpp>
+#include <xme/core/memory/huge_page_allocator.hpp>
+#include <xme/core/memory/monotonic_arena.hpp>
+#include <xme/core/memory/pool_allocator.hpp>
+#include <xme/core/memory/slab_allocator.hpp>
+#include <xme/core/memory/tracking_allocator.hpp>
+
+class MemoryTest : public testing::Test {
+public:
+};
+
+TEST_F(MemoryTest, PoolAllocator) {
+    using Alloc = xme::PoolAllocator<std::uint32_t, 4>;
+    static_assert(xme::CAllocator<Alloc>);
+
+    Alloc alloc;
+    std::uint32_t* a = alloc.allocate(1);
+    std::uint32_t* b = alloc.allocate(1);
+    EXPECT_EQ(reinterpret_cast<std::uintptr_t>(b) - reinterpret_cast<std::uintptr_t>(a), 8);
+    EXPECT_EQ(reinterpret_cast<std::uintptr_t>(a) % alignof(std::uint32_t), 0);
+
+    alloc.deallocate(a, 1);
+    EXPECT_EQ(alloc.allocate(1), a);
+
+    Alloc copy{alloc};
+    EXPECT_TRUE(copy == alloc);
+    copy.deallocate(b, 1);
+    EXPECT_EQ(alloc.allocate(1), b);
+
+    alloc.reserve(10);
+    std::uint32_t* first = alloc.allocate(1);
+    for(std::size_t i = 1; i < 10; ++i)
+        EXPECT_EQ(alloc.allocate(1), reinterpret_cast<std::uint32_t*>(
+                                       reinterpret_cast<std::byte*>(first) + i * 8));
+
+    std::uint32_t* many = alloc.allocate(3);
+    alloc.deallocate(many, 3);
+
+    xme::PoolAllocator<std::uint64_t> rebound{alloc};
+    EXPECT_TRUE(rebound == alloc);
+    EXPECT_TRUE(Alloc(rebound) == alloc);
+    EXPECT_FALSE(rebound == xme::PoolAllocator<std::uint64_t>{});
+    std::uint64_t* wide = rebound.allocate(1);
+    EXPECT_EQ(reinterpret_cast<std::uintptr_t>(wide) % alignof(std::uint64_t), 0);
+    rebound.deallocate(wide, 1);
+    static_assert(std::is_same_v<std::allocator_traits<Alloc>::rebind_alloc<char>,
+                                 xme::PoolAllocator<char, 4>>);
+
+    // The default constructor allocates, so containers using it may throw when constructed
+    using PoolList = xme::LinkedList<int, xme::PoolAllocator<int>>;
+    static_assert(std::is_nothrow_default_constructible_v<xme::LinkedList<int>>);
+    static_assert(!std::is_nothrow_default_constructible_v<PoolList>);
+
+    // A moved from allocator stays equal and keeps its pool
+    Alloc moved{std::move(copy)};
+    EXPECT_TRUE(moved == copy);
+    moved = std::move(copy);
+    EXPECT_TRUE(moved == copy);
+    xme::Array<long, xme::PoolAllocator<long>> array;
+    array.reserve(4);
+    {
+        xme::Array<long, xme::PoolAllocator<long>> scoped{std::move(array)};
+    }
+    array.reserve(1);
+    array.push_back(1);
+    EXPECT_EQ(array[0], 1);
+}
+
+TEST_F(MemoryTest, MonotonicArena) {
+    alignas(std::max_align_t) std::byte buffer[256];
+    xme::MonotonicArena arena(buffer, sizeof(buffer), 1024);
+    void* a = arena.allocate(10, 1);
+    void* b = arena.allocate(8, 8);
+    EXPECT_EQ(a, buffer);
+    EXPECT_EQ(b, buffer + 16);
+    arena.deallocate(b, 8);
+    EXPECT_EQ(arena.remaining(), sizeof(buffer) - 24);
+
+    // Overflows the buffer into blocks from the global allocator
+    void* aligned = arena.allocate(100, 64);
+    EXPECT_EQ(reinterpret_cast<std::uintptr_t>(aligned) % 64, 0);
+    void* large = arena.allocate(5000);
+    EXPECT_TRUE(large < static_cast<void*>(buffer) || large >= static_cast<void*>(buffer + 256));
+
+    // The buffer is used again, then the largest block
+    arena.reset();
+    EXPECT_EQ(arena.allocate(200, 1), buffer);
+    EXPECT_EQ(arena.allocate(4000, 1), large);
+
+    xme::MonotonicArena heap_only;
+    EXPECT_EQ(heap_only.remaining(), 0);
+    void* first = heap_only.allocate(1);
+    heap_only.reset();
+    EXPECT_EQ(heap_only.allocate(1), first);
+}
+
+TEST_F(MemoryTest, ArenaAllocator) {
+    static_assert(xme::CAllocator<xme::ArenaAllocator<int>>);
+    xme::MonotonicArena arena;
+    {
+        xme::Array<int, xme::ArenaAllocator<int>> array(arena);
+        for(int i = 0; i < 1000; ++i)
+            array.push_back(i);
+        EXPECT_EQ(array[999], 999);
+
+        xme::LinkedList<std::string, xme::ArenaAllocator<std::string>> list(arena);
+        list.push_front("a string long enough to allocate");
+        list.push_front("b");
+        EXPECT_EQ(list.front(), "b");
+
+        xme::SPSCQueue<int, xme::ArenaAllocator<int>> queue(16, arena);
+        EXPECT_TRUE(queue.push(1));
+        EXPECT_EQ(queue.read_available(), 1);
+    }
+    arena.reset();
+
+    xme::ArenaAllocator<std::uint64_t> rebound{xme::ArenaAllocator<char>(arena)};
+    EXPECT_EQ(&rebound.arena(), &arena);
+    EXPECT_THROW((void)rebound.allocate(std::size_t(-1) / 4), std::bad_array_new_length);
+}
+
+TEST_F(MemoryTest, SlabAllocator) {
+    static_assert(xme::CAllocator<xme::SlabAllocator<int>>);
+    static_assert(xme::detail::slab_class(1) == 0);
+    static_assert(xme::detail::slab_class(17) == 1);
+    static_assert(xme::detail::slab_class(129) == 8);
+    static_assert(xme::detail::slab_class_size(xme::detail::slab_class(300)) == 320);
+    static_assert(xme::detail::slab_class(xme::detail::slab_max_size)
+                  == xme::detail::slab_class_count - 1);
+    for(std::size_t bytes = 1; bytes <= xme::detail::slab_max_size; ++bytes) {
+        const std::size_t size = xme::detail::slab_class_size(xme::detail::slab_class(bytes));
+        EXPECT_GE(size, bytes);
+        EXPECT_EQ(size % 16, 0);
+    }
+
+    xme::SlabAllocator<std::uint64_t> alloc;
+    std::uint64_t* a = alloc.allocate(1);
+    std::uint64_t* b = alloc.allocate(1);
+    EXPECT_NE(a, b);
+    EXPECT_EQ(reinterpret_cast<std::uintptr_t>(a) % alignof(std::max_align_t), 0);
+    alloc.deallocate(a, 1);
+    EXPECT_EQ(alloc.allocate(1), a);
+    alloc.deallocate(a, 1);
+    alloc.deallocate(b, 1);
+
+    auto [p, count] = alloc.allocate_at_least(5);
+    EXPECT_EQ(count, 6);
+    alloc.deallocate(p, count);
+    std::uint64_t* large = alloc.allocate(1000);
+    large[999]           = 1;
+    alloc.deallocate(large, 1000);
+
+    xme::Array<int, xme::SlabAllocator<int>> array;
+    xme::LinkedList<std::string, xme::SlabAllocator<std::string>> list;
+    for(int i = 0; i < 1000; ++i) {
+        array.push_back(i);
+        list.push_front(std::to_string(i));
+    }
+    EXPECT_EQ(array[999], 999);
+    EXPECT_EQ(list.front(), "999");
+}
+
+TEST_F(MemoryTest, SlabAllocatorCrossThread) {
+    // The producer allocates nodes which the consumer frees
+    constexpr int count = 100'000;
+    xme::SPSCQueue<std::uint64_t*> queue(1024);
+    std::thread producer([&] {
+        xme::SlabAllocator<std::uint64_t> producer_alloc;
+        for(int i = 0; i < count; ++i) {
+            std::uint64_t* p = producer_alloc.allocate(1);
+            *p               = i;
+            while(!queue.push(p))
+                std::this_thread::yield();
+        }
+    });
+    xme::SlabAllocator<std::uint64_t> alloc;
+    std::uint64_t expected = 0;
+    int errors             = 0;
+    for(int i = 0; i < count; ++i) {
+        while(queue.read_available() == 0)
+            std::this_thread::yield();
+        queue.consume([&](std::uint64_t* p) {
+            errors += *p != expected++;
+            alloc.deallocate(p, 1);
+        });
+    }
+    producer.join();
+    EXPECT_EQ(errors, 0);
+
+    // Freed nodes and the rest of the exited thread's chunk are reused
+    std::thread([] {
+        xme::SlabAllocator<std::uint64_t> thread_alloc;
+        for(int i = 0; i < count; ++i)
+            thread_alloc.deallocate(thread_alloc.allocate(1), 1);
+    }).join();
+}
+
+namespace {
+struct TrackingTag {};
+struct ThreadTrackingTag {};
+}  // namespace
+
+TEST_F(MemoryTest, TrackingAllocator) {
+    using Alloc = xme::TrackingAllocator<std::allocator<int>, TrackingTag>;
+    static_assert(xme::CAllocator<Alloc>);
+    static_assert(std::is_same_v<std::allocator_traits<Alloc>::rebind_alloc<double>,
+                                 xme::TrackingAllocator<std::allocator<double>, TrackingTag>>);
+
+    Alloc alloc;
+    int* p = alloc.allocate(10);
+    int* q = alloc.allocate(1);
+    auto stats = xme::allocation_stats<TrackingTag>();
+    EXPECT_EQ(stats.allocations, 2);
+    EXPECT_EQ(stats.bytes_allocated, 44);
+    EXPECT_EQ(stats.live_bytes, 44);
+    EXPECT_EQ(stats.histogram[6], 1);  // 40 bytes
+    EXPECT_EQ(stats.histogram[3], 1);  // 4 bytes
+    alloc.deallocate(p, 10);
+    alloc.deallocate(q, 1);
+    stats = xme::allocation_stats<TrackingTag>();
+    EXPECT_EQ(stats.deallocations, 2);
+    EXPECT_EQ(stats.live_bytes, 0);
+    EXPECT_EQ(stats.peak_bytes, 44);
+    EXPECT_EQ(xme::allocation_stats<ThreadTrackingTag>().allocations, 0);
+
+    {
+        xme::Array<int, Alloc> array;
+        xme::LinkedList<int, Alloc> list;
+        xme::SPSCQueue<int, Alloc> queue(16, alloc);
+        for(int i = 0; i < 100; ++i) {
+            array.push_back(i);
+            list.push_front(i);
+        }
+        stats = xme::allocation_stats<TrackingTag>();
+        EXPECT_GE(stats.live_bytes, 100 * sizeof(int) + 100 * sizeof(int) + 16 * sizeof(int));
+    }
+    stats = xme::allocation_stats<TrackingTag>();
+    EXPECT_EQ(stats.live_bytes, 0);
+    EXPECT_EQ(stats.allocations, stats.deallocations);
+
+    // Wraps another allocator, with its allocate_at_least
+    xme::TrackingAllocator<xme::SlabAllocator<std::uint64_t>, TrackingTag> slab;
+    auto [r, count] = slab.allocate_at_least(5);
+    EXPECT_EQ(xme::allocation_stats<TrackingTag>().live_bytes, count * sizeof(std::uint64_t));
+    slab.deallocate(r, count);
+}
+
+TEST_F(MemoryTest, TrackingAllocatorThreads) {
+    // Counters of exited threads are kept, and memory freed by another thread is subtracted
+    using Alloc = xme::TrackingAllocator<std::allocator<char>, ThreadTrackingTag>;
+    constexpr std::size_t size = 1 << 20;
+    char* p                    = nullptr;
+    std::thread([&] { p = Alloc().allocate(size); }).join();
+    auto stats = xme::allocation_stats<ThreadTrackingTag>();
+    EXPECT_EQ(stats.live_bytes, size);
+    EXPECT_EQ(stats.peak_bytes, size);
+    Alloc().deallocate(p, size);
+    std::thread([] { Alloc().deallocate(Alloc().allocate(1), 1); }).join();
+    stats = xme::allocation_stats<ThreadTrackingTag>();
+    EXPECT_EQ(stats.allocations, 2);
+    EXPECT_EQ(stats.live_bytes, 0);
+    EXPECT_EQ(stats.peak_bytes, size);
+}
+
+TEST_F(MemoryTest, AlignedAllocator) {
+    using Alloc = xme::AlignedAllocator<float, 64>;
+    static_assert(xme::CAllocator<Alloc>);
+    static_assert(std::is_same_v<std::allocator_traits<Alloc>::rebind_alloc<double>,
+                                 xme::AlignedAllocator<double, 64>>);
+
+    Alloc alloc;
+    for(std::size_t n = 1; n < 100; n += 7) {
+        float* p = alloc.allocate(n);
+        EXPECT_EQ(reinterpret_cast<std::uintptr_t>(p) % 64, 0);
+        alloc.deallocate(p, n);
+    }
+    auto [p, count] = alloc.allocate_at_least(17);
+    EXPECT_EQ(count, 32);
+    alloc.deallocate(p, count);
+
+    xme::Array<float, Alloc> array;
+    for(int i = 0; i < 1000; ++i) {
+        array.push_back(float(i));
+        EXPECT_EQ(reinterpret_cast<std::uintptr_t>(array.data()) % 64, 0);
+    }
+    EXPECT_EQ(array.capacity() % 16, 0);
+}
+
+TEST_F(MemoryTest, HugePageAllocator) {
+    using Alloc = xme::HugePageAllocator<std::uint64_t>;
+    static_assert(xme::CAllocator<Alloc>);
+    constexpr std::size_t page = Alloc::huge_page_size;
+
+    Alloc alloc;
+    std::uint64_t* small = alloc.allocate(10);
+    small[9]             = 1;
+    alloc.deallocate(small, 10);
+
+    const std::size_t n  = page / sizeof(std::uint64_t) + 1;
+    std::uint64_t* large = alloc.allocate(n);
+    EXPECT_EQ(reinterpret_cast<std::uintptr_t>(large) % page, 0);
+    large[0]     = 1;
+    large[n - 1] = 2;
+    alloc.deallocate(large, n);
+
+    auto [p, count] = alloc.allocate_at_least(n);
+    EXPECT_EQ(count * sizeof(std::uint64_t), 2 * page);
+    p[count - 1] = 3;
+    alloc.deallocate(p, count);
+
+    xme::Array<std::uint64_t, Alloc> array(n, 7);
+    EXPECT_EQ(array[n - 1], 7);
+    EXPECT_EQ(reinterpret_cast<std::uintptr_t>(array.data()) % page, 0);
+    xme::SPSCQueue<std::uint64_t, Alloc> queue(std::size_t(1) << 20);
+    EXPECT_TRUE(queue.push(1));
+}
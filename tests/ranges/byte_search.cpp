@@ -0,0 +1,108 @@
+#include <xme/container/array_view.hpp>
+#include <xme/ranges/byte_search.hpp>
+#include <algorithm>
+#include <iostream>
+#include <string>
+#include <string_view>
+#include <vector>
+
+static_assert(*xme::ranges::find_byte(std::string_view("a,b"), ',') == ',');
+static_assert(xme::ranges::equal(std::string_view("abc"), std::string_view("abc")));
+
+//! Every position of the needle in buffers of every size up to a few vector widths,
+//! at every alignment, so each kernel goes through its vector, word and byte loops.
+int test_find_byte() {
+    int errors = 0;
+    std::vector<std::byte> buffer(256 + 16, std::byte{'x'});
+    bool error = false;
+    for(std::size_t offset = 0; offset < 16; ++offset) {
+        for(std::size_t size = 0; size <= 256; size += 1 + size / 16) {
+            xme::ArrayView<std::byte> view(buffer.data() + offset, size);
+            error |= xme::ranges::find_byte(view, std::byte{','}) != view.end();
+            for(std::size_t pos = 0; pos < size; ++pos) {
+                view[pos] = std::byte{','};
+                error |= xme::ranges::find_byte(view, std::byte{','}) != view.begin() + pos;
+                // A byte that differs only in its high bit must not match.
+                view[pos] = std::byte{',' | 0x80};
+                error |= xme::ranges::find_byte(view, std::byte{','}) != view.end();
+                view[pos] = std::byte{'x'};
+            }
+        }
+    }
+    const std::string text = "key=value;other=1";
+    error |= xme::ranges::find_byte(text, ';') != text.begin() + 9;
+    error |= xme::ranges::find_byte(xme::as_bytes(xme::ArrayView(text)), std::byte{'='})
+          != xme::as_bytes(xme::ArrayView(text)).begin() + 3;
+    if(error) {
+        std::cerr << "xme::ranges::find_byte error\n";
+        ++errors;
+    }
+    return errors;
+}
+
+int test_find_any_of() {
+    int errors = 0;
+    bool error = false;
+    std::string small_set = "\r\n;";
+    std::string large_set;
+    for(char c = 'A'; c <= 'Z'; ++c)
+        large_set.push_back(c);
+    for(const std::string& set : {small_set, large_set, std::string()}) {
+        for(std::size_t size = 0; size <= 200; size += 7) {
+            for(std::size_t pos = 0; pos <= size; pos += 3) {
+                std::string text(size, 'a');
+                if(pos < size && !set.empty())
+                    text[pos] = set[pos % set.size()];
+                const auto expected = std::ranges::find_first_of(text, set);
+                error |= xme::ranges::find_any_of(text, set) != expected;
+            }
+        }
+    }
+    // Ranges that are not of bytes use the generic algorithm.
+    const std::vector<int> values{1, 2, 3, 4};
+    error |= xme::ranges::find_any_of(values, std::vector{7, 3}) != values.begin() + 2;
+    if(error) {
+        std::cerr << "xme::ranges::find_any_of error\n";
+        ++errors;
+    }
+    return errors;
+}
+
+int test_mismatch_equal() {
+    int errors = 0;
+    bool error = false;
+    for(std::size_t size = 0; size <= 150; ++size) {
+        std::vector<unsigned char> lhs(size);
+        for(std::size_t i = 0; i < size; ++i)
+            lhs[i] = static_cast<unsigned char>(i * 31);
+        std::vector<unsigned char> rhs = lhs;
+        error |= !xme::ranges::equal(lhs, rhs);
+        error |= xme::ranges::mismatch(lhs, rhs).first != lhs.end();
+        for(std::size_t pos = 0; pos < size; pos += 5) {
+            rhs[pos] ^= 0x10;
+            auto [in1, in2] = xme::ranges::mismatch(lhs, rhs);
+            error |= in1 != lhs.begin() + pos || in2 != rhs.begin() + pos;
+            error |= xme::ranges::equal(lhs, rhs);
+            rhs[pos] ^= 0x10;
+        }
+    }
+    const std::string_view lhs = "framing";
+    const std::string_view rhs = "frame";
+    error |= xme::ranges::mismatch(lhs, rhs).first != lhs.begin() + 4;
+    error |= xme::ranges::mismatch(lhs.substr(0, 4), rhs).second != rhs.begin() + 4;
+    error |= xme::ranges::equal(lhs, lhs.substr(0, 6));
+    error |= !xme::ranges::equal(std::vector{1, 2}, std::vector{1, 2});
+    if(error) {
+        std::cerr << "xme::ranges::mismatch error\n";
+        ++errors;
+    }
+    return errors;
+}
+
+int main() {
+    int errors = 0;
+    errors += test_find_byte();
+    errors += test_find_any_of();
+    errors += test_mismatch_equal();
+    return errors;
+}